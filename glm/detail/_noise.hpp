@@ -59,6 +59,24 @@ namespace detail
 		return static_cast<T>(1.79284291400159) - static_cast<T>(0.85373472095314) * r;
 	}
 
+	// step(0.5 - |gx| - |gy|, 0) of the 3D Perlin gradients of the hashes x,
+	// decided on the integer sevenths behind gx and gy: their rounded values
+	// land on either side of the ties depending on contracted multiply-adds
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> gradientFold(vec<4, T, Q> const& x)
+	{
+		vec<4, T, Q> const j = floor(x * static_cast<T>(1.0 / 7.0));
+		vec<4, T, Q> const i = x - j * static_cast<T>(7);
+		vec<4, T, Q> const k = j - floor(j * static_cast<T>(1.0 / 7.0)) * static_cast<T>(7);
+		return step(vec<4, T, Q>(static_cast<T>(7)), i * static_cast<T>(2) + abs(k * static_cast<T>(2) - static_cast<T>(7)));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T fade(T const& t)
+	{
+		return (t * t * t) * (t * (t * static_cast<T>(6) - static_cast<T>(15)) + static_cast<T>(10));
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<2, T, Q> fade(vec<2, T, Q> const& t)
 	{
@@ -139,14 +139,18 @@ namespace detail
 
 #endif//GLM_ARCH & GLM_ARCH_CLANG_BIT
 
-// --- Vectorized exp/log/exp2/log2 for aligned float vectors (mediump/lowp) ---
-// highp defers to libm; mediump/lowp use 4-wide SIMD (rel err ~1-2e-7).
+// --- Vectorized exp/log/exp2/log2/pow for aligned float vectors ---
+// highp evaluates in double (simd_transcendental_highp.h, ~1 ULP);
+// mediump/lowp use 4-wide float SIMD (rel err ~1-2e-7).
 // exp/log primitives live in simd_transcendental.h (shared with the hyperbolics
 // in func_trigonometric_simd.inl, whichever header is included first).
-#if ((GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_CLANG_BIT)) && defined(__FMA__)  // SIMD path needs FMA; else libm/scalar primaries
+#include "simd_transcendental.h"
+#include "simd_transcendental_highp.h"
+#include "simd_transcendental_double.h"
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE  // SIMD path needs SSE4.1 (FMA optional); else libm/scalar primaries
 
 #include <cmath>
-#include "simd_transcendental.h"
 
 namespace glm{
 namespace detail
@@ -157,8 +161,10 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
 		{
 			vec<L, float, Q> Result;
-			if constexpr (is_highp<Q>::value || L < 3) {
+			if constexpr (L < 3) {
 				for (length_t i = 0; i < L; ++i) Result[i] = std::exp(x[i]);
+			} else if constexpr (is_highp<Q>::value) {
+				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data), glm_exp_ps_highp(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
 			} else {
 				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data),
 					glm_exp_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
@@ -173,8 +179,10 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
 		{
 			vec<L, float, Q> Result;
-			if constexpr (is_highp<Q>::value || L < 3) {
+			if constexpr (L < 3) {
 				for (length_t i = 0; i < L; ++i) Result[i] = std::log(x[i]);
+			} else if constexpr (is_highp<Q>::value) {
+				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data), glm_log_ps_highp(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
 			} else {
 				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data),
 					glm_log_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
@@ -189,8 +197,10 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
 		{
 			vec<L, float, Q> Result;
-			if constexpr (is_highp<Q>::value || L < 3) {
+			if constexpr (L < 3) {
 				for (length_t i = 0; i < L; ++i) Result[i] = std::exp2(x[i]);
+			} else if constexpr (is_highp<Q>::value) {
+				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data), glm_exp2_ps_highp(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
 			} else {
 				__m128 in = _mm_mul_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data)),
 					_mm_set1_ps(0.6931471805599453f)); // exp2(x) = exp(x*ln2)
@@ -206,8 +216,10 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& x)
 		{
 			vec<L, float, Q> Result;
-			if constexpr (is_highp<Q>::value || L < 3) {
+			if constexpr (L < 3) {
 				for (length_t i = 0; i < L; ++i) Result[i] = std::log2(x[i]);
+			} else if constexpr (is_highp<Q>::value) {
+				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data), glm_log2_ps_highp(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data))));
 			} else {
 				__m128 l = glm_log_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&x.data)));
 				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data),
@@ -224,8 +236,10 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& base, vec<L, float, Q> const& e)
 		{
 			vec<L, float, Q> Result;
-			if constexpr (is_highp<Q>::value || L < 3) {
+			if constexpr (L < 3) {
 				for (length_t i = 0; i < L; ++i) Result[i] = std::pow(base[i], e[i]);
+			} else if constexpr (is_highp<Q>::value) {
+				_mm_storeu_ps(reinterpret_cast<float*>(&Result.data), glm_pow_ps_highp(_mm_loadu_ps(reinterpret_cast<const float*>(&base.data)), _mm_loadu_ps(reinterpret_cast<const float*>(&e.data))));
 			} else {
 				__m128 lx = glm_log_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&base.data)));
 				__m128 ye = _mm_mul_ps(_mm_loadu_ps(reinterpret_cast<const float*>(&e.data)), lx);
@@ -235,7 +249,53 @@ namespace detail
 		}
 	};
 
+	// Aligned dvec2/3/4 exp/log/pow (all qualifiers, ~1-2 ULP), see simd_transcendental_double.h
+	template<length_t L, qualifier Q>
+	struct compute_exp<L, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& x)
+		{
+			if constexpr (L < 2) {
+				vec<L, double, Q> Result;
+				for (length_t i = 0; i < L; ++i) Result[i] = std::exp(x[i]);
+				return Result;
+			} else {
+				return glm_vec_pd_call(glm_exp_pd_fn(), x);
+			}
+		}
+	};
+
+	template<length_t L, qualifier Q>
+	struct compute_log<L, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& x)
+		{
+			if constexpr (L < 2) {
+				vec<L, double, Q> Result;
+				for (length_t i = 0; i < L; ++i) Result[i] = std::log(x[i]);
+				return Result;
+			} else {
+				return glm_vec_pd_call(glm_log_pd_fn(), x);
+			}
+		}
+	};
+
+	template<length_t L, qualifier Q>
+	struct compute_pow<L, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& base, vec<L, double, Q> const& e)
+		{
+			if constexpr (L < 2) {
+				vec<L, double, Q> Result;
+				for (length_t i = 0; i < L; ++i) Result[i] = std::pow(base[i], e[i]);
+				return Result;
+			} else {
+				return glm_vec_pd_call(glm_pow_pd_fn(), base, e);
+			}
+		}
+	};
+
 }//namespace detail
 }//namespace glm
 
-#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_CLANG_BIT)
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
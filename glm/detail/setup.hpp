@@ -142,6 +142,18 @@
 #	define GLM_HAS_CPP_ATTRIBUTE(attribute) 0
 #endif
 
+// P0122 std::span
+#if (GLM_LANG & GLM_LANG_CXX20_FLAG) && defined(__has_include)
+#	if __has_include(<version>)
+#		include <version>
+#	endif
+#endif
+#if (GLM_LANG & GLM_LANG_CXX20_FLAG) && defined(__cpp_lib_span)
+#	define GLM_HAS_SPAN 1
+#else
+#	define GLM_HAS_SPAN 0
+#endif
+
 // User override for disabling use of constexpr
 #if !defined(GLM_FORCE_NO_CONSTEXPR)
 #define GLM_FORCE_NO_CONSTEXPR 0
@@ -658,6 +670,11 @@ namespace detail
 #	if (GLM_ARCH & GLM_ARCH_CLANG_BIT)
 #		pragma message("GLM: clang vector extensions enabled")
 
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
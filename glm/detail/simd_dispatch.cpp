@@ -0,0 +1,261 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch.cpp
+///
+/// Run time selection of the kernel variant. This file is compiled with the
+/// library build flags only and must not execute any instruction it probes for.
+
+#include "simd_dispatch.hpp"
+#include "../ext/simd_dispatch.hpp"
+#include <atomic>
+
+#if defined(GLM_DISPATCH_X86)
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
+namespace glm{
+namespace detail
+{
+namespace
+{
+#	if defined(GLM_DISPATCH_X86)
+	void cpuid(unsigned int Leaf, unsigned int Subleaf, unsigned int Regs[4])
+	{
+#		if defined(_MSC_VER)
+			int Info[4];
+			__cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(Subleaf));
+			for(int i = 0; i < 4; ++i)
+				Regs[i] = static_cast<unsigned int>(Info[i]);
+#		else
+			Regs[0] = Regs[1] = Regs[2] = Regs[3] = 0;
+			if(Leaf <= __get_cpuid_max(Leaf & 0x80000000u, 0))
+				__cpuid_count(Leaf, Subleaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#		endif
+	}
+
+	// Register state the OS saves on context switch (XCR0)
+	unsigned long long xgetbv0()
+	{
+#		if defined(_MSC_VER)
+			return _xgetbv(0);
+#		else
+			unsigned int Eax, Edx;
+			__asm__ __volatile__("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+			return (static_cast<unsigned long long>(Edx) << 32) | Eax;
+#		endif
+	}
+
+	struct cpu_features
+	{
+		bool SSE2;
+		bool SSE4_1;
+		bool AVX2;	// AVX2, FMA, F16C and the OS saves ymm
+		bool AVX512;	// AVX-512F and the OS saves zmm, on top of AVX2
+	};
+
+	cpu_features detect_cpu_features()
+	{
+		cpu_features Features = {false, false, false, false};
+
+		unsigned int Leaf0[4], Leaf1[4], Leaf7[4];
+		cpuid(0, 0, Leaf0);
+		if(Leaf0[0] < 1)
+			return Features;
+		cpuid(1, 0, Leaf1);
+		if(Leaf0[0] >= 7)
+			cpuid(7, 0, Leaf7);
+		else
+			Leaf7[0] = Leaf7[1] = Leaf7[2] = Leaf7[3] = 0;
+
+		Features.SSE2 = (Leaf1[3] & (1u << 26)) != 0;
+		Features.SSE4_1 = Features.SSE2 && (Leaf1[2] & (1u << 19)) != 0;
+
+		bool const OSXSave = (Leaf1[2] & (1u << 27)) != 0;
+		bool const AVX = (Leaf1[2] & (1u << 28)) != 0;
+		bool const FMA = (Leaf1[2] & (1u << 12)) != 0;
+		bool const F16C = (Leaf1[2] & (1u << 29)) != 0;
+		if(!OSXSave || !AVX)
+			return Features;
+
+		unsigned long long const XCR0 = xgetbv0();
+		bool const YmmState = (XCR0 & 0x06) == 0x06;		// xmm, ymm
+		bool const ZmmState = (XCR0 & 0xE6) == 0xE6;		// xmm, ymm, opmask, zmm_hi256, hi16_zmm
+
+		Features.AVX2 = Features.SSE4_1 && FMA && F16C && YmmState && (Leaf7[1] & (1u << 5)) != 0;
+		Features.AVX512 = Features.AVX2 && ZmmState && (Leaf7[1] & (1u << 16)) != 0;
+		return Features;
+	}
+
+	cpu_features const& cpu()
+	{
+		static cpu_features const Features = detect_cpu_features();
+		return Features;
+	}
+#	endif//GLM_DISPATCH_X86
+
+	simd_dispatch_table const* find_table(dispatch::simd_isa Isa)
+	{
+		switch(Isa)
+		{
+		case dispatch::isa_generic:
+			return &simd_dispatch_generic;
+#		if defined(GLM_DISPATCH_X86)
+		case dispatch::isa_sse2:
+			return cpu().SSE2 ? &simd_dispatch_sse2 : nullptr;
+		case dispatch::isa_sse4_1:
+			return cpu().SSE4_1 ? &simd_dispatch_sse4_1 : nullptr;
+		case dispatch::isa_avx2:
+			return cpu().AVX2 ? &simd_dispatch_avx2 : nullptr;
+		case dispatch::isa_avx512:
+			return cpu().AVX512 ? &simd_dispatch_avx512 : nullptr;
+#		endif
+		default:
+			return nullptr;
+		}
+	}
+
+	simd_dispatch_table const* best_table()
+	{
+		dispatch::simd_isa const Order[] = {dispatch::isa_avx512, dispatch::isa_avx2, dispatch::isa_sse4_1, dispatch::isa_sse2};
+		for(dispatch::simd_isa Isa : Order)
+			if(simd_dispatch_table const* Table = find_table(Isa))
+				return Table;
+		return &simd_dispatch_generic;
+	}
+
+	std::atomic<simd_dispatch_table const*>& active_table()
+	{
+		static std::atomic<simd_dispatch_table const*> Table(best_table());
+		return Table;
+	}
+
+	simd_dispatch_table const& table()
+	{
+		return *active_table().load(std::memory_order_relaxed);
+	}
+}//namespace
+}//namespace detail
+
+namespace dispatch
+{
+	simd_isa active_isa()
+	{
+		return static_cast<simd_isa>(detail::table().isa);
+	}
+
+	char const* isa_name(simd_isa isa)
+	{
+		switch(isa)
+		{
+		case isa_generic: return "generic";
+		case isa_sse2: return "sse2";
+		case isa_sse4_1: return "sse4.1";
+		case isa_avx2: return "avx2";
+		case isa_avx512: return "avx512";
+		default: return "unknown";
+		}
+	}
+
+	bool is_supported(simd_isa isa)
+	{
+		return detail::find_table(isa) != nullptr;
+	}
+
+	bool select_isa(simd_isa isa)
+	{
+		detail::simd_dispatch_table const* Table = detail::find_table(isa);
+		if(!Table)
+			return false;
+		detail::active_table().store(Table, std::memory_order_relaxed);
+		return true;
+	}
+
+	void sin(float const* in, float* out, std::size_t count)
+	{
+		detail::table().sin(in, out, count);
+	}
+
+	void cos(float const* in, float* out, std::size_t count)
+	{
+		detail::table().cos(in, out, count);
+	}
+
+	void sincos(float const* in, float* sin_out, float* cos_out, std::size_t count)
+	{
+		detail::table().sincos(in, sin_out, cos_out, count);
+	}
+
+	void tan(float const* in, float* out, std::size_t count)
+	{
+		detail::table().tan(in, out, count);
+	}
+
+	void asin(float const* in, float* out, std::size_t count)
+	{
+		detail::table().asin(in, out, count);
+	}
+
+	void acos(float const* in, float* out, std::size_t count)
+	{
+		detail::table().acos(in, out, count);
+	}
+
+	void atan(float const* in, float* out, std::size_t count)
+	{
+		detail::table().atan(in, out, count);
+	}
+
+	void exp(float const* in, float* out, std::size_t count)
+	{
+		detail::table().exp(in, out, count);
+	}
+
+	void log(float const* in, float* out, std::size_t count)
+	{
+		detail::table().log(in, out, count);
+	}
+
+	void transform(mat<4, 4, float, packed_highp> const& m, vec<4, float, packed_highp> const* in, vec<4, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().transform(reinterpret_cast<float const*>(&m), reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	void transformPoints(mat<4, 4, float, packed_highp> const& m, vec<3, float, packed_highp> const* in, vec<3, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().transformPoints(reinterpret_cast<float const*>(&m), reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	void transformDirections(mat<4, 4, float, packed_highp> const& m, vec<3, float, packed_highp> const* in, vec<3, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().transformDirections(reinterpret_cast<float const*>(&m), reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	void mul(mat<4, 4, float, packed_highp> const* a, mat<4, 4, float, packed_highp> const* b, mat<4, 4, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().mul(reinterpret_cast<float const*>(a), reinterpret_cast<float const*>(b), reinterpret_cast<float*>(out), count);
+	}
+
+	void inverse(mat<4, 4, float, packed_highp> const* in, mat<4, 4, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().inverse(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	void transpose(mat<4, 4, float, packed_highp> const* in, mat<4, 4, float, packed_highp>* out, std::size_t count)
+	{
+		detail::table().transpose(reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out), count);
+	}
+
+	void packHalf(float const* in, uint16* out, std::size_t count)
+	{
+		detail::table().packHalf(in, out, count);
+	}
+
+	void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	{
+		detail::table().unpackHalf(in, out, count);
+	}
+}//namespace dispatch
+}//namespace glm
@@ -0,0 +1,53 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch.hpp
+///
+/// Function table shared by the per instruction set variants of the compiled
+/// library (simd_dispatch_*.cpp) and the run time selection (simd_dispatch.cpp).
+///
+/// The variants compile GLM in a namespace of their own, so the table only
+/// uses plain arrays: mat4 as 16 floats, vec4 as 4 and vec3 as 3, packed, and
+/// half floats as std::uint16_t.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace glm{
+namespace detail
+{
+	struct simd_dispatch_table
+	{
+		int isa; // dispatch::simd_isa
+
+		void (*sin)(float const*, float*, std::size_t);
+		void (*cos)(float const*, float*, std::size_t);
+		void (*sincos)(float const*, float*, float*, std::size_t);
+		void (*tan)(float const*, float*, std::size_t);
+		void (*asin)(float const*, float*, std::size_t);
+		void (*acos)(float const*, float*, std::size_t);
+		void (*atan)(float const*, float*, std::size_t);
+		void (*exp)(float const*, float*, std::size_t);
+		void (*log)(float const*, float*, std::size_t);
+
+		void (*transform)(float const* m, float const* in, float* out, std::size_t);
+		void (*transformPoints)(float const* m, float const* in, float* out, std::size_t);
+		void (*transformDirections)(float const* m, float const* in, float* out, std::size_t);
+
+		void (*mul)(float const* a, float const* b, float* out, std::size_t);
+		void (*inverse)(float const* in, float* out, std::size_t);
+		void (*transpose)(float const* in, float* out, std::size_t);
+
+		void (*packHalf)(float const* in, std::uint16_t* out, std::size_t);
+		void (*unpackHalf)(std::uint16_t const* in, float* out, std::size_t);
+	};
+
+	extern simd_dispatch_table const simd_dispatch_generic;
+#	if defined(GLM_DISPATCH_X86)
+	extern simd_dispatch_table const simd_dispatch_sse2;
+	extern simd_dispatch_table const simd_dispatch_sse4_1;
+	extern simd_dispatch_table const simd_dispatch_avx2;
+	extern simd_dispatch_table const simd_dispatch_avx512;
+#	endif
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,13 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch_avx2.cpp
+///
+/// AVX2, FMA and F16C kernel variant, built with the matching code generation flags (see glm/CMakeLists.txt)
+
+#if defined(GLM_DISPATCH_X86)
+#	include "simd_dispatch_force.inl"
+#	define GLM_FORCE_AVX2
+#	define GLM_DISPATCH_NAMESPACE glm_dispatch_avx2
+#	define GLM_DISPATCH_TABLE simd_dispatch_avx2
+#	define GLM_DISPATCH_ISA isa_avx2
+#	include "simd_dispatch_table.inl"
+#endif//GLM_DISPATCH_X86
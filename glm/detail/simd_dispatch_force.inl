@@ -0,0 +1,22 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch_force.inl
+///
+/// Drops the instruction set the build forces (GLM_ENABLE_SIMD_* passes
+/// GLM_FORCE_INTRINSICS, users may pass a GLM_FORCE_<isa>) so that the
+/// GLM_FORCE_<isa> defined next by a kernel variant is the one selected, and
+/// glm/simd/platform.h does not redefine GLM_FORCE_INTRINSICS.
+
+#undef GLM_FORCE_PURE
+#undef GLM_FORCE_ARCH_UNKNOWN
+#undef GLM_FORCE_INTRINSICS
+#undef GLM_FORCE_CLANG
+#undef GLM_FORCE_NEON
+#undef GLM_FORCE_AVX512
+#undef GLM_FORCE_AVX2
+#undef GLM_FORCE_AVX
+#undef GLM_FORCE_SSE42
+#undef GLM_FORCE_SSE41
+#undef GLM_FORCE_SSSE3
+#undef GLM_FORCE_SSE3
+#undef GLM_FORCE_SSE2
+#undef GLM_FORCE_SSE
@@ -0,0 +1,9 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch_generic.cpp
+///
+/// Kernel variant compiled with the library build flags only
+
+#define GLM_DISPATCH_NAMESPACE glm_dispatch_generic
+#define GLM_DISPATCH_TABLE simd_dispatch_generic
+#define GLM_DISPATCH_ISA isa_generic
+#include "simd_dispatch_table.inl"
@@ -0,0 +1,142 @@
+/// @ref core
+/// @file glm/detail/simd_dispatch_table.inl
+///
+/// Body of one kernel variant. Each simd_dispatch_*.cpp includes
+/// simd_dispatch_force.inl and defines GLM_FORCE_<isa>,
+/// GLM_DISPATCH_NAMESPACE, GLM_DISPATCH_TABLE and GLM_DISPATCH_ISA (a
+/// dispatch::simd_isa enumerator), then includes this file; the build compiles
+/// it with the matching code generation flags.
+///
+/// GLM is compiled in GLM_DISPATCH_NAMESPACE rather than glm, and forced
+/// inline, so no out-of-line copy built for one instruction set can be picked
+/// by the linker for another variant or for the rest of the library.
+
+#include "simd_dispatch.hpp"
+
+#define GLM_FORCE_INLINE
+#define glm GLM_DISPATCH_NAMESPACE
+#include "../ext/simd_dispatch.hpp"
+#include "../ext/scalar_transcendental_batch.hpp"
+#include "../ext/matrix_transform_batch.hpp"
+#include "../gtc/packing.hpp"
+#include "../matrix.hpp"
+
+namespace glm{
+namespace
+{
+	typedef mat<4, 4, float, packed_highp> dispatch_mat4;
+	typedef vec<4, float, packed_highp> dispatch_vec4;
+	typedef vec<3, float, packed_highp> dispatch_vec3;
+
+	// mat4 operators only take the SIMD paths on aligned types
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	typedef mat<4, 4, float, aligned_highp> dispatch_simd_mat4;
+#	else
+	typedef mat<4, 4, float, packed_highp> dispatch_simd_mat4;
+#	endif
+
+	void dispatch_sin(float const* in, float* out, std::size_t count) { batch::sin(in, out, count); }
+	void dispatch_cos(float const* in, float* out, std::size_t count) { batch::cos(in, out, count); }
+	void dispatch_sincos(float const* in, float* sin_out, float* cos_out, std::size_t count) { batch::sincos(in, sin_out, cos_out, count); }
+	void dispatch_tan(float const* in, float* out, std::size_t count) { batch::tan(in, out, count); }
+	void dispatch_asin(float const* in, float* out, std::size_t count) { batch::asin(in, out, count); }
+	void dispatch_acos(float const* in, float* out, std::size_t count) { batch::acos(in, out, count); }
+	void dispatch_atan(float const* in, float* out, std::size_t count) { batch::atan(in, out, count); }
+	void dispatch_exp(float const* in, float* out, std::size_t count) { batch::exp(in, out, count); }
+	void dispatch_log(float const* in, float* out, std::size_t count) { batch::log(in, out, count); }
+
+	void dispatch_transform(float const* m, float const* in, float* out, std::size_t count)
+	{
+		batch::transform(*reinterpret_cast<dispatch_mat4 const*>(m), reinterpret_cast<dispatch_vec4 const*>(in), reinterpret_cast<dispatch_vec4*>(out), count);
+	}
+
+	void dispatch_transformPoints(float const* m, float const* in, float* out, std::size_t count)
+	{
+		batch::transformPoints(*reinterpret_cast<dispatch_mat4 const*>(m), reinterpret_cast<dispatch_vec3 const*>(in), reinterpret_cast<dispatch_vec3*>(out), count);
+	}
+
+	void dispatch_transformDirections(float const* m, float const* in, float* out, std::size_t count)
+	{
+		batch::transformDirections(*reinterpret_cast<dispatch_mat4 const*>(m), reinterpret_cast<dispatch_vec3 const*>(in), reinterpret_cast<dispatch_vec3*>(out), count);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	// Whole matrices straight from the packed arrays: going through the column
+	// copies of aligned_mat4 defeats store forwarding into the 64 byte loads
+	void dispatch_mul(float const* a, float const* b, float* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			_mm512_storeu_ps(out + i * 16, glm_mat4_mul_x16(_mm512_loadu_ps(a + i * 16), _mm512_loadu_ps(b + i * 16)));
+	}
+
+	void dispatch_inverse(float const* in, float* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			_mm512_storeu_ps(out + i * 16, glm_mat4_inverse_x16(_mm512_loadu_ps(in + i * 16)));
+	}
+
+	void dispatch_transpose(float const* in, float* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			_mm512_storeu_ps(out + i * 16, glm_mat4_transpose_x16(_mm512_loadu_ps(in + i * 16)));
+	}
+#	else
+	void dispatch_mul(float const* a, float const* b, float* out, std::size_t count)
+	{
+		dispatch_mat4 const* A = reinterpret_cast<dispatch_mat4 const*>(a);
+		dispatch_mat4 const* B = reinterpret_cast<dispatch_mat4 const*>(b);
+		dispatch_mat4* Out = reinterpret_cast<dispatch_mat4*>(out);
+		for(std::size_t i = 0; i < count; ++i)
+			Out[i] = dispatch_mat4(dispatch_simd_mat4(A[i]) * dispatch_simd_mat4(B[i]));
+	}
+
+	void dispatch_inverse(float const* in, float* out, std::size_t count)
+	{
+		dispatch_mat4 const* In = reinterpret_cast<dispatch_mat4 const*>(in);
+		dispatch_mat4* Out = reinterpret_cast<dispatch_mat4*>(out);
+		for(std::size_t i = 0; i < count; ++i)
+			Out[i] = dispatch_mat4(inverse(dispatch_simd_mat4(In[i])));
+	}
+
+	void dispatch_transpose(float const* in, float* out, std::size_t count)
+	{
+		dispatch_mat4 const* In = reinterpret_cast<dispatch_mat4 const*>(in);
+		dispatch_mat4* Out = reinterpret_cast<dispatch_mat4*>(out);
+		for(std::size_t i = 0; i < count; ++i)
+			Out[i] = dispatch_mat4(transpose(dispatch_simd_mat4(In[i])));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+	void dispatch_packHalf(float const* in, std::uint16_t* out, std::size_t count) { packHalf(in, out, count); }
+	void dispatch_unpackHalf(std::uint16_t const* in, float* out, std::size_t count) { unpackHalf(in, out, count); }
+}//namespace
+}//namespace glm
+
+#undef glm
+
+namespace glm{
+namespace detail
+{
+	simd_dispatch_table const GLM_DISPATCH_TABLE =
+	{
+		GLM_DISPATCH_NAMESPACE::dispatch::GLM_DISPATCH_ISA,
+		GLM_DISPATCH_NAMESPACE::dispatch_sin,
+		GLM_DISPATCH_NAMESPACE::dispatch_cos,
+		GLM_DISPATCH_NAMESPACE::dispatch_sincos,
+		GLM_DISPATCH_NAMESPACE::dispatch_tan,
+		GLM_DISPATCH_NAMESPACE::dispatch_asin,
+		GLM_DISPATCH_NAMESPACE::dispatch_acos,
+		GLM_DISPATCH_NAMESPACE::dispatch_atan,
+		GLM_DISPATCH_NAMESPACE::dispatch_exp,
+		GLM_DISPATCH_NAMESPACE::dispatch_log,
+		GLM_DISPATCH_NAMESPACE::dispatch_transform,
+		GLM_DISPATCH_NAMESPACE::dispatch_transformPoints,
+		GLM_DISPATCH_NAMESPACE::dispatch_transformDirections,
+		GLM_DISPATCH_NAMESPACE::dispatch_mul,
+		GLM_DISPATCH_NAMESPACE::dispatch_inverse,
+		GLM_DISPATCH_NAMESPACE::dispatch_transpose,
+		GLM_DISPATCH_NAMESPACE::dispatch_packHalf,
+		GLM_DISPATCH_NAMESPACE::dispatch_unpackHalf
+	};
+}//namespace detail
+}//namespace glm
@@ -1,18 +1,28 @@
 /// @ref core
 /// @file glm/detail/simd_transcendental.h
 ///
-/// Shared 4-wide SIMD exp/log primitives used by both func_exponential_simd.inl
-/// (exp/log/exp2/log2) and func_trigonometric_simd.inl (hyperbolics). Kept in one
-/// header so the definitions exist regardless of the exponential-vs-trigonometric
-/// include order. Accuracy ~1-2e-7 relative; used only for aligned mediump/lowp.
+/// Shared SIMD exp/log/sincos/atan/asin primitives used by func_exponential_simd.inl
+/// (exp/log/exp2/log2), func_trigonometric_simd.inl (trig, inverse trig, hyperbolics)
+/// and the glm::batch float-array entry points. Kept in one header so the definitions
+/// exist regardless of include order. 4-wide __m128 kernels, plus 8-wide __m256
+/// counterparts (same reductions and polynomials, same accuracy) when AVX2 is enabled.
+/// Accuracy ~1-2e-7 relative for exp/log, with or without FMA; used only for aligned
+/// mediump/lowp. Per-kernel figures below are measured by test/perf/perf_simd_ulp.cpp.
 
 #pragma once
 
 #include "../simd/platform.h"
 
-// Requires FMA (used throughout the reductions/polynomials). Without it, callers
-// fall back to their libm/scalar primaries (e.g. x86-64-v2 builds).
-#if ((GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_CLANG_BIT)) && defined(__FMA__)
+// Requires SSE4.1 (round/blendv). FMA is used when available; without it the
+// helpers below fall back to separate mul + add/sub and the trig reduction uses a
+// 4-part pi/2 split so k*part stays exact (e.g. x86-64-v2 builds).
+#if ((GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_CLANG_BIT)) && ((GLM_ARCH & GLM_ARCH_SSE41_BIT) || defined(__SSE4_1__))
+#	define GLM_SIMD_TRANSCENDENTAL GLM_ENABLE
+#else
+#	define GLM_SIMD_TRANSCENDENTAL GLM_DISABLE
+#endif
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
 
 #if defined(_M_ARM64) || defined(__aarch64__)
 #	include <arm_neon.h>
@@ -25,6 +35,15 @@
 namespace glm{
 namespace detail
 {
+	GLM_FUNC_QUALIFIER __m128 glm_explog_fmadd(__m128 a, __m128 b, __m128 c)
+	{
+#	if defined(__FMA__)
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+	}
+
 	GLM_FUNC_QUALIFIER __m128 glm_explog_fnmadd(__m128 a, __m128 b, __m128 c)
 	{
 #	if defined(__FMA__)
@@ -34,7 +53,7 @@ namespace detail
 #	endif
 	}
 
-	// e^x = 2^k * e^r, k = round(x/ln2), r in [-ln2/2, ln2/2]
+	// e^x = 2^k * e^r, k = round(x/ln2), r in [-ln2/2, ln2/2] (<= 3 ULP)
 	GLM_FUNC_QUALIFIER __m128 glm_exp_ps(__m128 x)
 	{
 		x = _mm_min_ps(_mm_set1_ps(88.3762626f), x);
@@ -44,12 +63,12 @@ namespace detail
 		__m128 r = glm_explog_fnmadd(k, _mm_set1_ps(0.693359375f), x);
 		r = glm_explog_fnmadd(k, _mm_set1_ps(-2.12194440e-4f), r);
 		__m128 p = _mm_set1_ps(1.f/720.f);
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/120.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/24.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/6.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/2.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/120.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/24.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/6.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/2.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f));
 		__m128i pow2 = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(k), _mm_set1_epi32(127)), 23);
 		return _mm_mul_ps(p, _mm_castsi128_ps(pow2));
 	}
@@ -66,22 +85,23 @@ namespace detail
 		__m128 f = _mm_sub_ps(m, _mm_set1_ps(1.f));
 		__m128 z = _mm_mul_ps(f, f);
 		__m128 p = _mm_set1_ps(7.0376836292E-2f);
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps(-1.1514610310E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps( 1.1676998740E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps(-1.2420140846E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps( 1.4249322787E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps(-1.6668057665E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps( 2.0000714765E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps(-2.4999993993E-1f));
-		p = _mm_fmadd_ps(p, f, _mm_set1_ps( 3.3333331174E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps(-1.1514610310E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps( 1.1676998740E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps(-1.2420140846E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps( 1.4249322787E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps(-1.6668057665E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps( 2.0000714765E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps(-2.4999993993E-1f));
+		p = glm_explog_fmadd(p, f, _mm_set1_ps( 3.3333331174E-1f));
 		p = _mm_mul_ps(_mm_mul_ps(p, f), z);
-		p = _mm_fmadd_ps(e, _mm_set1_ps(-2.12194440e-4f), p);
-		p = _mm_fnmadd_ps(_mm_set1_ps(0.5f), z, p);
+		p = glm_explog_fmadd(e, _mm_set1_ps(-2.12194440e-4f), p);
+		p = glm_explog_fnmadd(_mm_set1_ps(0.5f), z, p);
 		__m128 res = _mm_add_ps(f, p);
-		return _mm_fmadd_ps(e, _mm_set1_ps(0.693359375f), res);
+		return glm_explog_fmadd(e, _mm_set1_ps(0.693359375f), res);
 	}
 
 	// e^x - 1, accurate near 0: (2^k - 1) + 2^k*(e^r - 1)
+	// (<= 8 ULP, from the cancellation at k = +-1 just past |x| = ln2/2)
 	GLM_FUNC_QUALIFIER __m128 glm_expm1_ps(__m128 x)
 	{
 		x = _mm_min_ps(_mm_set1_ps(88.3762626f), x);
@@ -91,17 +111,17 @@ namespace detail
 		__m128 r = glm_explog_fnmadd(k, _mm_set1_ps(0.693359375f), x);
 		r = glm_explog_fnmadd(k, _mm_set1_ps(-2.12194440e-4f), r);
 		__m128 p = _mm_set1_ps(1.f/720.f);
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/120.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/24.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/6.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f/2.f));
-		p = _mm_fmadd_ps(p, r, _mm_set1_ps(1.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/120.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/24.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/6.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f/2.f));
+		p = glm_explog_fmadd(p, r, _mm_set1_ps(1.f));
 		__m128 er_m1 = _mm_mul_ps(r, p);   // e^r - 1
 		__m128 twok = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(k), _mm_set1_epi32(127)), 23));
 		return _mm_add_ps(_mm_sub_ps(twok, _mm_set1_ps(1.f)), _mm_mul_ps(twok, er_m1));
 	}
 
-	// ln(1+x), Kahan-corrected: ln(u) * x/(u-1), u = 1+x (falls back to x when u==1)
+	// ln(1+x), Kahan-corrected: ln(u) * x/(u-1), u = 1+x (falls back to x when u==1; <= 2 ULP)
 	GLM_FUNC_QUALIFIER __m128 glm_log1p_ps(__m128 x)
 	{
 		__m128 u = _mm_add_ps(_mm_set1_ps(1.f), x);
@@ -110,7 +130,270 @@ namespace detail
 		return _mm_blendv_ps(r, x, _mm_cmpeq_ps(u, _mm_set1_ps(1.f)));
 	}
 
+	GLM_FUNC_QUALIFIER __m128 glm_trig_fmadd(__m128 a, __m128 b, __m128 c)
+	{
+#	if defined(__FMA__)
+		return _mm_fmadd_ps(a, b, c);
+#	else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_trig_fnmadd(__m128 a, __m128 b, __m128 c)
+	{
+#	if defined(__FMA__)
+		return _mm_fnmadd_ps(a, b, c);           // c - a*b, fused (exact product)
+#	else
+		return _mm_sub_ps(c, _mm_mul_ps(a, b));  // fallback (x86-64-v2, no FMA)
+#	endif
+	}
+
+	// 4-wide sin & cos. Range reduction by pi/2 (Cody-Waite; 3 parts fused, 4 parts unfused).
+	GLM_FUNC_QUALIFIER void glm_sincos_ps(__m128 x, __m128& sin_out, __m128& cos_out)
+	{
+		const __m128 TWO_OVER_PI = _mm_set1_ps(0.636619772f);
+		__m128 fk = _mm_round_ps(_mm_mul_ps(x, TWO_OVER_PI),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#	if defined(__FMA__)
+		const __m128 PIO2_A = _mm_set1_ps(1.5707855225e+00f); // pi/2 split into 3 parts
+		const __m128 PIO2_B = _mm_set1_ps(1.0804334124e-05f); //   so k*part stays exact
+		const __m128 PIO2_C = _mm_set1_ps(2.1489973390e-11f);
+
+		__m128 r = glm_trig_fnmadd(fk, PIO2_A, x);   // r = x - fk*(pi/2), remainder in [-pi/4, pi/4]
+		r = glm_trig_fnmadd(fk, PIO2_B, r);
+		r = glm_trig_fnmadd(fk, PIO2_C, r);
+#	else
+		// Unfused: 4-bit parts keep k*part exact for |k| < 2^20 (|x| < ~1.6e6), then a full-precision tail
+		__m128 r = glm_trig_fnmadd(fk, _mm_set1_ps(1.5f), x);
+		r = glm_trig_fnmadd(fk, _mm_set1_ps(7.0312500000e-02f), r);
+		r = glm_trig_fnmadd(fk, _mm_set1_ps(4.5776367188e-04f), r);
+		r = glm_trig_fnmadd(fk, _mm_set1_ps(2.6063122277e-05f), r);
+#	endif
+
+		__m128 r2 = _mm_mul_ps(r, r);
+		// sin(r) ~ r*(1 - r2/6 + r2^2/120 - r2^3/5040)   on [-pi/4, pi/4]
+		__m128 S = _mm_mul_ps(r, _mm_add_ps(_mm_set1_ps(1.f), _mm_mul_ps(r2,
+			_mm_add_ps(_mm_set1_ps(-1.f/6.f), _mm_mul_ps(r2,
+			_mm_add_ps(_mm_set1_ps(1.f/120.f), _mm_mul_ps(r2, _mm_set1_ps(-1.f/5040.f))))))));
+		// cos(r) ~ 1 - r2/2 + r2^2/24 - r2^3/720
+		__m128 C = _mm_add_ps(_mm_set1_ps(1.f), _mm_mul_ps(r2,
+			_mm_add_ps(_mm_set1_ps(-1.f/2.f), _mm_mul_ps(r2,
+			_mm_add_ps(_mm_set1_ps(1.f/24.f), _mm_mul_ps(r2, _mm_set1_ps(-1.f/720.f)))))));
+
+		__m128i k = _mm_cvtps_epi32(fk);
+		// quadrant: swap sin/cos when k is odd
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 sinP = _mm_or_ps(_mm_and_ps(swap, C), _mm_andnot_ps(swap, S));
+		__m128 cosP = _mm_or_ps(_mm_and_ps(swap, S), _mm_andnot_ps(swap, C));
+		// sign: sin negates when (k&2); cos negates when ((k+1)&2)
+		__m128 sinsign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30));
+		__m128 cossign = _mm_castsi128_ps(_mm_slli_epi32(
+			_mm_and_si128(_mm_add_epi32(k, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+		sin_out = _mm_xor_ps(sinP, sinsign);
+		cos_out = _mm_xor_ps(cosP, cossign);
+	}
+
+	// 4-wide atan: reduce |x|>1 via pi/2 - atan(1/x); degree-13 minimax on [-1,1].
+	// The fit bounds absolute error (~1.8e-6); relative error reaches ~2e-5 near 0.
+	GLM_FUNC_QUALIFIER __m128 glm_atan_ps(__m128 x)
+	{
+		__m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+		__m128 ax = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+		__m128 gt1 = _mm_cmpgt_ps(ax, _mm_set1_ps(1.0f));
+		__m128 z = _mm_blendv_ps(ax, _mm_div_ps(_mm_set1_ps(1.0f), ax), gt1); // reduce to [0,1]
+		__m128 z2 = _mm_mul_ps(z, z);
+		__m128 p = _mm_set1_ps(-0.01172120f);
+		p = glm_trig_fmadd(p, z2, _mm_set1_ps(0.05265332f));
+		p = glm_trig_fmadd(p, z2, _mm_set1_ps(-0.11643287f));
+		p = glm_trig_fmadd(p, z2, _mm_set1_ps(0.19354346f));
+		p = glm_trig_fmadd(p, z2, _mm_set1_ps(-0.33262347f));
+		p = glm_trig_fmadd(p, z2, _mm_set1_ps(0.99997726f));
+		p = _mm_mul_ps(p, z);                          // atan(z)
+		__m128 r = _mm_blendv_ps(p, _mm_sub_ps(_mm_set1_ps(1.57079632679f), p), gt1);
+		return _mm_or_ps(r, sign);
+	}
+
+	// 4-wide asin, Cephes asinf: sqrt reduction for |x|>0.5 keeps accuracy near +-1 (<= 2 ULP)
+	GLM_FUNC_QUALIFIER __m128 glm_asin_ps(__m128 x)
+	{
+		__m128 sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+		__m128 av = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+		__m128 big = _mm_cmpgt_ps(av, _mm_set1_ps(0.5f));
+		__m128 zbig = _mm_mul_ps(_mm_set1_ps(0.5f), _mm_sub_ps(_mm_set1_ps(1.0f), av));
+		__m128 z = _mm_blendv_ps(_mm_mul_ps(av, av), zbig, big);
+		__m128 xx = _mm_blendv_ps(av, _mm_sqrt_ps(zbig), big);
+		__m128 p = _mm_set1_ps(4.2163199048E-2f);
+		p = glm_trig_fmadd(p, z, _mm_set1_ps(2.4181311049E-2f));
+		p = glm_trig_fmadd(p, z, _mm_set1_ps(4.5470025998E-2f));
+		p = glm_trig_fmadd(p, z, _mm_set1_ps(7.4953002686E-2f));
+		p = glm_trig_fmadd(p, z, _mm_set1_ps(1.6666752422E-1f));
+		__m128 r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), xx), xx);
+		r = _mm_blendv_ps(r, _mm_sub_ps(_mm_set1_ps(1.57079632679f), _mm_add_ps(r, r)), big);
+		return _mm_or_ps(r, sign);
+	}
+
+	// pi/2 - asin(x): ~3e-7 absolute, relative error grows as x -> 1
+	GLM_FUNC_QUALIFIER __m128 glm_acos_ps(__m128 x)
+	{
+		return _mm_sub_ps(_mm_set1_ps(1.57079632679f), glm_asin_ps(x));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// --- 8-wide __m256 counterparts (AVX2 for the integer exponent/quadrant math) ---
+	// Same reductions, constants and polynomials as the 4-wide kernels above, so
+	// results are bit-identical lane for lane.
+
+	GLM_FUNC_QUALIFIER __m256 glm_explog_fmadd(__m256 a, __m256 b, __m256 c)
+	{
+#	if defined(__FMA__)
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_explog_fnmadd(__m256 a, __m256 b, __m256 c)
+	{
+#	if defined(__FMA__)
+		return _mm256_fnmadd_ps(a, b, c);
+#	else
+		return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_trig_fmadd(__m256 a, __m256 b, __m256 c)
+	{
+		return glm_explog_fmadd(a, b, c);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_trig_fnmadd(__m256 a, __m256 b, __m256 c)
+	{
+		return glm_explog_fnmadd(a, b, c);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_exp_ps256(__m256 x)
+	{
+		x = _mm256_min_ps(_mm256_set1_ps(88.3762626f), x);
+		x = _mm256_max_ps(_mm256_set1_ps(-87.3365478f), x);
+		__m256 k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m256 r = glm_explog_fnmadd(k, _mm256_set1_ps(0.693359375f), x);
+		r = glm_explog_fnmadd(k, _mm256_set1_ps(-2.12194440e-4f), r);
+		__m256 p = _mm256_set1_ps(1.f/720.f);
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f/120.f));
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f/24.f));
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f/6.f));
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f/2.f));
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f));
+		p = glm_explog_fmadd(p, r, _mm256_set1_ps(1.f));
+		__m256i pow2 = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(k), _mm256_set1_epi32(127)), 23);
+		return _mm256_mul_ps(p, _mm256_castsi256_ps(pow2));
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_log_ps256(__m256 x)
+	{
+		__m256i xi = _mm256_castps_si256(x);
+		__m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(xi, 23), _mm256_set1_epi32(127)));
+		__m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(xi, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+		__m256 gt = _mm256_cmp_ps(m, _mm256_set1_ps(1.41421356237f), _CMP_GT_OQ);
+		m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), gt);
+		e = _mm256_add_ps(e, _mm256_and_ps(gt, _mm256_set1_ps(1.f)));
+		__m256 f = _mm256_sub_ps(m, _mm256_set1_ps(1.f));
+		__m256 z = _mm256_mul_ps(f, f);
+		__m256 p = _mm256_set1_ps(7.0376836292E-2f);
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps(-1.1514610310E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps( 1.1676998740E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps(-1.2420140846E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps( 1.4249322787E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps(-1.6668057665E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps( 2.0000714765E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps(-2.4999993993E-1f));
+		p = glm_explog_fmadd(p, f, _mm256_set1_ps( 3.3333331174E-1f));
+		p = _mm256_mul_ps(_mm256_mul_ps(p, f), z);
+		p = glm_explog_fmadd(e, _mm256_set1_ps(-2.12194440e-4f), p);
+		p = glm_explog_fnmadd(_mm256_set1_ps(0.5f), z, p);
+		__m256 res = _mm256_add_ps(f, p);
+		return glm_explog_fmadd(e, _mm256_set1_ps(0.693359375f), res);
+	}
+
+	GLM_FUNC_QUALIFIER void glm_sincos_ps256(__m256 x, __m256& sin_out, __m256& cos_out)
+	{
+		const __m256 TWO_OVER_PI = _mm256_set1_ps(0.636619772f);
+		__m256 fk = _mm256_round_ps(_mm256_mul_ps(x, TWO_OVER_PI),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#	if defined(__FMA__)
+		__m256 r = glm_trig_fnmadd(fk, _mm256_set1_ps(1.5707855225e+00f), x);
+		r = glm_trig_fnmadd(fk, _mm256_set1_ps(1.0804334124e-05f), r);
+		r = glm_trig_fnmadd(fk, _mm256_set1_ps(2.1489973390e-11f), r);
+#	else
+		__m256 r = glm_trig_fnmadd(fk, _mm256_set1_ps(1.5f), x);
+		r = glm_trig_fnmadd(fk, _mm256_set1_ps(7.0312500000e-02f), r);
+		r = glm_trig_fnmadd(fk, _mm256_set1_ps(4.5776367188e-04f), r);
+		r = glm_trig_fnmadd(fk, _mm256_set1_ps(2.6063122277e-05f), r);
+#	endif
+
+		__m256 r2 = _mm256_mul_ps(r, r);
+		__m256 S = _mm256_mul_ps(r, _mm256_add_ps(_mm256_set1_ps(1.f), _mm256_mul_ps(r2,
+			_mm256_add_ps(_mm256_set1_ps(-1.f/6.f), _mm256_mul_ps(r2,
+			_mm256_add_ps(_mm256_set1_ps(1.f/120.f), _mm256_mul_ps(r2, _mm256_set1_ps(-1.f/5040.f))))))));
+		__m256 C = _mm256_add_ps(_mm256_set1_ps(1.f), _mm256_mul_ps(r2,
+			_mm256_add_ps(_mm256_set1_ps(-1.f/2.f), _mm256_mul_ps(r2,
+			_mm256_add_ps(_mm256_set1_ps(1.f/24.f), _mm256_mul_ps(r2, _mm256_set1_ps(-1.f/720.f)))))));
+
+		__m256i k = _mm256_cvtps_epi32(fk);
+		__m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(k, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+		__m256 sinP = _mm256_blendv_ps(S, C, swap);
+		__m256 cosP = _mm256_blendv_ps(C, S, swap);
+		__m256 sinsign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(k, _mm256_set1_epi32(2)), 30));
+		__m256 cossign = _mm256_castsi256_ps(_mm256_slli_epi32(
+			_mm256_and_si256(_mm256_add_epi32(k, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+		sin_out = _mm256_xor_ps(sinP, sinsign);
+		cos_out = _mm256_xor_ps(cosP, cossign);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_atan_ps256(__m256 x)
+	{
+		__m256 sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+		__m256 ax = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+		__m256 gt1 = _mm256_cmp_ps(ax, _mm256_set1_ps(1.0f), _CMP_GT_OQ);
+		__m256 z = _mm256_blendv_ps(ax, _mm256_div_ps(_mm256_set1_ps(1.0f), ax), gt1);
+		__m256 z2 = _mm256_mul_ps(z, z);
+		__m256 p = _mm256_set1_ps(-0.01172120f);
+		p = glm_trig_fmadd(p, z2, _mm256_set1_ps(0.05265332f));
+		p = glm_trig_fmadd(p, z2, _mm256_set1_ps(-0.11643287f));
+		p = glm_trig_fmadd(p, z2, _mm256_set1_ps(0.19354346f));
+		p = glm_trig_fmadd(p, z2, _mm256_set1_ps(-0.33262347f));
+		p = glm_trig_fmadd(p, z2, _mm256_set1_ps(0.99997726f));
+		p = _mm256_mul_ps(p, z);
+		__m256 r = _mm256_blendv_ps(p, _mm256_sub_ps(_mm256_set1_ps(1.57079632679f), p), gt1);
+		return _mm256_or_ps(r, sign);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_asin_ps256(__m256 x)
+	{
+		__m256 sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+		__m256 av = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+		__m256 big = _mm256_cmp_ps(av, _mm256_set1_ps(0.5f), _CMP_GT_OQ);
+		__m256 zbig = _mm256_mul_ps(_mm256_set1_ps(0.5f), _mm256_sub_ps(_mm256_set1_ps(1.0f), av));
+		__m256 z = _mm256_blendv_ps(_mm256_mul_ps(av, av), zbig, big);
+		__m256 xx = _mm256_blendv_ps(av, _mm256_sqrt_ps(zbig), big);
+		__m256 p = _mm256_set1_ps(4.2163199048E-2f);
+		p = glm_trig_fmadd(p, z, _mm256_set1_ps(2.4181311049E-2f));
+		p = glm_trig_fmadd(p, z, _mm256_set1_ps(4.5470025998E-2f));
+		p = glm_trig_fmadd(p, z, _mm256_set1_ps(7.4953002686E-2f));
+		p = glm_trig_fmadd(p, z, _mm256_set1_ps(1.6666752422E-1f));
+		__m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), xx), xx);
+		r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(1.57079632679f), _mm256_add_ps(r, r)), big);
+		return _mm256_or_ps(r, sign);
+	}
+
+	GLM_FUNC_QUALIFIER __m256 glm_acos_ps256(__m256 x)
+	{
+		return _mm256_sub_ps(_mm256_set1_ps(1.57079632679f), glm_asin_ps256(x));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 }//namespace detail
 }//namespace glm
 
-#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_CLANG_BIT)
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
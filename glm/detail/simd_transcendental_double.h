@@ -0,0 +1,631 @@
+/// @ref core
+/// @file glm/detail/simd_transcendental_double.h
+///
+/// Double precision SIMD sin/cos/tan/exp/log/pow/atan/atan2 for aligned dvec2/dvec3/dvec4
+/// (func_trigonometric_simd.inl, func_exponential_simd.inl). Each kernel is written
+/// once against glm_pd_ops_t<V> and instantiated for __m128d (SSE4.1) and, with AVX2,
+/// __m256d. The reductions and polynomials follow fdlibm (sin/cos/exp/log/atan
+/// minimax coefficients), so results stay within ~1-2 ULP of libm; pow carries
+/// log(x) as a double-double so large y*log(x) do not amplify the log error.
+/// Lanes outside the vector reduction range (huge trig arguments, pow/atan2
+/// special cases) fall back to the libm function for that lane.
+
+#pragma once
+
+#include "simd_transcendental.h"
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+
+#include "qualifier.hpp"
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	// Keyed on the lane count (an __m128d template argument would drop its
+	// alignment attribute); kernels reach it through glm_pd_ops_t<V>.
+	template<int Lanes>
+	struct glm_pd_ops{};
+
+	template<>
+	struct glm_pd_ops<2>
+	{
+		typedef __m128d type;
+		typedef __m128i itype;
+		static const int lanes = 2;
+
+		GLM_FUNC_QUALIFIER static __m128d set1(double s) { return _mm_set1_pd(s); }
+		GLM_FUNC_QUALIFIER static __m128d zero() { return _mm_setzero_pd(); }
+		GLM_FUNC_QUALIFIER static __m128d load(double const* p) { return _mm_loadu_pd(p); }
+		GLM_FUNC_QUALIFIER static void store(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+		GLM_FUNC_QUALIFIER static __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d sub(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d div(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d min(__m128d a, __m128d b) { return _mm_min_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d max(__m128d a, __m128d b) { return _mm_max_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d and_(__m128d a, __m128d b) { return _mm_and_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d andnot(__m128d a, __m128d b) { return _mm_andnot_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d or_(__m128d a, __m128d b) { return _mm_or_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d xor_(__m128d a, __m128d b) { return _mm_xor_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d blend(__m128d a, __m128d b, __m128d m) { return _mm_blendv_pd(a, b, m); }
+		GLM_FUNC_QUALIFIER static __m128d round(__m128d a) { return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static __m128d floor(__m128d a) { return _mm_round_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static __m128d lt(__m128d a, __m128d b) { return _mm_cmplt_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d gt(__m128d a, __m128d b) { return _mm_cmpgt_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d eq(__m128d a, __m128d b) { return _mm_cmpeq_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d nlt(__m128d a, __m128d b) { return _mm_cmpnlt_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m128d nge(__m128d a, __m128d b) { return _mm_cmpnge_pd(a, b); }
+		GLM_FUNC_QUALIFIER static int movemask(__m128d a) { return _mm_movemask_pd(a); }
+
+		GLM_FUNC_QUALIFIER static __m128d fmadd(__m128d a, __m128d b, __m128d c)
+		{
+#		if defined(__FMA__)
+			return _mm_fmadd_pd(a, b, c);
+#		else
+			return _mm_add_pd(_mm_mul_pd(a, b), c);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static __m128d fnmadd(__m128d a, __m128d b, __m128d c)
+		{
+#		if defined(__FMA__)
+			return _mm_fnmadd_pd(a, b, c);
+#		else
+			return _mm_sub_pd(c, _mm_mul_pd(a, b));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static __m128i cast_i(__m128d a) { return _mm_castpd_si128(a); }
+		GLM_FUNC_QUALIFIER static __m128d cast_d(__m128i a) { return _mm_castsi128_pd(a); }
+		GLM_FUNC_QUALIFIER static __m128i set1_i(long long s) { return _mm_set1_epi64x(s); }
+		GLM_FUNC_QUALIFIER static __m128i and_i(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+		GLM_FUNC_QUALIFIER static __m128i or_i(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+		GLM_FUNC_QUALIFIER static __m128i add_i(__m128i a, __m128i b) { return _mm_add_epi64(a, b); }
+		GLM_FUNC_QUALIFIER static __m128i eq_i(__m128i a, __m128i b) { return _mm_cmpeq_epi64(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static __m128i sll(__m128i a) { return _mm_slli_epi64(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static __m128i srl(__m128i a) { return _mm_srli_epi64(a, N); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<>
+	struct glm_pd_ops<4>
+	{
+		typedef __m256d type;
+		typedef __m256i itype;
+		static const int lanes = 4;
+
+		GLM_FUNC_QUALIFIER static __m256d set1(double s) { return _mm256_set1_pd(s); }
+		GLM_FUNC_QUALIFIER static __m256d zero() { return _mm256_setzero_pd(); }
+		GLM_FUNC_QUALIFIER static __m256d load(double const* p) { return _mm256_loadu_pd(p); }
+		GLM_FUNC_QUALIFIER static void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+		GLM_FUNC_QUALIFIER static __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d sub(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d div(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d min(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d max(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d and_(__m256d a, __m256d b) { return _mm256_and_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d andnot(__m256d a, __m256d b) { return _mm256_andnot_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d or_(__m256d a, __m256d b) { return _mm256_or_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d xor_(__m256d a, __m256d b) { return _mm256_xor_pd(a, b); }
+		GLM_FUNC_QUALIFIER static __m256d blend(__m256d a, __m256d b, __m256d m) { return _mm256_blendv_pd(a, b, m); }
+		GLM_FUNC_QUALIFIER static __m256d round(__m256d a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static __m256d floor(__m256d a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+		GLM_FUNC_QUALIFIER static __m256d lt(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static __m256d gt(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static __m256d eq(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+		GLM_FUNC_QUALIFIER static __m256d nlt(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_NLT_UQ); }
+		GLM_FUNC_QUALIFIER static __m256d nge(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_NGE_UQ); }
+		GLM_FUNC_QUALIFIER static int movemask(__m256d a) { return _mm256_movemask_pd(a); }
+
+		GLM_FUNC_QUALIFIER static __m256d fmadd(__m256d a, __m256d b, __m256d c)
+		{
+#		if defined(__FMA__)
+			return _mm256_fmadd_pd(a, b, c);
+#		else
+			return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static __m256d fnmadd(__m256d a, __m256d b, __m256d c)
+		{
+#		if defined(__FMA__)
+			return _mm256_fnmadd_pd(a, b, c);
+#		else
+			return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+#		endif
+		}
+
+		GLM_FUNC_QUALIFIER static __m256i cast_i(__m256d a) { return _mm256_castpd_si256(a); }
+		GLM_FUNC_QUALIFIER static __m256d cast_d(__m256i a) { return _mm256_castsi256_pd(a); }
+		GLM_FUNC_QUALIFIER static __m256i set1_i(long long s) { return _mm256_set1_epi64x(s); }
+		GLM_FUNC_QUALIFIER static __m256i and_i(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+		GLM_FUNC_QUALIFIER static __m256i or_i(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+		GLM_FUNC_QUALIFIER static __m256i add_i(__m256i a, __m256i b) { return _mm256_add_epi64(a, b); }
+		GLM_FUNC_QUALIFIER static __m256i eq_i(__m256i a, __m256i b) { return _mm256_cmpeq_epi64(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static __m256i sll(__m256i a) { return _mm256_slli_epi64(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static __m256i srl(__m256i a) { return _mm256_srli_epi64(a, N); }
+	};
+
+	glm_pd_ops<4> glm_pd_ops_of(__m256d);
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	glm_pd_ops<2> glm_pd_ops_of(__m128d);
+
+	template<typename V>
+	using glm_pd_ops_t = decltype(glm_pd_ops_of(V()));
+
+	// Exact a*b = p + e (FMA, or Dekker's split; |a|, |b| < 2^995)
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_two_prod_pd(V a, V b, V& e)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V const p = O::mul(a, b);
+#	if defined(__FMA__)
+		e = O::fmadd(a, b, O::sub(O::zero(), p));
+#	else
+		V const Split = O::set1(134217729.0); // 2^27 + 1
+		V const ca = O::mul(a, Split), cb = O::mul(b, Split);
+		V const ah = O::sub(ca, O::sub(ca, a)), bh = O::sub(cb, O::sub(cb, b));
+		V const al = O::sub(a, ah), bl = O::sub(b, bh);
+		e = O::add(O::add(O::add(O::sub(O::mul(ah, bh), p), O::mul(ah, bl)), O::mul(al, bh)), O::mul(al, bl));
+#	endif
+		return p;
+	}
+
+	// k as an integer in the low bits of each lane (|k| < 2^51)
+	template<typename V>
+	GLM_FUNC_QUALIFIER typename glm_pd_ops_t<V>::itype glm_int_bits_pd(V k)
+	{
+		typedef glm_pd_ops_t<V> O;
+		return O::cast_i(O::add(k, O::set1(6755399441055744.0))); // 1.5 * 2^52
+	}
+
+	// 2^k for integral k in [-1022, 1023]
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_pow2i_pd(V k)
+	{
+		typedef glm_pd_ops_t<V> O;
+		return O::cast_d(O::template sll<52>(O::cast_i(O::add(k, O::set1(4503599627371519.0))))); // 2^52 + 1023
+	}
+
+	// Per-lane libm fallback for the lanes set in Mask
+	template<typename V, typename F>
+	GLM_FUNC_QUALIFIER V glm_fixup_pd(V Result, int Mask, V x, F f)
+	{
+		typedef glm_pd_ops_t<V> O;
+		double In[4], Out[4];
+		O::store(In, x);
+		O::store(Out, Result);
+		for(int i = 0; i < O::lanes; ++i)
+			if(Mask & (1 << i))
+				Out[i] = f(In[i]);
+		return O::load(Out);
+	}
+
+	template<typename V, typename F>
+	GLM_FUNC_QUALIFIER V glm_fixup_pd(V Result, int Mask, V x, V y, F f)
+	{
+		typedef glm_pd_ops_t<V> O;
+		double InX[4], InY[4], Out[4];
+		O::store(InX, x);
+		O::store(InY, y);
+		O::store(Out, Result);
+		for(int i = 0; i < O::lanes; ++i)
+			if(Mask & (1 << i))
+				Out[i] = f(InX[i], InY[i]);
+		return O::load(Out);
+	}
+
+	// --- sin / cos / tan ---
+
+	// r = x - k*pi/2 with pi/2 split into 33 + 33 + 33 + 53 bits (fdlibm), so k*part
+	// is exact for |k| < 2^20. Lanes with |x| >= 2^19 use libm.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_rem_pio2_pd(V x, V& k)
+	{
+		typedef glm_pd_ops_t<V> O;
+		k = O::round(O::mul(x, O::set1(6.36619772367581382433e-01)));
+		V r = O::fnmadd(k, O::set1(1.57079632673412561417e+00), x);
+		r = O::fnmadd(k, O::set1(6.07710050630396597660e-11), r);
+		r = O::fnmadd(k, O::set1(2.02226624871116645580e-21), r);
+		r = O::fnmadd(k, O::set1(8.47842766036889956997e-32), r);
+		return O::blend(r, x, O::eq(k, O::zero())); // keeps sin(-0) = -0
+	}
+
+	// fdlibm __kernel_sin / __kernel_cos on [-pi/4, pi/4], z = r*r. lo receives
+	// the rounding error of the final sum (only tan uses it).
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_sin_kernel_pd(V r, V z, V& lo)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V p = O::set1(1.58969099521155010221e-10);
+		p = O::fmadd(p, z, O::set1(-2.50507602534068634195e-08));
+		p = O::fmadd(p, z, O::set1(2.75573137070700676789e-06));
+		p = O::fmadd(p, z, O::set1(-1.98412698298579493134e-04));
+		p = O::fmadd(p, z, O::set1(8.33333333332248946124e-03));
+		p = O::fmadd(p, z, O::set1(-1.66666666666666324348e-01));
+		V const rz = O::mul(r, z);
+		V const Sum = O::fmadd(rz, p, r);
+		lo = O::fmadd(rz, p, O::sub(r, Sum));
+		return Sum;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_cos_kernel_pd(V z, V& lo)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V p = O::set1(-1.13596475577881948265e-11);
+		p = O::fmadd(p, z, O::set1(2.08757232129817482790e-09));
+		p = O::fmadd(p, z, O::set1(-2.75573143513906633035e-07));
+		p = O::fmadd(p, z, O::set1(2.48015872894767294178e-05));
+		p = O::fmadd(p, z, O::set1(-1.38888888888741095749e-03));
+		p = O::fmadd(p, z, O::set1(4.16666666666666019037e-02));
+		V const one = O::set1(1.0);
+		V const hz = O::mul(z, O::set1(0.5));
+		V const w = O::sub(one, hz);
+		V const Tail = O::fmadd(O::mul(z, z), p, O::sub(O::sub(one, w), hz));
+		V const Sum = O::add(w, Tail);
+		lo = O::add(O::sub(w, Sum), Tail);
+		return Sum;
+	}
+
+	// Mode: 0 = sin, 1 = cos, 2 = tan
+	template<int Mode, typename V>
+	GLM_FUNC_QUALIFIER V glm_trig_pd(V x)
+	{
+		typedef glm_pd_ops_t<V> O;
+		typedef typename O::itype I;
+
+		V k;
+		V const r = glm_rem_pio2_pd(x, k);
+		V const z = O::mul(r, r);
+		V Slo, Clo;
+		V const S = glm_sin_kernel_pd(r, z, Slo);
+		V const C = glm_cos_kernel_pd(z, Clo);
+
+		I const q = glm_int_bits_pd(k);
+		V const odd = O::cast_d(O::eq_i(O::and_i(q, O::set1_i(1)), O::set1_i(1)));
+
+		V Result;
+		if(Mode == 2)
+		{
+			// tan = S/C on even quadrants, -C/S on odd ones. One correction step with
+			// the low parts of S and C keeps the quotient near 1 ULP.
+			V const Num = O::blend(S, C, odd), NumLo = O::blend(Slo, Clo, odd);
+			V const Den = O::blend(C, S, odd), DenLo = O::blend(Clo, Slo, odd);
+			V const Quot = O::div(Num, Den);
+#		if defined(__FMA__)
+			V const Residual = O::fnmadd(Quot, Den, Num); // exact
+#		else
+			V pe;
+			V const p = glm_two_prod_pd(Quot, Den, pe);
+			V const Residual = O::sub(O::sub(Num, p), pe);
+#		endif
+			Result = O::add(Quot, O::div(O::fnmadd(Quot, DenLo, O::add(Residual, NumLo)), Den));
+			Result = O::xor_(Result, O::and_(odd, O::set1(-0.0)));
+		}
+		else
+		{
+			I const quadrant = Mode == 0 ? q : O::add_i(q, O::set1_i(1));
+			V const sign = O::cast_d(O::template sll<62>(O::and_i(quadrant, O::set1_i(2))));
+			Result = Mode == 0 ? O::blend(S, C, odd) : O::blend(C, S, odd);
+			Result = O::xor_(Result, sign);
+		}
+
+		V const ax = O::andnot(O::set1(-0.0), x);
+		int const Large = O::movemask(O::nlt(ax, O::set1(524288.0))); // also inf / NaN
+		if(Large)
+		{
+			if(Mode == 0)
+				Result = glm_fixup_pd(Result, Large, x, [](double a) { return std::sin(a); });
+			else if(Mode == 1)
+				Result = glm_fixup_pd(Result, Large, x, [](double a) { return std::cos(a); });
+			else
+				Result = glm_fixup_pd(Result, Large, x, [](double a) { return std::tan(a); });
+		}
+		return Result;
+	}
+
+	// --- exp ---
+
+	// e^(x + xlo), |xlo| << ulp(x). x = k*ln2 + r with ln2 split 32 + 53 bits
+	// (exact k*hi), fdlibm's rational form for e^r, and 2^k applied in two
+	// halves so results reaching the subnormal range are rounded once.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_exp_pd(V x, V xlo)
+	{
+		typedef glm_pd_ops_t<V> O;
+		x = O::max(O::set1(-746.0), O::min(O::set1(710.0), x)); // NaN passes through
+		V const k = O::round(O::mul(x, O::set1(1.44269504088896338700e+00)));
+		V const hi = O::fnmadd(k, O::set1(6.93147180369123816490e-01), x);
+		V const lo = O::fmadd(k, O::set1(1.90821492927058770002e-10), O::sub(O::zero(), xlo));
+		V const r = O::sub(hi, lo);
+
+		V const z = O::mul(r, r);
+		V p = O::set1(4.13813679705723846039e-08);
+		p = O::fmadd(p, z, O::set1(-1.65339022054652515390e-06));
+		p = O::fmadd(p, z, O::set1(6.61375632143793436117e-05));
+		p = O::fmadd(p, z, O::set1(-2.77777777770155933842e-03));
+		p = O::fmadd(p, z, O::set1(1.66666666666666019037e-01));
+		V const c = O::fnmadd(z, p, r);
+		V const one = O::set1(1.0);
+		V const y = O::sub(one, O::sub(O::sub(lo, O::div(O::mul(r, c), O::sub(O::set1(2.0), c))), hi));
+
+		V const k1 = O::floor(O::mul(k, O::set1(0.5)));
+		V const k2 = O::sub(k, k1);
+		return O::mul(O::mul(y, glm_pow2i_pd(k1)), glm_pow2i_pd(k2));
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_exp_pd(V x)
+	{
+		return glm_exp_pd(x, glm_pd_ops_t<V>::zero());
+	}
+
+	// --- log ---
+
+	// x = 2^e * m with m in [sqrt(2)/2, sqrt(2)), for positive finite x (subnormals
+	// are prescaled by 2^54). Returns f = m - 1.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_log_split_pd(V x, V& e)
+	{
+		typedef glm_pd_ops_t<V> O;
+		typedef typename O::itype I;
+
+		V const tiny = O::lt(x, O::set1(2.2250738585072014e-308));
+		x = O::blend(x, O::mul(x, O::set1(18014398509481984.0)), tiny); // 2^54
+		I const bits = O::cast_i(x);
+
+		e = O::sub(O::cast_d(O::or_i(O::template srl<52>(bits), O::set1_i(0x4330000000000000LL))), O::set1(4503599627371519.0));
+		e = O::sub(e, O::and_(tiny, O::set1(54.0)));
+		V m = O::cast_d(O::or_i(O::and_i(bits, O::set1_i(0x000FFFFFFFFFFFFFLL)), O::set1_i(0x3FF0000000000000LL)));
+
+		V const gt = O::gt(m, O::set1(1.41421356237309504880));
+		m = O::blend(m, O::mul(m, O::set1(0.5)), gt);
+		e = O::add(e, O::and_(gt, O::set1(1.0)));
+		return O::sub(m, O::set1(1.0));
+	}
+
+	// log(0) = -inf, log(+inf) = +inf, log(x < 0) = log(NaN) = NaN
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_log_special_pd(V x, V r)
+	{
+		typedef glm_pd_ops_t<V> O;
+		r = O::blend(r, O::set1(-INFINITY), O::eq(x, O::zero()));
+		r = O::blend(r, O::set1(INFINITY), O::eq(x, O::set1(INFINITY)));
+		return O::or_(r, O::nge(x, O::zero()));
+	}
+
+	// fdlibm e_log.c
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_log_pd(V x)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V e;
+		V const f = glm_log_split_pd(x, e);
+		V const s = O::div(f, O::add(O::set1(2.0), f));
+		V const z = O::mul(s, s);
+		V const w = O::mul(z, z);
+		V t1 = O::fmadd(w, O::set1(1.531383769920937332e-01), O::set1(2.222219843214978396e-01));
+		t1 = O::mul(w, O::fmadd(w, t1, O::set1(3.999999999940941908e-01)));
+		V t2 = O::fmadd(w, O::set1(1.479819860511658591e-01), O::set1(1.818357216161805012e-01));
+		t2 = O::fmadd(w, t2, O::set1(2.857142874366239149e-01));
+		t2 = O::mul(z, O::fmadd(w, t2, O::set1(6.666666666666735130e-01)));
+		V const R = O::add(t2, t1);
+		V const hfsq = O::mul(O::set1(0.5), O::mul(f, f));
+		V const lo = O::fmadd(s, O::add(hfsq, R), O::mul(e, O::set1(1.90821492927058770002e-10)));
+		V const r = O::fmadd(e, O::set1(6.93147180369123816490e-01), O::sub(f, O::sub(hfsq, lo)));
+		return glm_log_special_pd(x, r);
+	}
+
+	// log(x) = hi + lo to ~2^-70 relative, for positive finite x. log(m) = 2*atanh(s)
+	// with s = f / (2 + f) carried as a double-double, so the series tail only needs
+	// plain double precision.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_log_dd_pd(V x, V& lo)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V e;
+		V const f = glm_log_split_pd(x, e);
+		V const two = O::set1(2.0);
+		V const u = O::add(two, f);
+		V const ulo = O::add(O::sub(two, u), f);
+		V const s = O::div(f, u);
+#	if defined(__FMA__)
+		V const Residual = O::fnmadd(s, u, f); // exact
+#	else
+		V pe;
+		V const p = glm_two_prod_pd(s, u, pe);
+		V const Residual = O::sub(O::sub(f, p), pe);
+#	endif
+		V const slo = O::div(O::sub(Residual, O::mul(s, ulo)), u);
+
+		// 2*s^3 * sum(z^n / (2n + 3)), |s| < 0.1716
+		V const z = O::mul(s, s);
+		V t = O::set1(2.0 / 25.0);
+		for(int n = 10; n >= 0; --n)
+			t = O::fmadd(t, z, O::set1(2.0 / (2 * n + 3)));
+		V const Tail = O::fmadd(O::add(z, z), slo, O::mul(O::mul(s, z), t)); // + d(tail)/ds * slo
+
+		// e*ln2 (exact hi part) + 2s, then everything else into lo
+		V const a = O::mul(e, O::set1(6.93147180369123816490e-01));
+		V const b = O::add(s, s);
+		V const hi = O::add(a, b);
+		V const bb = O::sub(hi, a);
+		V const err = O::add(O::sub(a, O::sub(hi, bb)), O::sub(b, bb));
+		V const Low = O::add(err, O::fmadd(e, O::set1(1.90821492927058770002e-10), O::add(O::add(slo, slo), Tail)));
+		V const Sum = O::add(hi, Low);
+		lo = O::sub(Low, O::sub(Sum, hi));
+		return Sum;
+	}
+
+	// --- pow ---
+
+	// exp(y * log(x)) with the product formed exactly from a double-double log.
+	// Lanes with x <= 0 or a non-finite input use std::pow for its special cases.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_pow_pd(V x, V y)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V lo;
+		V const hi = glm_log_dd_pd(x, lo);
+		V tlo;
+		V const thi = glm_two_prod_pd(y, hi, tlo);
+		tlo = O::fmadd(y, lo, tlo);
+		// Saturated exponents overflow / underflow anyway; tlo may be NaN there
+		V const abs_t = O::andnot(O::set1(-0.0), thi);
+		tlo = O::andnot(O::nlt(abs_t, O::set1(1024.0)), tlo);
+		V Result = glm_exp_pd(thi, tlo);
+
+		V const Inf = O::set1(INFINITY);
+		V const Regular = O::and_(O::and_(O::gt(x, O::zero()), O::lt(x, Inf)), O::lt(O::andnot(O::set1(-0.0), y), Inf));
+		int const Special = O::movemask(Regular) ^ ((1 << O::lanes) - 1);
+		if(Special)
+			Result = glm_fixup_pd(Result, Special, x, y, [](double a, double b) { return std::pow(a, b); });
+		return Result;
+	}
+
+	// --- atan / atan2 ---
+
+	// atan with Cephes-style reduction (|t| <= tan(pi/8)) and fdlibm's minimax
+	// polynomial; pi/4 and pi/2 offsets carry a low part.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_atan_pd(V x)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V const SignMask = O::set1(-0.0);
+		V const sign = O::and_(x, SignMask);
+		V const ax = O::andnot(SignMask, x);
+		V const one = O::set1(1.0);
+
+		V const big = O::gt(ax, O::set1(2.41421356237309504880));
+		V const mid = O::andnot(big, O::gt(ax, O::set1(0.41421356237309504880)));
+		V t = O::blend(ax, O::div(O::sub(ax, one), O::add(ax, one)), mid);
+		t = O::blend(t, O::div(O::set1(-1.0), ax), big);
+		V BaseHi = O::and_(mid, O::set1(7.85398163397448278999e-01));
+		BaseHi = O::blend(BaseHi, O::set1(1.57079632679489655800e+00), big);
+		V BaseLo = O::and_(mid, O::set1(3.06161699786838301793e-17));
+		BaseLo = O::blend(BaseLo, O::set1(6.12323399573676603587e-17), big);
+
+		V const z = O::mul(t, t);
+		V const w = O::mul(z, z);
+		V s1 = O::fmadd(w, O::set1(1.62858201153657823623e-02), O::set1(4.97687799461593236017e-02));
+		s1 = O::fmadd(w, s1, O::set1(6.66107313738753120669e-02));
+		s1 = O::fmadd(w, s1, O::set1(9.09088713343650656196e-02));
+		s1 = O::fmadd(w, s1, O::set1(1.42857142725034663711e-01));
+		s1 = O::mul(z, O::fmadd(w, s1, O::set1(3.33333333333329318027e-01)));
+		V s2 = O::fmadd(w, O::set1(-3.65315727442169155270e-02), O::set1(-5.83357013379057348645e-02));
+		s2 = O::fmadd(w, s2, O::set1(-7.69187620504482999495e-02));
+		s2 = O::fmadd(w, s2, O::set1(-1.11111104054623557880e-01));
+		s2 = O::mul(w, O::fmadd(w, s2, O::set1(-1.99999999998764832476e-01)));
+
+		// BaseHi - ((t * (s1 + s2) - BaseLo) - t)
+		V const r = O::sub(BaseHi, O::sub(O::fmadd(t, O::add(s1, s2), O::sub(O::zero(), BaseLo)), t));
+		return O::xor_(r, sign);
+	}
+
+	// atan(y / x) corrected by +-pi for x < 0. Zero, subnormal-quotient and
+	// non-finite lanes use std::atan2.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V glm_atan2_pd(V y, V x)
+	{
+		typedef glm_pd_ops_t<V> O;
+		V const SignMask = O::set1(-0.0);
+		V const q = O::div(y, x);
+		V Result = glm_atan_pd(q);
+		V const ysign = O::and_(y, SignMask);
+		V const neg = O::lt(x, O::zero());
+		V const PiHi = O::or_(O::set1(3.14159265358979311600e+00), ysign);
+		V const PiLo = O::or_(O::set1(1.22464679914735317723e-16), ysign);
+		Result = O::blend(Result, O::add(PiHi, O::add(Result, PiLo)), neg);
+
+		V const Inf = O::set1(INFINITY);
+		V const ax = O::andnot(SignMask, x);
+		V const Regular = O::and_(
+			O::and_(O::and_(O::lt(O::zero(), ax), O::lt(ax, Inf)), O::lt(O::andnot(SignMask, y), Inf)),
+			O::lt(O::set1(2.2250738585072009e-308), O::andnot(SignMask, q)));
+		int const Special = O::movemask(Regular) ^ ((1 << O::lanes) - 1);
+		if(Special)
+			Result = glm_fixup_pd(Result, Special, y, x, [](double a, double b) { return std::atan2(a, b); });
+		return Result;
+	}
+
+	// --- aligned dvec glue ---
+
+	struct glm_sin_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x) const { return glm_trig_pd<0>(x); } };
+	struct glm_cos_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x) const { return glm_trig_pd<1>(x); } };
+	struct glm_tan_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x) const { return glm_trig_pd<2>(x); } };
+	struct glm_exp_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x) const { return glm_exp_pd(x); } };
+	struct glm_log_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x) const { return glm_log_pd(x); } };
+	struct glm_pow_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V x, V y) const { return glm_pow_pd(x, y); } };
+	struct glm_atan2_pd_fn { template<typename V> GLM_FUNC_QUALIFIER V operator()(V y, V x) const { return glm_atan2_pd(y, x); } };
+
+	// Applies a kernel functor (template<typename V> V operator()(V...)) to an aligned
+	// vec<L, double>: one __m128d for dvec2, one __m256d (AVX2) or two __m128d for
+	// dvec3/dvec4. The dvec3 padding lane is set to 1 so it never hits a slow path.
+	template<length_t L, qualifier Q, typename F>
+	GLM_FUNC_QUALIFIER vec<L, double, Q> glm_vec_pd_call(F f, vec<L, double, Q> const& a)
+	{
+		static_assert(L >= 2, "dvec1 uses libm");
+		vec<L, double, Q> Result;
+		double const* pa = reinterpret_cast<double const*>(&a.data);
+		double* pr = reinterpret_cast<double*>(&Result.data);
+		if constexpr (L == 2)
+			_mm_storeu_pd(pr, f(_mm_loadu_pd(pa)));
+		else
+		{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			__m256d va = _mm256_loadu_pd(pa);
+			if constexpr (L == 3)
+				va = _mm256_blend_pd(va, _mm256_set1_pd(1.0), 0x8);
+			_mm256_storeu_pd(pr, f(va));
+#		else
+			__m128d vb = _mm_loadu_pd(pa + 2);
+			if constexpr (L == 3)
+				vb = _mm_blend_pd(vb, _mm_set1_pd(1.0), 0x2);
+			_mm_storeu_pd(pr, f(_mm_loadu_pd(pa)));
+			_mm_storeu_pd(pr + 2, f(vb));
+#		endif
+		}
+		return Result;
+	}
+
+	template<length_t L, qualifier Q, typename F>
+	GLM_FUNC_QUALIFIER vec<L, double, Q> glm_vec_pd_call(F f, vec<L, double, Q> const& a, vec<L, double, Q> const& b)
+	{
+		static_assert(L >= 2, "dvec1 uses libm");
+		vec<L, double, Q> Result;
+		double const* pa = reinterpret_cast<double const*>(&a.data);
+		double const* pb = reinterpret_cast<double const*>(&b.data);
+		double* pr = reinterpret_cast<double*>(&Result.data);
+		if constexpr (L == 2)
+			_mm_storeu_pd(pr, f(_mm_loadu_pd(pa), _mm_loadu_pd(pb)));
+		else
+		{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			__m256d va = _mm256_loadu_pd(pa), vb = _mm256_loadu_pd(pb);
+			if constexpr (L == 3)
+			{
+				va = _mm256_blend_pd(va, _mm256_set1_pd(1.0), 0x8);
+				vb = _mm256_blend_pd(vb, _mm256_set1_pd(1.0), 0x8);
+			}
+			_mm256_storeu_pd(pr, f(va, vb));
+#		else
+			__m128d va = _mm_loadu_pd(pa + 2), vb = _mm_loadu_pd(pb + 2);
+			if constexpr (L == 3)
+			{
+				va = _mm_blend_pd(va, _mm_set1_pd(1.0), 0x2);
+				vb = _mm_blend_pd(vb, _mm_set1_pd(1.0), 0x2);
+			}
+			_mm_storeu_pd(pr, f(_mm_loadu_pd(pa), _mm_loadu_pd(pb)));
+			_mm_storeu_pd(pr + 2, f(va, vb));
+#		endif
+		}
+		return Result;
+	}
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
@@ -0,0 +1,378 @@
+/// @ref core
+/// @file glm/detail/simd_transcendental_highp.h
+///
+/// 4-wide highp float sin/cos/tan/exp/exp2/log/log2/pow kernels (~1 ULP vs libm).
+/// Lanes are widened to double for the range reduction and the polynomial and
+/// rounded back to float once, so the error is dominated by that final rounding.
+/// sin/cos/tan reduce with a 3-part Cody-Waite split of pi/2 for |x| < 2^20 and
+/// fall back to a per-lane Payne-Hanek reduction beyond that.
+
+#pragma once
+
+#include "simd_transcendental.h"
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER __m128d glm_highp_fmadd(__m128d a, __m128d b, __m128d c)
+	{
+#	if defined(__FMA__)
+		return _mm_fmadd_pd(a, b, c);
+#	else
+		return _mm_add_pd(_mm_mul_pd(a, b), c);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER __m128d glm_highp_fnmadd(__m128d a, __m128d b, __m128d c)
+	{
+#	if defined(__FMA__)
+		return _mm_fnmadd_pd(a, b, c);
+#	else
+		return _mm_sub_pd(c, _mm_mul_pd(a, b));
+#	endif
+	}
+
+	// Widen the low / high float pairs to double, and narrow two double pairs back
+	GLM_FUNC_QUALIFIER __m128d glm_highp_lo_pd(__m128 x)
+	{
+		return _mm_cvtps_pd(x);
+	}
+
+	GLM_FUNC_QUALIFIER __m128d glm_highp_hi_pd(__m128 x)
+	{
+		return _mm_cvtps_pd(_mm_movehl_ps(x, x));
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_highp_ps(__m128d lo, __m128d hi)
+	{
+		return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+	}
+
+	// --- sin / cos / tan ---
+
+	// r = x - k*pi/2, |r| <= pi/4. pi/2 split into 33 + 33 + 53 bits (fdlibm), so the
+	// first two products are exact, fused or not, for |k| < 2^20.
+	GLM_FUNC_QUALIFIER __m128d glm_rem_pio2_pd(__m128d x, __m128d& k)
+	{
+		k = _mm_round_pd(_mm_mul_pd(x, _mm_set1_pd(6.36619772367581382433e-01)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m128d r = glm_highp_fnmadd(k, _mm_set1_pd(1.57079632673412561417e+00), x);
+		r = glm_highp_fnmadd(k, _mm_set1_pd(6.07710050630396597660e-11), r);
+		r = glm_highp_fnmadd(k, _mm_set1_pd(2.02226624879595063154e-21), r);
+		return _mm_blendv_pd(r, x, _mm_cmpeq_pd(k, _mm_setzero_pd())); // keeps sin(-0) = -0
+	}
+
+	// sin(r) and cos(r) on [-pi/4, pi/4], z = r*r. Minimax coefficients from FreeBSD
+	// k_sinf.c / k_cosf.c: ~2^-37 relative, well below a float ULP after rounding.
+	GLM_FUNC_QUALIFIER double glm_sin_kernel_highp(double r, double z)
+	{
+		double const s = z * r;
+		return (r + s * (-0.166666666416265235595 + z * 0.0083333293858894631756))
+			+ s * (z * z) * (-0.000198393348360966317347 + z * 0.0000027183114939898219064);
+	}
+
+	GLM_FUNC_QUALIFIER double glm_cos_kernel_highp(double z)
+	{
+		double const w = z * z;
+		return ((1.0 + z * -0.499999997251031003120) + w * 0.0416666233237390631894)
+			+ (w * z) * (-0.00138867637746099294692 + z * 0.0000243904487962774090654);
+	}
+
+	GLM_FUNC_QUALIFIER __m128d glm_sin_kernel_highp(__m128d r, __m128d z)
+	{
+		__m128d const s = _mm_mul_pd(z, r);
+		__m128d const a = glm_highp_fmadd(z, _mm_set1_pd(0.0083333293858894631756), _mm_set1_pd(-0.166666666416265235595));
+		__m128d const b = glm_highp_fmadd(z, _mm_set1_pd(0.0000027183114939898219064), _mm_set1_pd(-0.000198393348360966317347));
+		return _mm_add_pd(glm_highp_fmadd(s, a, r), _mm_mul_pd(_mm_mul_pd(s, _mm_mul_pd(z, z)), b));
+	}
+
+	GLM_FUNC_QUALIFIER __m128d glm_cos_kernel_highp(__m128d z)
+	{
+		__m128d const w = _mm_mul_pd(z, z);
+		__m128d const a = glm_highp_fmadd(w, _mm_set1_pd(0.0416666233237390631894),
+			glm_highp_fmadd(z, _mm_set1_pd(-0.499999997251031003120), _mm_set1_pd(1.0)));
+		__m128d const b = glm_highp_fmadd(z, _mm_set1_pd(0.0000243904487962774090654), _mm_set1_pd(-0.00138867637746099294692));
+		return _mm_add_pd(a, _mm_mul_pd(_mm_mul_pd(w, z), b));
+	}
+
+	// Payne-Hanek: x*2/pi mod 4 from a 96-bit window of 2/pi picked by the exponent
+	// of x. Returns r = x - q*pi/2 in double with |r| <= pi/4. For finite |x| >= 2^20.
+	GLM_FUNC_QUALIFIER double glm_rem_pio2f_large(float x, int& q)
+	{
+		// 2/pi, 32 fraction bits per word, after a leading zero word
+		static const std::uint32_t TwoOverPi[] = {
+			0x00000000,
+			0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0,
+			0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561};
+
+		std::uint32_t Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		int const e = static_cast<int>((Bits >> 23) & 0xFF) - 150; // |x| = m * 2^e
+		std::uint64_t const m = (Bits & 0x007FFFFF) | 0x00800000;
+
+		// Fraction bits of 2/pi with index < e - 1 only contribute multiples of 4
+		int const Offset = e + 30;
+		int const Word = Offset >> 5;
+		int const Shift = Offset & 31;
+		std::uint64_t w[3];
+		for(int j = 0; j < 3; ++j)
+		{
+			std::uint32_t const Hi = TwoOverPi[Word + j] << Shift;
+			std::uint32_t const Lo = Shift ? TwoOverPi[Word + j + 1] >> (32 - Shift) : 0u;
+			w[j] = Hi | Lo;
+		}
+
+		// m * w is x * 2/pi scaled by 2^94: keep the 2 integer bits and 64 fraction bits
+		std::uint64_t const p0 = m * w[0];
+		std::uint64_t const p1 = m * w[1];
+		std::uint64_t const p2 = m * w[2];
+		std::uint64_t const Low = p2 + (p1 << 32);
+		std::uint64_t const High = p0 + (p1 >> 32) + (Low < p2 ? 1u : 0u);
+
+		int Quadrant = static_cast<int>((High >> 30) & 3);
+		std::uint64_t const Fraction = (High << 34) | (Low >> 30);
+		double f = static_cast<double>(Fraction) * 5.42101086242752217004e-20; // 2^-64
+		if(f >= 0.5)
+		{
+			f -= 1.0;
+			++Quadrant;
+		}
+
+		double const r = f * 1.57079632679489661923;
+		if(Bits & 0x80000000)
+		{
+			q = -Quadrant;
+			return -r;
+		}
+		q = Quadrant;
+		return r;
+	}
+
+	// Scalar fallback for lanes outside the vector reduction range (huge, inf, NaN)
+	GLM_FUNC_QUALIFIER void glm_sincos_highp_large(float x, float& s, float& c, float& t)
+	{
+		if(!std::isfinite(x))
+		{
+			s = c = t = x - x;
+			return;
+		}
+
+		int q;
+		double const r = glm_rem_pio2f_large(x, q);
+		double const z = r * r;
+		double const S = glm_sin_kernel_highp(r, z);
+		double const C = glm_cos_kernel_highp(z);
+		double const Sin[4] = {S, C, -S, -C};
+		double const Cos[4] = {C, -S, -C, S};
+		s = static_cast<float>(Sin[q & 3]);
+		c = static_cast<float>(Cos[q & 3]);
+		t = static_cast<float>((q & 1) ? -C / S : S / C);
+	}
+
+	// Shared body of the highp sin/cos/tan kernels. Computes the reduced sin and cos
+	// (and tan when requested) in double and applies the quadrant in float.
+	template<bool ComputeTan>
+	GLM_FUNC_QUALIFIER void glm_sincostan_ps_highp(__m128 x, __m128& sin_out, __m128& cos_out, __m128& tan_out)
+	{
+		__m128d kl, kh;
+		__m128d const rl = glm_rem_pio2_pd(glm_highp_lo_pd(x), kl);
+		__m128d const rh = glm_rem_pio2_pd(glm_highp_hi_pd(x), kh);
+		__m128d const zl = _mm_mul_pd(rl, rl);
+		__m128d const zh = _mm_mul_pd(rh, rh);
+		__m128d const Sl = glm_sin_kernel_highp(rl, zl), Sh = glm_sin_kernel_highp(rh, zh);
+		__m128d const Cl = glm_cos_kernel_highp(zl), Ch = glm_cos_kernel_highp(zh);
+
+		__m128i const k = _mm_unpacklo_epi64(_mm_cvtpd_epi32(kl), _mm_cvtpd_epi32(kh));
+		__m128 const swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+
+		if(ComputeTan)
+		{
+			// tan = S/C on even quadrants, -C/S on odd ones; divide in double
+			__m128d const swapl = _mm_castsi128_pd(_mm_cvtepi32_epi64(_mm_castps_si128(swap)));
+			__m128d const swaph = _mm_castsi128_pd(_mm_cvtepi32_epi64(_mm_srli_si128(_mm_castps_si128(swap), 8)));
+			__m128d const Tl = _mm_div_pd(_mm_blendv_pd(Sl, Cl, swapl), _mm_blendv_pd(Cl, Sl, swapl));
+			__m128d const Th = _mm_div_pd(_mm_blendv_pd(Sh, Ch, swaph), _mm_blendv_pd(Ch, Sh, swaph));
+			tan_out = _mm_xor_ps(glm_highp_ps(Tl, Th), _mm_and_ps(swap, _mm_set1_ps(-0.0f)));
+		}
+		else
+		{
+			__m128 const S = glm_highp_ps(Sl, Sh);
+			__m128 const C = glm_highp_ps(Cl, Ch);
+			__m128 const sinP = _mm_blendv_ps(S, C, swap);
+			__m128 const cosP = _mm_blendv_ps(C, S, swap);
+			__m128 const sinsign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30));
+			__m128 const cossign = _mm_castsi128_ps(_mm_slli_epi32(
+				_mm_and_si128(_mm_add_epi32(k, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+			sin_out = _mm_xor_ps(sinP, sinsign);
+			cos_out = _mm_xor_ps(cosP, cossign);
+		}
+
+		// Huge, infinite or NaN lanes: the vector reduction is not exact there
+		__m128 const ax = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+		int const Large = _mm_movemask_ps(_mm_cmpnlt_ps(ax, _mm_set1_ps(1048576.f)));
+		if(Large)
+		{
+			float In[4], Sin[4], Cos[4], Tan[4];
+			_mm_storeu_ps(In, x);
+			_mm_storeu_ps(Sin, sin_out);
+			_mm_storeu_ps(Cos, cos_out);
+			_mm_storeu_ps(Tan, tan_out);
+			for(int i = 0; i < 4; ++i)
+				if(Large & (1 << i))
+					glm_sincos_highp_large(In[i], Sin[i], Cos[i], Tan[i]);
+			sin_out = _mm_loadu_ps(Sin);
+			cos_out = _mm_loadu_ps(Cos);
+			tan_out = _mm_loadu_ps(Tan);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void glm_sincos_ps_highp(__m128 x, __m128& sin_out, __m128& cos_out)
+	{
+		__m128 Unused = _mm_setzero_ps();
+		glm_sincostan_ps_highp<false>(x, sin_out, cos_out, Unused);
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_tan_ps_highp(__m128 x)
+	{
+		__m128 Unused0 = _mm_setzero_ps(), Unused1 = _mm_setzero_ps(), Result = _mm_setzero_ps();
+		glm_sincostan_ps_highp<true>(x, Unused0, Unused1, Result);
+		return Result;
+	}
+
+	// --- exp / exp2 ---
+
+	// 2^k * e^r for integral k and |r| <= ~0.35: degree-8 Taylor, error < 2^-31 relative
+	GLM_FUNC_QUALIFIER __m128d glm_exp_kernel_highp(__m128d k, __m128d r)
+	{
+		__m128d p = _mm_set1_pd(1.0 / 40320.0);
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0 / 5040.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0 / 720.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0 / 120.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0 / 24.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0 / 6.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(0.5));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0));
+		p = glm_highp_fmadd(p, r, _mm_set1_pd(1.0));
+		__m128i const e = _mm_add_epi64(_mm_cvtepi32_epi64(_mm_cvtpd_epi32(k)), _mm_set1_epi64x(1023));
+		return _mm_mul_pd(p, _mm_castsi128_pd(_mm_slli_epi64(e, 52)));
+	}
+
+	// Inputs are clamped to a range that still overflows / underflows the float
+	// result, keeping 2^k a normal double. NaN passes through min/max.
+	GLM_FUNC_QUALIFIER __m128d glm_exp_pd_highp(__m128d x)
+	{
+		x = _mm_max_pd(_mm_set1_pd(-160.0), _mm_min_pd(_mm_set1_pd(130.0), x));
+		__m128d const k = _mm_round_pd(_mm_mul_pd(x, _mm_set1_pd(1.44269504088896338700e+00)),
+			_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m128d r = glm_highp_fnmadd(k, _mm_set1_pd(6.93147180369123816490e-01), x);
+		r = glm_highp_fnmadd(k, _mm_set1_pd(1.90821492927058770002e-10), r);
+		return glm_exp_kernel_highp(k, r);
+	}
+
+	GLM_FUNC_QUALIFIER __m128d glm_exp2_pd_highp(__m128d x)
+	{
+		x = _mm_max_pd(_mm_set1_pd(-160.0), _mm_min_pd(_mm_set1_pd(130.0), x));
+		__m128d const k = _mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		__m128d const r = _mm_mul_pd(_mm_sub_pd(x, k), _mm_set1_pd(6.93147180559945286227e-01));
+		return glm_exp_kernel_highp(k, r);
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_exp_ps_highp(__m128 x)
+	{
+		return glm_highp_ps(glm_exp_pd_highp(glm_highp_lo_pd(x)), glm_exp_pd_highp(glm_highp_hi_pd(x)));
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_exp2_ps_highp(__m128 x)
+	{
+		return glm_highp_ps(glm_exp2_pd_highp(glm_highp_lo_pd(x)), glm_exp2_pd_highp(glm_highp_hi_pd(x)));
+	}
+
+	// --- log / log2 ---
+
+	// ln(x) for positive finite x (widened floats, so never subnormal):
+	// x = 2^e * m, m in [sqrt(2)/2, sqrt(2)), ln(m) = 2*atanh(s), s = (m-1)/(m+1), |s| <= 0.1716
+	GLM_FUNC_QUALIFIER __m128d glm_log_pd_highp(__m128d x)
+	{
+		__m128i const xi = _mm_castpd_si128(x);
+		__m128i const eb = _mm_srli_epi64(xi, 52);
+		__m128d e = _mm_sub_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(eb, _MM_SHUFFLE(3, 1, 2, 0))), _mm_set1_pd(1023.0));
+		__m128d m = _mm_castsi128_pd(_mm_or_si128(
+			_mm_and_si128(xi, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm_set1_epi64x(0x3FF0000000000000LL)));
+		__m128d const gt = _mm_cmpgt_pd(m, _mm_set1_pd(1.41421356237309504880));
+		m = _mm_blendv_pd(m, _mm_mul_pd(m, _mm_set1_pd(0.5)), gt);
+		e = _mm_add_pd(e, _mm_and_pd(gt, _mm_set1_pd(1.0)));
+
+		__m128d const f = _mm_sub_pd(m, _mm_set1_pd(1.0));
+		__m128d const s = _mm_div_pd(f, _mm_add_pd(m, _mm_set1_pd(1.0)));
+		__m128d const z = _mm_mul_pd(s, s);
+		__m128d p = _mm_set1_pd(2.0 / 11.0);
+		p = glm_highp_fmadd(p, z, _mm_set1_pd(2.0 / 9.0));
+		p = glm_highp_fmadd(p, z, _mm_set1_pd(2.0 / 7.0));
+		p = glm_highp_fmadd(p, z, _mm_set1_pd(2.0 / 5.0));
+		p = glm_highp_fmadd(p, z, _mm_set1_pd(2.0 / 3.0));
+		__m128d const lnm = glm_highp_fmadd(_mm_mul_pd(s, z), p, _mm_add_pd(s, s));
+		return glm_highp_fmadd(e, _mm_set1_pd(6.93147180559945286227e-01), lnm);
+	}
+
+	// log(0) = -inf, log(+inf) = +inf, log(x < 0) = log(NaN) = NaN
+	GLM_FUNC_QUALIFIER __m128 glm_log_special_ps(__m128 x, __m128 r)
+	{
+		r = _mm_blendv_ps(r, _mm_set1_ps(-INFINITY), _mm_cmpeq_ps(x, _mm_setzero_ps()));
+		r = _mm_blendv_ps(r, _mm_set1_ps(INFINITY), _mm_cmpeq_ps(x, _mm_set1_ps(INFINITY)));
+		return _mm_or_ps(r, _mm_cmpnge_ps(x, _mm_setzero_ps()));
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_log_ps_highp(__m128 x)
+	{
+		__m128 const r = glm_highp_ps(glm_log_pd_highp(glm_highp_lo_pd(x)), glm_log_pd_highp(glm_highp_hi_pd(x)));
+		return glm_log_special_ps(x, r);
+	}
+
+	GLM_FUNC_QUALIFIER __m128 glm_log2_ps_highp(__m128 x)
+	{
+		__m128d const log2e = _mm_set1_pd(1.44269504088896338700e+00);
+		__m128 const r = glm_highp_ps(
+			_mm_mul_pd(glm_log_pd_highp(glm_highp_lo_pd(x)), log2e),
+			_mm_mul_pd(glm_log_pd_highp(glm_highp_hi_pd(x)), log2e));
+		return glm_log_special_ps(x, r);
+	}
+
+	// --- pow ---
+
+	// pow(x, y) = 2^(y*log2(x)) evaluated in double. Lanes with x <= 0 or a
+	// non-finite input go through std::pow to keep its special cases (e.g. odd
+	// integer powers of negative bases).
+	GLM_FUNC_QUALIFIER __m128 glm_pow_ps_highp(__m128 x, __m128 y)
+	{
+		__m128d const log2e = _mm_set1_pd(1.44269504088896338700e+00);
+		__m128d const tl = _mm_mul_pd(glm_highp_lo_pd(y), _mm_mul_pd(glm_log_pd_highp(glm_highp_lo_pd(x)), log2e));
+		__m128d const th = _mm_mul_pd(glm_highp_hi_pd(y), _mm_mul_pd(glm_log_pd_highp(glm_highp_hi_pd(x)), log2e));
+		__m128 Result = glm_highp_ps(glm_exp2_pd_highp(tl), glm_exp2_pd_highp(th));
+
+		__m128 const Inf = _mm_set1_ps(INFINITY);
+		__m128 const Regular = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, Inf)),
+			_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), Inf));
+		int const Special = _mm_movemask_ps(Regular) ^ 0xF;
+		if(Special)
+		{
+			float X[4], Y[4], R[4];
+			_mm_storeu_ps(X, x);
+			_mm_storeu_ps(Y, y);
+			_mm_storeu_ps(R, Result);
+			for(int i = 0; i < 4; ++i)
+				if(Special & (1 << i))
+					R[i] = std::pow(X[i], Y[i]);
+			Result = _mm_loadu_ps(R);
+		}
+		return Result;
+	}
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
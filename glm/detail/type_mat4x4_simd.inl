@@ -1,6 +1,45 @@
 /// @ref core
 
-namespace glm
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct mul4x4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX512_BIT
+	template<qualifier Q>
+	struct mul4x4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_store_x16(&Result[0].data, glm_mat4_mul_x16(glm_mat4_load_x16(&m1[0].data), glm_mat4_load_x16(&m2[0].data)));
+			return Result;
+		}
+	};
 
+	template<qualifier Q>
+	struct mul4x4_row<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_mat4_mul_vec4_x16(glm_mat4_load_x16(&m[0].data), v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+}//namespace detail
 }//namespace glm
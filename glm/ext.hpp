@@ -13,6 +13,7 @@
 #	pragma message("GLM: All extensions included (not recommended)")
 #endif//GLM_MESSAGES
 
+#include "./ext/matrix_affine.hpp"
 #include "./ext/matrix_clip_space.hpp"
 #include "./ext/matrix_common.hpp"
 
@@ -95,8 +96,10 @@
 #include "./ext/matrix_projection.hpp"
 #include "./ext/matrix_relational.hpp"
 #include "./ext/matrix_transform.hpp"
+#include "./ext/matrix_transform_batch.hpp"
 
 #include "./ext/quaternion_common.hpp"
+#include "./ext/quaternion_common_batch.hpp"
 #include "./ext/quaternion_double.hpp"
 #include "./ext/quaternion_double_precision.hpp"
 #include "./ext/quaternion_float.hpp"
@@ -113,6 +116,7 @@
 #include "./ext/scalar_packing.hpp"
 #include "./ext/scalar_reciprocal.hpp"
 #include "./ext/scalar_relational.hpp"
+#include "./ext/scalar_transcendental_batch.hpp"
 #include "./ext/scalar_ulp.hpp"
 
 #include "./ext/scalar_int_sized.hpp"
@@ -182,6 +186,7 @@
 #include "./gtc/noise.hpp"
 #include "./gtc/packing.hpp"
 #include "./gtc/quaternion.hpp"
+#include "./gtc/quaternion_batch.hpp"
 #include "./gtc/random.hpp"
 #include "./gtc/reciprocal.hpp"
 #include "./gtc/round.hpp"
@@ -204,6 +209,7 @@
 #include "./gtx/compatibility.hpp"
 #include "./gtx/component_wise.hpp"
 #include "./gtx/dual_quaternion.hpp"
+#include "./gtx/dual_quaternion_batch.hpp"
 #include "./gtx/easing.hpp"
 #include "./gtx/euler_angles.hpp"
 #include "./gtx/extend.hpp"
@@ -211,6 +217,7 @@
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/frustum_culling.hpp"
 #include "./gtx/functions.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
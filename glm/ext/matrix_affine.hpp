@@ -0,0 +1,165 @@
+/// @ref ext_matrix_affine
+/// @file glm/ext/matrix_affine.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_matrix_affine GLM_EXT_matrix_affine
+/// @ingroup ext
+///
+/// Affine transforms stored without the constant last row of a mat4.
+///
+/// taffine<T, Q> is a row-major 3 * 4 matrix: three vec4 rows (m0, m1, m2, t)
+/// holding the linear part in their xyz components and the translation in
+/// their w components, the implicit last row being (0, 0, 0, 1). A float
+/// transform takes 48 bytes instead of the 64 of a mat4, and composing two
+/// transforms takes 3 rows of 3 multiply-adds instead of 4 columns of 4.
+///
+/// With SIMD enabled, float transforms are composed, applied and inverted
+/// with the glm_affine_* kernels of glm/simd/matrix.h. The rows are loaded
+/// unaligned, so packed transforms take the SIMD path as well as aligned ones.
+///
+/// Include <glm/ext/matrix_affine.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "../mat3x3.hpp"
+#include "../mat4x3.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_matrix_affine
+	/// @{
+
+	template<typename T, qualifier Q = defaultp>
+	struct taffine
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<4, T, Q> row_type;
+
+		// -- Data --
+
+		row_type value[3];
+
+		// -- Component accesses --
+
+		typedef length_t length_type;
+		/// Return the count of rows of the stored matrix
+		GLM_FUNC_DECL static constexpr length_type length(){return 3;}
+
+		GLM_FUNC_DECL GLM_CONSTEXPR row_type & operator[](length_type i) noexcept;
+		GLM_FUNC_DECL GLM_CONSTEXPR row_type const& operator[](length_type i) const noexcept;
+
+		// -- Constructors --
+
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL GLM_CONSTEXPR taffine() GLM_DEFAULT_CTOR;
+
+		/// Scaling by s
+		GLM_CTOR_DECL explicit taffine(T s);
+		GLM_CTOR_DECL taffine(row_type const& r0, row_type const& r1, row_type const& r2);
+
+		// -- Conversions --
+
+		/// The linear part m followed by the translation t
+		GLM_CTOR_DECL taffine(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& t);
+		/// Drops the last row of m, which must be (0, 0, 0, 1)
+		GLM_CTOR_DECL GLM_EXPLICIT taffine(mat<4, 4, T, Q> const& m);
+		/// The column-major 3 * 4 layout of the same transform
+		GLM_CTOR_DECL GLM_EXPLICIT taffine(mat<4, 3, T, Q> const& m);
+
+		template<typename U, qualifier P>
+		GLM_CTOR_DECL GLM_EXPLICIT taffine(taffine<U, P> const& a);
+	};
+
+	// -- Binary operators --
+
+	/// Composition: (a * b) * v == a * (b * v)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> operator*(taffine<T, Q> const& a, taffine<T, Q> const& b);
+
+	/// Transforms v as a mat4 would, v.w selecting between a point (1) and a direction (0)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<4, T, Q> operator*(taffine<T, Q> const& a, vec<4, T, Q> const& v);
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator==(taffine<T, Q> const& a, taffine<T, Q> const& b);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator!=(taffine<T, Q> const& a, taffine<T, Q> const& b);
+
+	// -- Functions --
+
+	/// Returns the mat4 of an affine transform.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(taffine<T, Q> const& a);
+
+	/// Returns the linear part of an affine transform.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> mat3_cast(taffine<T, Q> const& a);
+
+	/// Returns the translation of an affine transform.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> translation(taffine<T, Q> const& a);
+
+	/// Applies the linear part and the translation to the point p.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformPoint(taffine<T, Q> const& a, vec<3, T, Q> const& p);
+
+	/// Applies the linear part only to the direction d.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformDirection(taffine<T, Q> const& a, vec<3, T, Q> const& d);
+
+	/// Returns the inverse of an affine transform with an invertible linear part.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> inverse(taffine<T, Q> const& a);
+
+	/// Returns the inverse of a rotation followed by a translation, the linear
+	/// part being transposed instead of inverted.
+	///
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> rigidInverse(taffine<T, Q> const& a);
+
+	/// Affine transform of single-precision floating-point numbers.
+	///
+	/// @see ext_matrix_affine
+	typedef taffine<float, defaultp>	affine;
+
+	/// Affine transform of single-precision floating-point numbers.
+	///
+	/// @see ext_matrix_affine
+	typedef taffine<float, defaultp>	faffine;
+
+	/// Affine transform of double-precision floating-point numbers.
+	///
+	/// @see ext_matrix_affine
+	typedef taffine<double, defaultp>	daffine;
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
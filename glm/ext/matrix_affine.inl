@@ -0,0 +1,202 @@
+/// @ref ext_matrix_affine
+
+#include "../geometric.hpp"
+#include "../matrix.hpp"
+#include <cassert>
+
+namespace glm
+{
+	// -- Component accesses --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename taffine<T, Q>::row_type & taffine<T, Q>::operator[](typename taffine<T, Q>::length_type i) noexcept
+	{
+		GLM_ASSERT_LENGTH(i, this->length());
+		return this->value[i];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename taffine<T, Q>::row_type const& taffine<T, Q>::operator[](typename taffine<T, Q>::length_type i) const noexcept
+	{
+		GLM_ASSERT_LENGTH(i, this->length());
+		return this->value[i];
+	}
+
+	// -- Constructors --
+
+#	if GLM_CONFIG_CTOR_INIT == GLM_ENABLE
+		template<typename T, qualifier Q>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine()
+			: value{row_type(1, 0, 0, 0), row_type(0, 1, 0, 0), row_type(0, 0, 1, 0)}
+		{}
+#	endif
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(T s)
+		: value{row_type(s, 0, 0, 0), row_type(0, s, 0, 0), row_type(0, 0, s, 0)}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(row_type const& r0, row_type const& r1, row_type const& r2)
+		: value{r0, r1, r2}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& t)
+		: value{
+			row_type(m[0][0], m[1][0], m[2][0], t.x),
+			row_type(m[0][1], m[1][1], m[2][1], t.y),
+			row_type(m[0][2], m[1][2], m[2][2], t.z)}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(mat<4, 4, T, Q> const& m)
+		: value{
+			row_type(m[0][0], m[1][0], m[2][0], m[3][0]),
+			row_type(m[0][1], m[1][1], m[2][1], m[3][1]),
+			row_type(m[0][2], m[1][2], m[2][2], m[3][2])}
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(mat<4, 3, T, Q> const& m)
+		: value{
+			row_type(m[0][0], m[1][0], m[2][0], m[3][0]),
+			row_type(m[0][1], m[1][1], m[2][1], m[3][1]),
+			row_type(m[0][2], m[1][2], m[2][2], m[3][2])}
+	{}
+
+	template<typename T, qualifier Q>
+	template<typename U, qualifier P>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(taffine<U, P> const& a)
+		: value{row_type(a[0]), row_type(a[1]), row_type(a[2])}
+	{}
+
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_mul
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, Q> call(taffine<T, Q> const& a, taffine<T, Q> const& b)
+		{
+			return taffine<T, Q>(row(a[0], b), row(a[1], b), row(a[2], b));
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, T, Q> row(vec<4, T, Q> const& r, taffine<T, Q> const& b)
+		{
+			return r.x * b[0] + r.y * b[1] + r.z * b[2] + vec<4, T, Q>(0, 0, 0, r.w);
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_mul_vec4
+	{
+		GLM_FUNC_QUALIFIER static vec<4, T, Q> call(taffine<T, Q> const& a, vec<4, T, Q> const& v)
+		{
+			return vec<4, T, Q>(dot(a[0], v), dot(a[1], v), dot(a[2], v), v.w);
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, Q> call(taffine<T, Q> const& a)
+		{
+			mat<3, 3, T, Q> const Inv(inverse(mat3_cast(a)));
+			return taffine<T, Q>(Inv, -(Inv * translation(a)));
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_rigid_inverse
+	{
+		GLM_FUNC_QUALIFIER static taffine<T, Q> call(taffine<T, Q> const& a)
+		{
+			mat<3, 3, T, Q> const Inv(transpose(mat3_cast(a)));
+			return taffine<T, Q>(Inv, -(Inv * translation(a)));
+		}
+	};
+}//namespace detail
+
+	// -- Binary operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> operator*(taffine<T, Q> const& a, taffine<T, Q> const& b)
+	{
+		return detail::compute_affine_mul<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(taffine<T, Q> const& a, vec<4, T, Q> const& v)
+	{
+		return detail::compute_affine_mul_vec4<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, v);
+	}
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator==(taffine<T, Q> const& a, taffine<T, Q> const& b)
+	{
+		return (a[0] == b[0]) && (a[1] == b[1]) && (a[2] == b[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator!=(taffine<T, Q> const& a, taffine<T, Q> const& b)
+	{
+		return (a[0] != b[0]) || (a[1] != b[1]) || (a[2] != b[2]);
+	}
+
+	// -- Functions --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(taffine<T, Q> const& a)
+	{
+		return mat<4, 4, T, Q>(
+			a[0].x, a[1].x, a[2].x, static_cast<T>(0),
+			a[0].y, a[1].y, a[2].y, static_cast<T>(0),
+			a[0].z, a[1].z, a[2].z, static_cast<T>(0),
+			a[0].w, a[1].w, a[2].w, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> mat3_cast(taffine<T, Q> const& a)
+	{
+		return mat<3, 3, T, Q>(
+			a[0].x, a[1].x, a[2].x,
+			a[0].y, a[1].y, a[2].y,
+			a[0].z, a[1].z, a[2].z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> translation(taffine<T, Q> const& a)
+	{
+		return vec<3, T, Q>(a[0].w, a[1].w, a[2].w);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformPoint(taffine<T, Q> const& a, vec<3, T, Q> const& p)
+	{
+		return vec<3, T, Q>(a * vec<4, T, Q>(p, static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformDirection(taffine<T, Q> const& a, vec<3, T, Q> const& d)
+	{
+		return vec<3, T, Q>(a * vec<4, T, Q>(d, static_cast<T>(0)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> inverse(taffine<T, Q> const& a)
+	{
+		return detail::compute_affine_inverse<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> rigidInverse(taffine<T, Q> const& a)
+	{
+		return detail::compute_affine_rigid_inverse<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_affine_simd.inl"
+#endif
@@ -0,0 +1,79 @@
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Unaligned loads and stores: packed transforms take this path too
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void affine_load(taffine<float, Q> const& a, glm_vec4 r[3])
+	{
+		r[0] = _mm_loadu_ps(&a[0][0]);
+		r[1] = _mm_loadu_ps(&a[1][0]);
+		r[2] = _mm_loadu_ps(&a[2][0]);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<float, Q> affine_store(glm_vec4 const r[3])
+	{
+		taffine<float, Q> Result;
+		_mm_storeu_ps(&Result[0][0], r[0]);
+		_mm_storeu_ps(&Result[1][0], r[1]);
+		_mm_storeu_ps(&Result[2][0], r[2]);
+		return Result;
+	}
+
+	template<qualifier Q>
+	struct compute_affine_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, Q> call(taffine<float, Q> const& a, taffine<float, Q> const& b)
+		{
+			glm_vec4 A[3], B[3], Result[3];
+			affine_load(a, A);
+			affine_load(b, B);
+			glm_affine_mul(A, B, Result);
+			return affine_store<Q>(Result);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_mul_vec4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(taffine<float, Q> const& a, vec<4, float, Q> const& v)
+		{
+			glm_vec4 A[3];
+			affine_load(a, A);
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result[0], glm_affine_mul_vec4(A, _mm_loadu_ps(&v[0])));
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, Q> call(taffine<float, Q> const& a)
+		{
+			glm_vec4 A[3], Result[3];
+			affine_load(a, A);
+			glm_affine_inverse(A, Result);
+			return affine_store<Q>(Result);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_rigid_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static taffine<float, Q> call(taffine<float, Q> const& a)
+		{
+			glm_vec4 A[3], Result[3];
+			affine_load(a, A);
+			glm_affine_inverse_rigid(A, Result);
+			return affine_store<Q>(Result);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,83 @@
+/// @ref ext_matrix_transform_batch
+/// @file glm/ext/matrix_transform_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_matrix_transform_batch GLM_EXT_matrix_transform_batch
+/// @ingroup ext
+///
+/// Transform whole arrays of vectors by a single 4 * 4 matrix.
+///
+/// The matrix columns are loaded once and kept in registers for the whole
+/// array. With SIMD enabled, float arrays are processed several elements per
+/// iteration (8 lanes with AVX, 4 with SSE2); packed vec3 arrays are
+/// transposed to structure-of-arrays form on the fly. Other value types, and
+/// builds without SIMD, fall back to a loop over operator*.
+///
+/// Input and output may be the same array; partially overlapping ranges are
+/// not supported.
+///
+/// Include <glm/ext/matrix_transform_batch.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_transform_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup ext_matrix_transform_batch
+	/// @{
+
+	/// Computes out[i] = m * in[i] for count elements.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// Transforms count points (implicit w = 1), out[i] = vec3(m * vec4(in[i], 1)).
+	/// No perspective divide is applied.
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Transforms count directions (implicit w = 0), out[i] = vec3(m * vec4(in[i], 0)).
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformDirections(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Computes out[i] = m * in[i]; in and out must have the same size.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<4, T, Q> > const> in, std::span<std::type_identity_t<vec<4, T, Q> > > out);
+
+	/// Transforms points (implicit w = 1); in and out must have the same size.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<3, T, Q> > const> in, std::span<std::type_identity_t<vec<3, T, Q> > > out);
+
+	/// Transforms directions (implicit w = 0); in and out must have the same size.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformDirections(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<3, T, Q> > const> in, std::span<std::type_identity_t<vec<3, T, Q> > > out);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "matrix_transform_batch.inl"
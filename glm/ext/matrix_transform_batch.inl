@@ -0,0 +1,75 @@
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_transform_batch
+	{
+		GLM_FUNC_QUALIFIER static void vec4(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void vec3(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count, T w)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = vec<3, T, Q>(m * vec<4, T, Q>(in[i], w));
+		}
+	};
+}//namespace detail
+
+namespace batch
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transform' only accept floating-point inputs");
+		detail::compute_transform_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::vec4(m, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transformPoints' only accept floating-point inputs");
+		detail::compute_transform_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::vec3(m, in, out, count, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transformDirections' only accept floating-point inputs");
+		detail::compute_transform_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::vec3(m, in, out, count, static_cast<T>(0));
+	}
+
+#	if GLM_HAS_SPAN
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<4, T, Q> > const> in, std::span<std::type_identity_t<vec<4, T, Q> > > out)
+	{
+		assert(in.size() == out.size());
+		transform(m, in.data(), out.data(), in.size());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<3, T, Q> > const> in, std::span<std::type_identity_t<vec<3, T, Q> > > out)
+	{
+		assert(in.size() == out.size());
+		transformPoints(m, in.data(), out.data(), in.size());
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformDirections(mat<4, 4, T, Q> const& m, std::span<std::type_identity_t<vec<3, T, Q> > const> in, std::span<std::type_identity_t<vec<3, T, Q> > > out)
+	{
+		assert(in.size() == out.size());
+		transformDirections(m, in.data(), out.data(), in.size());
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_transform_batch_simd.inl"
+#endif
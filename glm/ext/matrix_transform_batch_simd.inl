@@ -0,0 +1,120 @@
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_transform_batch<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void vec4(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			float const* Src = reinterpret_cast<float const*>(in);
+			float* Dst = reinterpret_cast<float*>(out);
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				__m256 Col[4];
+				for(length_t c = 0; c < 4; ++c)
+					Col[c] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(&m[c]));
+
+				// Two vec4 per register, two registers per iteration
+				for(; i + 4 <= count; i += 4)
+				{
+					__m256 const v0 = _mm256_loadu_ps(Src + i * 4 + 0);
+					__m256 const v1 = _mm256_loadu_ps(Src + i * 4 + 8);
+					_mm256_storeu_ps(Dst + i * 4 + 0, glm_mat4_mul_vec4x2(Col, v0));
+					_mm256_storeu_ps(Dst + i * 4 + 8, glm_mat4_mul_vec4x2(Col, v1));
+				}
+			}
+#			endif
+
+			glm_vec4 Col[4];
+			for(length_t c = 0; c < 4; ++c)
+				Col[c] = _mm_loadu_ps(&m[c][0]);
+
+			for(; i < count; ++i)
+				_mm_storeu_ps(Dst + i * 4, glm_mat4_mul_vec4(Col, _mm_loadu_ps(Src + i * 4)));
+		}
+
+		GLM_FUNC_QUALIFIER static void vec3(mat<4, 4, float, Q> const& m, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count, float w)
+		{
+			float const* Src = reinterpret_cast<float const*>(in);
+			float* Dst = reinterpret_cast<float*>(out);
+			std::size_t i = 0;
+
+			if constexpr (sizeof(vec<3, float, Q>) == sizeof(float) * 4)
+			{
+				// Aligned vec3 are padded to 16 bytes: transform in place as vec4, ignoring the padding lane
+				glm_vec4 const Col0 = _mm_loadu_ps(&m[0][0]);
+				glm_vec4 const Col1 = _mm_loadu_ps(&m[1][0]);
+				glm_vec4 const Col2 = _mm_loadu_ps(&m[2][0]);
+				glm_vec4 const Col3 = _mm_mul_ps(_mm_loadu_ps(&m[3][0]), _mm_set1_ps(w));
+
+				for(; i < count; ++i)
+				{
+					glm_vec4 const v = _mm_loadu_ps(Src + i * 4);
+					glm_vec4 r = glm_vec4_fma(Col0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), Col3);
+					r = glm_vec4_fma(Col1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+					r = glm_vec4_fma(Col2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+					_mm_storeu_ps(Dst + i * 4, r);
+				}
+			}
+			else
+			{
+				// Packed vec3: transpose to x/y/z registers and apply the matrix to a whole group per instruction
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+				{
+					__m256 M[3][3], T[3];
+					for(length_t r = 0; r < 3; ++r)
+					{
+						for(length_t c = 0; c < 3; ++c)
+							M[c][r] = _mm256_set1_ps(m[c][r]);
+						T[r] = _mm256_set1_ps(m[3][r] * w);
+					}
+
+					for(; i + 8 <= count; i += 8)
+					{
+						__m256 x, y, z;
+						glm_vec3x8_load_soa(Src + i * 3, x, y, z);
+
+						__m256 Result[3];
+						for(length_t r = 0; r < 3; ++r)
+							Result[r] = glm_vec8_fma(M[2][r], z, glm_vec8_fma(M[1][r], y, glm_vec8_fma(M[0][r], x, T[r])));
+
+						glm_vec3x8_store_soa(Dst + i * 3, Result[0], Result[1], Result[2]);
+					}
+				}
+#				endif
+
+				glm_vec4 M[3][3], T[3];
+				for(length_t r = 0; r < 3; ++r)
+				{
+					for(length_t c = 0; c < 3; ++c)
+						M[c][r] = _mm_set1_ps(m[c][r]);
+					T[r] = _mm_set1_ps(m[3][r] * w);
+				}
+
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_vec4 x, y, z;
+					glm_vec3x4_load_soa(Src + i * 3, x, y, z);
+
+					glm_vec4 Result[3];
+					for(length_t r = 0; r < 3; ++r)
+						Result[r] = glm_vec4_fma(M[2][r], z, glm_vec4_fma(M[1][r], y, glm_vec4_fma(M[0][r], x, T[r])));
+
+					glm_vec3x4_store_soa(Dst + i * 3, Result[0], Result[1], Result[2]);
+				}
+
+				for(; i < count; ++i)
+					out[i] = vec<3, float, Q>(m * vec<4, float, Q>(in[i], w));
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -91,6 +91,38 @@ namespace glm
     template<typename T, typename S, qualifier Q>
     GLM_FUNC_DECL qua<T, Q> slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a, S k);
 
+	/// Normalized linear interpolation of two quaternions.
+	/// The interpolation takes the short path; it is cheaper than slerp but the
+	/// rotation speed is not constant, fastest at the middle of the arc.
+	///
+	/// @param x A quaternion
+	/// @param y A quaternion
+	/// @param a Interpolation factor. The interpolation is defined in the range [0, 1].
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see - slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> nlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a);
+
+	/// Approximate spherical linear interpolation of two quaternions.
+	/// nlerp with an interpolation factor corrected by a polynomial in the angle
+	/// between x and y, so the rotation speed is nearly constant: for unit
+	/// quaternions the result rotates within 1e-3 radians of slerp, without any
+	/// trigonometric function.
+	///
+	/// @param x A quaternion
+	/// @param y A quaternion
+	/// @param a Interpolation factor. The interpolation is defined in the range [0, 1].
+	///
+	/// @tparam T A floating-point scalar type
+	/// @tparam Q A value from qualifier enum
+	///
+	/// @see - slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> fastSlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a);
+
 	/// Returns the q conjugate.
 	///
 	/// @tparam T A floating-point scalar type
@@ -109,6 +109,34 @@ namespace glm
         }
     }
 
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> nlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'nlerp' only accept floating-point inputs");
+
+		qua<T, Q> const z = dot(x, y) < static_cast<T>(0) ? -y : y;
+		return normalize(x * (static_cast<T>(1) - a) + z * a);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> fastSlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'fastSlerp' only accept floating-point inputs");
+
+		T const cosTheta = dot(x, y);
+
+		// Arseny Kapoulkine https://zeux.io/2015/07/23/approximating-slerp/
+		T const d = abs(cosTheta);
+		T const A = static_cast<T>(1.0904) + d * (static_cast<T>(-3.2452) + d * (static_cast<T>(3.55645) - d * static_cast<T>(1.43519)));
+		T const B = static_cast<T>(0.848013) + d * (static_cast<T>(-1.06021) + d * static_cast<T>(0.215638));
+		T const h = a - static_cast<T>(0.5);
+		T const k = A * h * h + B;
+		T const t = a + a * h * (a - static_cast<T>(1)) * k;
+
+		qua<T, Q> const z = cosTheta < static_cast<T>(0) ? -y : y;
+		return normalize(x * (static_cast<T>(1) - t) + z * t);
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> conjugate(qua<T, Q> const& q)
 	{
@@ -0,0 +1,92 @@
+/// @ref ext_quaternion_common_batch
+/// @file glm/ext/quaternion_common_batch.hpp
+///
+/// @see core (dependence)
+/// @see ext_quaternion_common
+///
+/// @defgroup ext_quaternion_common_batch GLM_EXT_quaternion_common_batch
+/// @ingroup ext
+///
+/// Interpolate whole arrays of float quaternions: out[i] blends x[i] and y[i]
+/// by a[i], or by one factor shared by the whole array, as for blending two
+/// animation poses.
+///
+/// With SIMD enabled (and SSE4.1 available), quaternions are transposed to one
+/// register per component and processed 8 at a time with AVX2 and 4 at a time
+/// with SSE4.1; slerp and squad use the aligned mediump acos and sin kernels
+/// and stay within 5e-6 of the per-element functions. nlerp and fastSlerp
+/// need no transcendental function. The remainder of an array is padded into
+/// a single SIMD block, so every element goes through the same kernel. Other
+/// builds fall back to the per-element functions.
+///
+/// Output may be the same array as an input; partially overlapping ranges are
+/// not supported.
+///
+/// Include <glm/ext/quaternion_common_batch.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../ext/quaternion_float.hpp"
+#include "../ext/quaternion_common.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_quaternion_common_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup ext_quaternion_common_batch
+	/// @{
+
+	/// Computes out[i] = slerp(x[i], y[i], a[i]) for count elements.
+	///
+	/// @see glm::slerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	GLM_FUNC_DISCARD_DECL void slerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count);
+
+	/// Computes out[i] = slerp(x[i], y[i], a) for count elements.
+	GLM_FUNC_DISCARD_DECL void slerp(quat const* x, quat const* y, float a, quat* out, std::size_t count);
+
+	/// Computes out[i] = nlerp(x[i], y[i], a[i]) for count elements.
+	///
+	/// @see glm::nlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	GLM_FUNC_DISCARD_DECL void nlerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count);
+
+	/// Computes out[i] = nlerp(x[i], y[i], a) for count elements.
+	GLM_FUNC_DISCARD_DECL void nlerp(quat const* x, quat const* y, float a, quat* out, std::size_t count);
+
+	/// Computes out[i] = fastSlerp(x[i], y[i], a[i]) for count elements.
+	///
+	/// @see glm::fastSlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	GLM_FUNC_DISCARD_DECL void fastSlerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count);
+
+	/// Computes out[i] = fastSlerp(x[i], y[i], a) for count elements.
+	GLM_FUNC_DISCARD_DECL void fastSlerp(quat const* x, quat const* y, float a, quat* out, std::size_t count);
+
+	/// Spherical cubic interpolation: computes
+	/// out[i] = mix(mix(q1[i], q2[i], h[i]), mix(s1[i], s2[i], h[i]), 2 * (1 - h[i]) * h[i])
+	/// for count elements, the squad function of GLM_GTX_quaternion; s1 and s2
+	/// are the control points given by its intermediate function.
+	GLM_FUNC_DISCARD_DECL void squad(quat const* q1, quat const* q2, quat const* s1, quat const* s2, float const* h, quat* out, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overloads; the inputs and out must have the same size.
+	GLM_FUNC_DISCARD_DECL void slerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void slerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void nlerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void nlerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void fastSlerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void fastSlerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void squad(std::span<quat const> q1, std::span<quat const> q2, std::span<quat const> s1, std::span<quat const> s2, std::span<float const> h, std::span<quat> out);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "quaternion_common_batch.inl"
@@ -0,0 +1,119 @@
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	struct batch_slerp{ GLM_FUNC_QUALIFIER static quat call(quat const& x, quat const& y, float a) { return glm::slerp(x, y, a); } };
+	struct batch_nlerp{ GLM_FUNC_QUALIFIER static quat call(quat const& x, quat const& y, float a) { return glm::nlerp(x, y, a); } };
+	struct batch_fast_slerp{ GLM_FUNC_QUALIFIER static quat call(quat const& x, quat const& y, float a) { return glm::fastSlerp(x, y, a); } };
+
+	// aStride is 0 when one factor applies to the whole array
+	template<typename kernel, bool UseSimd>
+	struct compute_quat_blend_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* x, quat const* y, float const* a, std::size_t aStride, quat* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = kernel::call(x[i], y[i], a[i * aStride]);
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_quat_squad_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* q1, quat const* q2, quat const* s1, quat const* s2, float const* h, quat* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::mix(glm::mix(q1[i], q2[i], h[i]), glm::mix(s1[i], s2[i], h[i]), 2.0f * (1.0f - h[i]) * h[i]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_common_batch_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void slerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_slerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, a, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void slerp(quat const* x, quat const* y, float a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_slerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, &a, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_nlerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, a, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(quat const* x, quat const* y, float a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_nlerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, &a, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastSlerp(quat const* x, quat const* y, float const* a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_fast_slerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, a, 1, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastSlerp(quat const* x, quat const* y, float a, quat* out, std::size_t count)
+	{
+		detail::compute_quat_blend_batch<detail::batch_fast_slerp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, &a, 0, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void squad(quat const* q1, quat const* q2, quat const* s1, quat const* s2, float const* h, quat* out, std::size_t count)
+	{
+		detail::compute_quat_squad_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::call(q1, q2, s1, s2, h, out, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void slerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size() && a.size() == out.size());
+		slerp(x.data(), y.data(), a.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void slerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size());
+		slerp(x.data(), y.data(), a, out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size() && a.size() == out.size());
+		nlerp(x.data(), y.data(), a.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void nlerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size());
+		nlerp(x.data(), y.data(), a, out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void fastSlerp(std::span<quat const> x, std::span<quat const> y, std::span<float const> a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size() && a.size() == out.size());
+		fastSlerp(x.data(), y.data(), a.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void fastSlerp(std::span<quat const> x, std::span<quat const> y, float a, std::span<quat> out)
+	{
+		assert(x.size() == out.size() && y.size() == out.size());
+		fastSlerp(x.data(), y.data(), a, out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void squad(std::span<quat const> q1, std::span<quat const> q2, std::span<quat const> s1, std::span<quat const> s2, std::span<float const> h, std::span<quat> out)
+	{
+		assert(q1.size() == out.size() && q2.size() == out.size() && s1.size() == out.size() && s2.size() == out.size() && h.size() == out.size());
+		squad(q1.data(), q2.data(), s1.data(), s2.data(), h.data(), out.data(), out.size());
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
@@ -0,0 +1,295 @@
+#include "../detail/simd_transcendental.h"
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+
+namespace glm{
+namespace detail
+{
+	// Lane operations of the quaternion kernels: 4 quaternions with SSE4.1, 8
+	// with AVX2, transposed to one register per component. The storage order of
+	// the components does not matter, every kernel treats them alike.
+	struct batch_quat_sse
+	{
+		typedef __m128 fvec;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static fvec min(fvec a, fvec b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec max(fvec a, fvec b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec andf(fvec a, fvec b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec xorf(fvec a, fvec b) { return _mm_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmpgt(fvec a, fvec b) { return _mm_cmpgt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec select(fvec m, fvec a, fvec b) { return _mm_blendv_ps(b, a, m); }
+		GLM_FUNC_QUALIFIER static fvec acos(fvec x) { return glm_acos_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec sin(fvec x) { fvec s, c; glm_sincos_ps(x, s, c); return s; }
+
+		GLM_FUNC_QUALIFIER static void load(quat const* p, fvec* c)
+		{
+			c[0] = _mm_loadu_ps(reinterpret_cast<float const*>(p + 0));
+			c[1] = _mm_loadu_ps(reinterpret_cast<float const*>(p + 1));
+			c[2] = _mm_loadu_ps(reinterpret_cast<float const*>(p + 2));
+			c[3] = _mm_loadu_ps(reinterpret_cast<float const*>(p + 3));
+			_MM_TRANSPOSE4_PS(c[0], c[1], c[2], c[3]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(quat* p, fvec const* c)
+		{
+			fvec r0 = c[0], r1 = c[1], r2 = c[2], r3 = c[3];
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(reinterpret_cast<float*>(p + 0), r0);
+			_mm_storeu_ps(reinterpret_cast<float*>(p + 1), r1);
+			_mm_storeu_ps(reinterpret_cast<float*>(p + 2), r2);
+			_mm_storeu_ps(reinterpret_cast<float*>(p + 3), r3);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// Quaternions j and j + 4 share a row, so the 4 * 4 transpose stays within
+	// the 128-bit lanes
+	struct batch_quat_avx2
+	{
+		typedef __m256 fvec;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static fvec min(fvec a, fvec b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec max(fvec a, fvec b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec andf(fvec a, fvec b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec xorf(fvec a, fvec b) { return _mm256_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmpgt(fvec a, fvec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static fvec select(fvec m, fvec a, fvec b) { return _mm256_blendv_ps(b, a, m); }
+		GLM_FUNC_QUALIFIER static fvec acos(fvec x) { return glm_acos_ps256(x); }
+		GLM_FUNC_QUALIFIER static fvec sin(fvec x) { fvec s, c; glm_sincos_ps256(x, s, c); return s; }
+
+		GLM_FUNC_QUALIFIER static void transpose(fvec* r)
+		{
+			fvec const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+			fvec const t1 = _mm256_unpacklo_ps(r[2], r[3]);
+			fvec const t2 = _mm256_unpackhi_ps(r[0], r[1]);
+			fvec const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+			r[0] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			r[1] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			r[2] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r[3] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		GLM_FUNC_QUALIFIER static void load(quat const* p, fvec* c)
+		{
+			for(int j = 0; j < 4; ++j)
+				c[j] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(reinterpret_cast<float const*>(p + j))), _mm_loadu_ps(reinterpret_cast<float const*>(p + j + 4)), 1);
+			transpose(c);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(quat* p, fvec const* c)
+		{
+			fvec r[4] = {c[0], c[1], c[2], c[3]};
+			transpose(r);
+			for(int j = 0; j < 4; ++j)
+			{
+				_mm_storeu_ps(reinterpret_cast<float*>(p + j), _mm256_castps256_ps128(r[j]));
+				_mm_storeu_ps(reinterpret_cast<float*>(p + j + 4), _mm256_extractf128_ps(r[j], 1));
+			}
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec batch_quat_dot(typename simd::fvec const* x, typename simd::fvec const* y)
+	{
+		return simd::add(simd::add(simd::mul(x[0], y[0]), simd::mul(x[1], y[1])), simd::add(simd::mul(x[2], y[2]), simd::mul(x[3], y[3])));
+	}
+
+	// mix when SignMask is 0, slerp when it is -0.0f: y is negated where the
+	// dot product is negative. Lerp near cos = 1, as the per-element functions.
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_mix(typename simd::fvec const* x, typename simd::fvec const* y, typename simd::fvec a, typename simd::fvec SignMask, typename simd::fvec* out)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const One = simd::set(1.0f);
+		fvec CosTheta = batch_quat_dot<simd>(x, y);
+		fvec const Sign = simd::andf(CosTheta, SignMask);
+		CosTheta = simd::xorf(CosTheta, Sign);
+
+		fvec const Lerp = simd::cmpgt(CosTheta, simd::set(1.0f - epsilon<float>()));
+		fvec const Angle = simd::acos(simd::max(simd::min(CosTheta, One), simd::set(-1.0f)));
+		fvec const InvSin = simd::div(One, simd::sin(Angle));
+		fvec const b = simd::sub(One, a);
+		fvec const wx = simd::select(Lerp, b, simd::mul(simd::sin(simd::mul(b, Angle)), InvSin));
+		fvec const wy = simd::xorf(simd::select(Lerp, a, simd::mul(simd::sin(simd::mul(a, Angle)), InvSin)), Sign);
+		for(int c = 0; c < 4; ++c)
+			out[c] = simd::add(simd::mul(x[c], wx), simd::mul(y[c], wy));
+	}
+
+	// Short path lerp by t, normalized
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_nlerp(typename simd::fvec const* x, typename simd::fvec const* y, typename simd::fvec t, typename simd::fvec Sign, typename simd::fvec* out)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const wx = simd::sub(simd::set(1.0f), t);
+		fvec const wy = simd::xorf(t, Sign);
+		for(int c = 0; c < 4; ++c)
+			out[c] = simd::add(simd::mul(x[c], wx), simd::mul(y[c], wy));
+		fvec const InvLength = simd::div(simd::set(1.0f), simd::sqrt(batch_quat_dot<simd>(out, out)));
+		for(int c = 0; c < 4; ++c)
+			out[c] = simd::mul(out[c], InvLength);
+	}
+
+	template<typename kernel>
+	struct batch_quat_simd
+	{};
+
+	template<>
+	struct batch_quat_simd<batch_slerp>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void call(typename simd::fvec const* x, typename simd::fvec const* y, typename simd::fvec a, typename simd::fvec* out)
+		{
+			batch_quat_mix<simd>(x, y, a, simd::set(-0.0f), out);
+		}
+	};
+
+	template<>
+	struct batch_quat_simd<batch_nlerp>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void call(typename simd::fvec const* x, typename simd::fvec const* y, typename simd::fvec a, typename simd::fvec* out)
+		{
+			batch_quat_nlerp<simd>(x, y, a, simd::andf(batch_quat_dot<simd>(x, y), simd::set(-0.0f)), out);
+		}
+	};
+
+	// fastSlerp: the factor correction of the per-element function, then nlerp
+	template<>
+	struct batch_quat_simd<batch_fast_slerp>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void call(typename simd::fvec const* x, typename simd::fvec const* y, typename simd::fvec a, typename simd::fvec* out)
+		{
+			typedef typename simd::fvec fvec;
+
+			fvec const CosTheta = batch_quat_dot<simd>(x, y);
+			fvec const Sign = simd::andf(CosTheta, simd::set(-0.0f));
+			fvec const d = simd::xorf(CosTheta, Sign);
+			fvec const A = simd::add(simd::set(1.0904f), simd::mul(d, simd::add(simd::set(-3.2452f), simd::mul(d, simd::sub(simd::set(3.55645f), simd::mul(d, simd::set(1.43519f)))))));
+			fvec const B = simd::add(simd::set(0.848013f), simd::mul(d, simd::add(simd::set(-1.06021f), simd::mul(d, simd::set(0.215638f)))));
+			fvec const h = simd::sub(a, simd::set(0.5f));
+			fvec const k = simd::add(simd::mul(simd::mul(A, h), h), B);
+			fvec const t = simd::add(a, simd::mul(simd::mul(simd::mul(a, h), simd::sub(a, simd::set(1.0f))), k));
+			batch_quat_nlerp<simd>(x, y, t, Sign, out);
+		}
+	};
+
+	template<typename kernel, typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_blend_block(quat const* x, quat const* y, typename simd::fvec a, quat* out)
+	{
+		typename simd::fvec vx[4], vy[4], Result[4];
+		simd::load(x, vx);
+		simd::load(y, vy);
+		batch_quat_simd<kernel>::template call<simd>(vx, vy, a, Result);
+		simd::store(out, Result);
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_squad_block(quat const* q1, quat const* q2, quat const* s1, quat const* s2, float const* h, quat* out)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const Zero = simd::set(0.0f);
+		fvec const a = simd::load(h);
+		fvec v1[4], v2[4], m1[4], m2[4], Result[4];
+		simd::load(q1, v1);
+		simd::load(q2, v2);
+		batch_quat_mix<simd>(v1, v2, a, Zero, m1);
+		simd::load(s1, v1);
+		simd::load(s2, v2);
+		batch_quat_mix<simd>(v1, v2, a, Zero, m2);
+		batch_quat_mix<simd>(m1, m2, simd::mul(simd::mul(simd::set(2.0f), simd::sub(simd::set(1.0f), a)), a), Zero, Result);
+		simd::store(out, Result);
+	}
+
+	template<typename kernel>
+	struct compute_quat_blend_batch<kernel, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* x, quat const* y, float const* a, std::size_t aStride, quat* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				batch_quat_blend_block<kernel, batch_quat_avx2>(x + i, y + i, aStride ? batch_quat_avx2::load(a + i) : batch_quat_avx2::set(*a), out + i);
+#			endif
+			for(; i + 4 <= count; i += 4)
+				batch_quat_blend_block<kernel, batch_quat_sse>(x + i, y + i, aStride ? batch_quat_sse::load(a + i) : batch_quat_sse::set(*a), out + i);
+
+			// Pad the remainder with identities into one block so it goes through the same kernel
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				quat X[4], Y[4], Result[4];
+				float A[4] = {0.f, 0.f, 0.f, 0.f};
+				for(std::size_t j = 0; j < 4; ++j)
+					X[j] = Y[j] = quat::wxyz(1.f, 0.f, 0.f, 0.f);
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					X[j] = x[i + j];
+					Y[j] = y[i + j];
+					A[j] = a[(i + j) * aStride];
+				}
+				batch_quat_blend_block<kernel, batch_quat_sse>(X, Y, batch_quat_sse::load(A), Result);
+				for(std::size_t j = 0; j < n; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+
+	template<>
+	struct compute_quat_squad_batch<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* q1, quat const* q2, quat const* s1, quat const* s2, float const* h, quat* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				batch_quat_squad_block<batch_quat_avx2>(q1 + i, q2 + i, s1 + i, s2 + i, h + i, out + i);
+#			endif
+			for(; i + 4 <= count; i += 4)
+				batch_quat_squad_block<batch_quat_sse>(q1 + i, q2 + i, s1 + i, s2 + i, h + i, out + i);
+
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				quat Q1[4], Q2[4], S1[4], S2[4], Result[4];
+				float H[4] = {0.f, 0.f, 0.f, 0.f};
+				for(std::size_t j = 0; j < 4; ++j)
+					Q1[j] = Q2[j] = S1[j] = S2[j] = quat::wxyz(1.f, 0.f, 0.f, 0.f);
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					Q1[j] = q1[i + j];
+					Q2[j] = q2[i + j];
+					S1[j] = s1[i + j];
+					S2[j] = s2[i + j];
+					H[j] = h[i + j];
+				}
+				batch_quat_squad_block<batch_quat_sse>(Q1, Q2, S1, S2, H, Result);
+				for(std::size_t j = 0; j < n; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
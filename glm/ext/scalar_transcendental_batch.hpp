@@ -0,0 +1,87 @@
+/// @ref ext_scalar_transcendental_batch
+/// @file glm/ext/scalar_transcendental_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_scalar_transcendental_batch GLM_EXT_scalar_transcendental_batch
+/// @ingroup ext
+///
+/// Evaluate sin, cos, tan, asin, acos, atan, exp and log over whole float arrays.
+///
+/// With SIMD enabled (and FMA available), elements are processed 8 at a time
+/// with AVX2 and 4 at a time with SSE4.1, using the same kernels as the aligned
+/// mediump/lowp vector functions, so results carry the same accuracy contract:
+/// sin/cos ~3.6e-6 absolute up to |x|~1e4, exp/log ~1-2e-7 relative. The
+/// remainder of an array is padded into a single SIMD block, so every element
+/// goes through the same kernel and results do not depend on array length or
+/// position. Other builds fall back to the C standard library per element.
+///
+/// Input and output may be the same array; partially overlapping ranges are
+/// not supported.
+///
+/// Include <glm/ext/scalar_transcendental_batch.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../detail/setup.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_scalar_transcendental_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup ext_scalar_transcendental_batch
+	/// @{
+
+	/// Computes out[i] = sin(in[i]) for count elements.
+	GLM_FUNC_DISCARD_DECL void sin(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = cos(in[i]) for count elements.
+	GLM_FUNC_DISCARD_DECL void cos(float const* in, float* out, std::size_t count);
+
+	/// Computes sin_out[i] = sin(in[i]) and cos_out[i] = cos(in[i]) with a single range reduction.
+	GLM_FUNC_DISCARD_DECL void sincos(float const* in, float* sin_out, float* cos_out, std::size_t count);
+
+	/// Computes out[i] = tan(in[i]) for count elements.
+	GLM_FUNC_DISCARD_DECL void tan(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = asin(in[i]) for count elements, in[i] in [-1, 1].
+	GLM_FUNC_DISCARD_DECL void asin(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = acos(in[i]) for count elements, in[i] in [-1, 1].
+	GLM_FUNC_DISCARD_DECL void acos(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = atan(in[i]) for count elements.
+	GLM_FUNC_DISCARD_DECL void atan(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = e^in[i] for count elements.
+	GLM_FUNC_DISCARD_DECL void exp(float const* in, float* out, std::size_t count);
+
+	/// Computes out[i] = ln(in[i]) for count elements, in[i] > 0.
+	GLM_FUNC_DISCARD_DECL void log(float const* in, float* out, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overloads; in and out(s) must have the same size.
+	GLM_FUNC_DISCARD_DECL void sin(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void cos(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void sincos(std::span<float const> in, std::span<float> sin_out, std::span<float> cos_out);
+	GLM_FUNC_DISCARD_DECL void tan(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void asin(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void acos(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void atan(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void exp(std::span<float const> in, std::span<float> out);
+	GLM_FUNC_DISCARD_DECL void log(std::span<float const> in, std::span<float> out);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "scalar_transcendental_batch.inl"
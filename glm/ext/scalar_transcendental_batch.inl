@@ -0,0 +1,150 @@
+#include <cassert>
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	struct batch_sin{ GLM_FUNC_QUALIFIER static float call(float x) { return std::sin(x); } };
+	struct batch_cos{ GLM_FUNC_QUALIFIER static float call(float x) { return std::cos(x); } };
+	struct batch_tan{ GLM_FUNC_QUALIFIER static float call(float x) { return std::tan(x); } };
+	struct batch_asin{ GLM_FUNC_QUALIFIER static float call(float x) { return std::asin(x); } };
+	struct batch_acos{ GLM_FUNC_QUALIFIER static float call(float x) { return std::acos(x); } };
+	struct batch_atan{ GLM_FUNC_QUALIFIER static float call(float x) { return std::atan(x); } };
+	struct batch_exp{ GLM_FUNC_QUALIFIER static float call(float x) { return std::exp(x); } };
+	struct batch_log{ GLM_FUNC_QUALIFIER static float call(float x) { return std::log(x); } };
+
+	template<typename kernel, bool UseSimd>
+	struct compute_batch_ps
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* in, float* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = kernel::call(in[i]);
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_batch_sincos_ps
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* in, float* sin_out, float* cos_out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				float const x = in[i];
+				sin_out[i] = std::sin(x);
+				cos_out[i] = std::cos(x);
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "scalar_transcendental_batch_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void sin(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_sin, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void cos(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_cos, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void sincos(float const* in, float* sin_out, float* cos_out, std::size_t count)
+	{
+		detail::compute_batch_sincos_ps<GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, sin_out, cos_out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void tan(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_tan, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void asin(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_asin, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void acos(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_acos, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void atan(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_atan, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void exp(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_exp, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void log(float const* in, float* out, std::size_t count)
+	{
+		detail::compute_batch_ps<detail::batch_log, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void sin(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		sin(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void cos(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		cos(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void sincos(std::span<float const> in, std::span<float> sin_out, std::span<float> cos_out)
+	{
+		assert(in.size() == sin_out.size() && in.size() == cos_out.size());
+		sincos(in.data(), sin_out.data(), cos_out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void tan(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		tan(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void asin(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		asin(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void acos(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		acos(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void atan(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		atan(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void exp(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		exp(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void log(std::span<float const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		log(in.data(), out.data(), in.size());
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
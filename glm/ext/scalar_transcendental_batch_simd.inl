@@ -0,0 +1,155 @@
+#include "../detail/simd_transcendental.h"
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+
+namespace glm{
+namespace detail
+{
+	template<typename kernel>
+	struct batch_ps_simd;
+
+	template<>
+	struct batch_ps_simd<batch_sin>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { __m128 s, c; glm_sincos_ps(x, s, c); return s; }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { __m256 s, c; glm_sincos_ps256(x, s, c); return s; }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_cos>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { __m128 s, c; glm_sincos_ps(x, s, c); return c; }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { __m256 s, c; glm_sincos_ps256(x, s, c); return c; }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_tan>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { __m128 s, c; glm_sincos_ps(x, s, c); return _mm_div_ps(s, c); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { __m256 s, c; glm_sincos_ps256(x, s, c); return _mm256_div_ps(s, c); }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_asin>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { return glm_asin_ps(x); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_asin_ps256(x); }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_acos>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { return glm_acos_ps(x); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_acos_ps256(x); }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_atan>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { return glm_atan_ps(x); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_atan_ps256(x); }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_exp>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { return glm_exp_ps(x); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_exp_ps256(x); }
+#		endif
+	};
+
+	template<>
+	struct batch_ps_simd<batch_log>
+	{
+		GLM_FUNC_QUALIFIER static __m128 call(__m128 x) { return glm_log_ps(x); }
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static __m256 call(__m256 x) { return glm_log_ps256(x); }
+#		endif
+	};
+
+	template<typename kernel>
+	struct compute_batch_ps<kernel, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* in, float* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, batch_ps_simd<kernel>::call(_mm256_loadu_ps(in + i)));
+#			endif
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, batch_ps_simd<kernel>::call(_mm_loadu_ps(in + i)));
+
+			// Pad the remainder into one block so it goes through the same kernel
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				float Block[4] = {1.f, 1.f, 1.f, 1.f};
+				for(std::size_t j = 0; j < n; ++j)
+					Block[j] = in[i + j];
+				_mm_storeu_ps(Block, batch_ps_simd<kernel>::call(_mm_loadu_ps(Block)));
+				for(std::size_t j = 0; j < n; ++j)
+					out[i + j] = Block[j];
+			}
+		}
+	};
+
+	template<>
+	struct compute_batch_sincos_ps<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* in, float* sin_out, float* cos_out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				__m256 s, c;
+				glm_sincos_ps256(_mm256_loadu_ps(in + i), s, c);
+				_mm256_storeu_ps(sin_out + i, s);
+				_mm256_storeu_ps(cos_out + i, c);
+			}
+#			endif
+			for(; i + 4 <= count; i += 4)
+			{
+				__m128 s, c;
+				glm_sincos_ps(_mm_loadu_ps(in + i), s, c);
+				_mm_storeu_ps(sin_out + i, s);
+				_mm_storeu_ps(cos_out + i, c);
+			}
+
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				float Block[4] = {0.f, 0.f, 0.f, 0.f};
+				float SinBlock[4], CosBlock[4];
+				for(std::size_t j = 0; j < n; ++j)
+					Block[j] = in[i + j];
+				__m128 s, c;
+				glm_sincos_ps(_mm_loadu_ps(Block), s, c);
+				_mm_storeu_ps(SinBlock, s);
+				_mm_storeu_ps(CosBlock, c);
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					sin_out[i + j] = SinBlock[j];
+					cos_out[i + j] = CosBlock[j];
+				}
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
@@ -0,0 +1,104 @@
+/// @ref ext_simd_dispatch
+/// @file glm/ext/simd_dispatch.hpp
+///
+/// @see core (dependence)
+/// @see ext_scalar_transcendental_batch
+/// @see ext_matrix_transform_batch
+/// @see gtc_packing
+///
+/// @defgroup ext_simd_dispatch GLM_EXT_simd_dispatch
+/// @ingroup ext
+///
+/// Array-level kernels with the instruction set selected at run time.
+///
+/// The batch extensions pick their code path when the including translation
+/// unit is compiled, so a binary built for the lowest common denominator never
+/// uses AVX2. The functions of this extension are not inline: they live in the
+/// compiled glm library (CMake option GLM_BUILD_LIBRARY), which on x86 contains
+/// one variant per instruction set (SSE2, SSE4.1, AVX2 + FMA + F16C and AVX-512F). The
+/// first call checks cpuid, and the OS register state, and binds the best
+/// variant the host supports. active_isa() reports which variant was chosen.
+///
+/// Other targets, and compilers the build does not know the code generation
+/// flags of, get a single isa_generic variant compiled with the library flags.
+///
+/// Results carry the accuracy contract of the batch extensions; different
+/// variants may differ by a few ULP (e.g. when FMA is available).
+///
+/// Matrices and vectors are the packed highp types, so the library interface
+/// does not depend on GLM_FORCE_DEFAULT_ALIGNED_GENTYPES.
+///
+/// Include <glm/ext/simd_dispatch.hpp> and link glm::glm to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../detail/qualifier.hpp"
+#include "scalar_uint_sized.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_simd_dispatch extension included")
+#endif
+
+namespace glm{
+namespace dispatch
+{
+	/// @addtogroup ext_simd_dispatch
+	/// @{
+
+	/// Kernel variants of the compiled library
+	enum simd_isa
+	{
+		isa_generic,	///< Compiled with the library build flags only
+		isa_sse2,
+		isa_sse4_1,
+		isa_avx2,		///< AVX2, FMA and F16C
+		isa_avx512		///< AVX-512F, AVX2, FMA and F16C
+	};
+
+	/// Returns the variant used by the functions of this extension.
+	GLM_FUNC_DECL simd_isa active_isa();
+
+	/// Returns the name of a variant: "generic", "sse2", "sse4.1", "avx2" or "avx512".
+	GLM_FUNC_DECL char const* isa_name(simd_isa isa);
+
+	/// Returns true if the variant is in the library and the host can run it.
+	GLM_FUNC_DECL bool is_supported(simd_isa isa);
+
+	/// Forces a variant, for tests and benchmarks. Returns false and keeps the
+	/// current variant if is_supported(isa) is false.
+	GLM_FUNC_DISCARD_DECL bool select_isa(simd_isa isa);
+
+	/// batch::sin, batch::cos, ... for the active variant
+	GLM_FUNC_DISCARD_DECL void sin(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void cos(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void sincos(float const* in, float* sin_out, float* cos_out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void tan(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void asin(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void acos(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void atan(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void exp(float const* in, float* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void log(float const* in, float* out, std::size_t count);
+
+	/// batch::transform, batch::transformPoints and batch::transformDirections for the active variant
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, float, packed_highp> const& m, vec<4, float, packed_highp> const* in, vec<4, float, packed_highp>* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, float, packed_highp> const& m, vec<3, float, packed_highp> const* in, vec<3, float, packed_highp>* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void transformDirections(mat<4, 4, float, packed_highp> const& m, vec<3, float, packed_highp> const* in, vec<3, float, packed_highp>* out, std::size_t count);
+
+	/// Computes out[i] = a[i] * b[i] for count matrices.
+	GLM_FUNC_DISCARD_DECL void mul(mat<4, 4, float, packed_highp> const* a, mat<4, 4, float, packed_highp> const* b, mat<4, 4, float, packed_highp>* out, std::size_t count);
+
+	/// Computes out[i] = inverse(in[i]) for count matrices.
+	GLM_FUNC_DISCARD_DECL void inverse(mat<4, 4, float, packed_highp> const* in, mat<4, 4, float, packed_highp>* out, std::size_t count);
+
+	/// Computes out[i] = transpose(in[i]) for count matrices.
+	GLM_FUNC_DISCARD_DECL void transpose(mat<4, 4, float, packed_highp> const* in, mat<4, 4, float, packed_highp>* out, std::size_t count);
+
+	/// packHalf and unpackHalf array converters (gtc_packing) for the active variant
+	GLM_FUNC_DISCARD_DECL void packHalf(float const* in, uint16* out, std::size_t count);
+	GLM_FUNC_DISCARD_DECL void unpackHalf(uint16 const* in, float* out, std::size_t count);
+
+	/// @}
+}//namespace dispatch
+}//namespace glm
@@ -0,0 +1,305 @@
+/// @ref ext_vector_wide
+/// @file glm/ext/vector_wide.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_vector_wide GLM_EXT_vector_wide
+/// @ingroup ext
+///
+/// Structure-of-arrays vectors: wide::vec3<float, 8> holds eight vec3, with all
+/// eight x in one register, all eight y in another and so on, so every vector
+/// operation processes N elements per instruction and no lane is wasted on
+/// padding.
+///
+/// wide::scalar<T, N> is the lane type (one component of N vectors) and
+/// wide::mask<T, N> the result of its comparisons. wide::vec<L, T, N> has
+/// x, y, z and w members of type scalar<T, N> and the usual arithmetic
+/// operators, plus dot, cross, length, normalize, mix, clamp, min, max, floor,
+/// sin, cos... with the same meaning as the core functions applied lane by lane.
+/// gather and scatter convert between N consecutive glm::vec and a wide::vec.
+///
+/// With SIMD enabled, float lanes map to one __m128 for N = 4 (SSE2) and one
+/// __m256 for N = 8 (AVX); sin, cos, exp and log then use the aligned mediump
+/// kernels (sin/cos ~3.6e-6 absolute, exp/log ~2e-7 relative). Other lane
+/// counts, other value types and builds without SIMD use plain arrays and
+/// per-lane loops.
+///
+/// Include <glm/ext/vector_wide.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../detail/type_vec2.hpp"
+#include "../detail/type_vec3.hpp"
+#include "../detail/type_vec4.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_vector_wide extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Lane storage and operations: plain arrays and per-lane loops
+	// (vector_wide.inl) unless vector_wide_simd.inl maps the pair to a register
+	template<typename T, length_t N>
+	struct compute_wide;
+}//namespace detail
+
+namespace wide
+{
+	/// @addtogroup ext_vector_wide
+	/// @{
+
+	/// Per lane booleans, the result of comparing two scalar<T, N>
+	template<typename T, length_t N>
+	struct mask
+	{
+		typename detail::compute_wide<T, N>::mask_type data;
+
+		/// Returns the number of lanes
+		GLM_FUNC_DECL static constexpr length_t length(){return N;}
+
+		GLM_FUNC_DECL mask() = default;
+		GLM_FUNC_DECL explicit mask(bool b);
+
+		/// Value of lane i
+		GLM_FUNC_DECL bool operator[](length_t i) const;
+	};
+
+	/// N lanes of T: one component of N vectors
+	template<typename T, length_t N>
+	struct scalar
+	{
+		typedef T value_type;
+		typedef typename detail::compute_wide<T, N>::type storage_type;
+
+		storage_type data;
+
+		/// Returns the number of lanes
+		GLM_FUNC_DECL static constexpr length_t length(){return N;}
+
+		GLM_FUNC_DECL scalar() = default;
+		GLM_FUNC_DECL scalar(T s);
+
+		/// Loads N consecutive values
+		GLM_FUNC_DECL static scalar load(T const* p);
+		/// Stores N consecutive values
+		GLM_FUNC_DISCARD_DECL void store(T* p) const;
+
+		/// Value of lane i
+		GLM_FUNC_DECL T operator[](length_t i) const;
+		/// Sets lane i
+		GLM_FUNC_DISCARD_DECL void set(length_t i, T s);
+
+		GLM_FUNC_DISCARD_DECL scalar& operator+=(scalar const& s);
+		GLM_FUNC_DISCARD_DECL scalar& operator-=(scalar const& s);
+		GLM_FUNC_DISCARD_DECL scalar& operator*=(scalar const& s);
+		GLM_FUNC_DISCARD_DECL scalar& operator/=(scalar const& s);
+	};
+
+	/// N vectors of L components, stored as L scalar<T, N>
+	template<length_t L, typename T, length_t N>
+	struct vec;
+
+	template<typename T, length_t N>
+	struct vec<2, T, N>
+	{
+		typedef scalar<T, N> value_type;
+		value_type x, y;
+
+		GLM_FUNC_DECL static constexpr length_t length(){return 2;}
+
+		GLM_FUNC_DECL vec() = default;
+		GLM_FUNC_DECL explicit vec(value_type const& s);
+		GLM_FUNC_DECL vec(value_type const& x, value_type const& y);
+		/// The same vector in every lane
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit vec(glm::vec<2, T, Q> const& v);
+
+		GLM_FUNC_DECL value_type& operator[](length_t i);
+		GLM_FUNC_DECL value_type const& operator[](length_t i) const;
+	};
+
+	template<typename T, length_t N>
+	struct vec<3, T, N>
+	{
+		typedef scalar<T, N> value_type;
+		value_type x, y, z;
+
+		GLM_FUNC_DECL static constexpr length_t length(){return 3;}
+
+		GLM_FUNC_DECL vec() = default;
+		GLM_FUNC_DECL explicit vec(value_type const& s);
+		GLM_FUNC_DECL vec(value_type const& x, value_type const& y, value_type const& z);
+		/// The same vector in every lane
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit vec(glm::vec<3, T, Q> const& v);
+
+		GLM_FUNC_DECL value_type& operator[](length_t i);
+		GLM_FUNC_DECL value_type const& operator[](length_t i) const;
+	};
+
+	template<typename T, length_t N>
+	struct vec<4, T, N>
+	{
+		typedef scalar<T, N> value_type;
+		value_type x, y, z, w;
+
+		GLM_FUNC_DECL static constexpr length_t length(){return 4;}
+
+		GLM_FUNC_DECL vec() = default;
+		GLM_FUNC_DECL explicit vec(value_type const& s);
+		GLM_FUNC_DECL vec(value_type const& x, value_type const& y, value_type const& z, value_type const& w);
+		GLM_FUNC_DECL vec(vec<3, T, N> const& xyz, value_type const& w);
+		/// The same vector in every lane
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit vec(glm::vec<4, T, Q> const& v);
+
+		GLM_FUNC_DECL value_type& operator[](length_t i);
+		GLM_FUNC_DECL value_type const& operator[](length_t i) const;
+	};
+
+	template<typename T, length_t N> using vec2 = vec<2, T, N>;
+	template<typename T, length_t N> using vec3 = vec<3, T, N>;
+	template<typename T, length_t N> using vec4 = vec<4, T, N>;
+
+	// -- scalar operators --
+
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator-(scalar<T, N> const& a);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator+(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator-(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator*(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator/(scalar<T, N> const& a, scalar<T, N> const& b);
+
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator<(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator<=(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator>(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator>=(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator==(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator!=(scalar<T, N> const& a, scalar<T, N> const& b);
+
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator+(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator-(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator*(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator/(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator+(T a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator-(T a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator*(T a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> operator/(T a, scalar<T, N> const& b);
+
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator<(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator<=(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator>(scalar<T, N> const& a, T b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator>=(scalar<T, N> const& a, T b);
+
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator&&(mask<T, N> const& a, mask<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator||(mask<T, N> const& a, mask<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL mask<T, N> operator!(mask<T, N> const& a);
+
+	/// Returns true if any lane is set
+	template<typename T, length_t N> GLM_FUNC_DECL bool any(mask<T, N> const& m);
+	/// Returns true if every lane is set
+	template<typename T, length_t N> GLM_FUNC_DECL bool all(mask<T, N> const& m);
+
+	// -- scalar functions, lane by lane --
+
+	/// Returns a where m is set, b elsewhere
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> select(mask<T, N> const& m, scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> min(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> max(scalar<T, N> const& a, scalar<T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> clamp(scalar<T, N> const& x, scalar<T, N> const& minVal, scalar<T, N> const& maxVal);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> abs(scalar<T, N> const& x);
+	/// Returns a * b + c, fused in the SIMD paths when GLM_FORCE_FMA is defined
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> fma(scalar<T, N> const& a, scalar<T, N> const& b, scalar<T, N> const& c);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> mix(scalar<T, N> const& x, scalar<T, N> const& y, scalar<T, N> const& a);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> sqrt(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> inversesqrt(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> floor(scalar<T, N> const& x);
+	/// Returns x - floor(x)
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> fract(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> sin(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> cos(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> exp(scalar<T, N> const& x);
+	template<typename T, length_t N> GLM_FUNC_DECL scalar<T, N> log(scalar<T, N> const& x);
+
+	// -- vec operators --
+
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator-(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator+(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator-(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator*(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator/(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator+(vec<L, T, N> const& v, scalar<T, N> const& s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator-(vec<L, T, N> const& v, scalar<T, N> const& s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator*(vec<L, T, N> const& v, scalar<T, N> const& s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator*(scalar<T, N> const& s, vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator/(vec<L, T, N> const& v, scalar<T, N> const& s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator+(vec<L, T, N> const& v, T s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator-(vec<L, T, N> const& v, T s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator*(vec<L, T, N> const& v, T s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator*(T s, vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> operator/(vec<L, T, N> const& v, T s);
+
+	template<length_t L, typename T, length_t N> GLM_FUNC_DISCARD_DECL vec<L, T, N>& operator+=(vec<L, T, N>& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DISCARD_DECL vec<L, T, N>& operator-=(vec<L, T, N>& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DISCARD_DECL vec<L, T, N>& operator*=(vec<L, T, N>& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DISCARD_DECL vec<L, T, N>& operator*=(vec<L, T, N>& v, scalar<T, N> const& s);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DISCARD_DECL vec<L, T, N>& operator/=(vec<L, T, N>& v, scalar<T, N> const& s);
+
+	// -- vec functions, lane by lane --
+
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL scalar<T, N> dot(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<typename T, length_t N> GLM_FUNC_DECL vec<3, T, N> cross(vec<3, T, N> const& a, vec<3, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL scalar<T, N> length(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL scalar<T, N> distance(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> normalize(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> select(mask<T, N> const& m, vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> min(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> max(vec<L, T, N> const& a, vec<L, T, N> const& b);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> clamp(vec<L, T, N> const& x, scalar<T, N> const& minVal, scalar<T, N> const& maxVal);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> clamp(vec<L, T, N> const& x, vec<L, T, N> const& minVal, vec<L, T, N> const& maxVal);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> abs(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> mix(vec<L, T, N> const& x, vec<L, T, N> const& y, scalar<T, N> const& a);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> mix(vec<L, T, N> const& x, vec<L, T, N> const& y, vec<L, T, N> const& a);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> fma(vec<L, T, N> const& a, vec<L, T, N> const& b, vec<L, T, N> const& c);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> sqrt(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> floor(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> fract(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> sin(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> cos(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> exp(vec<L, T, N> const& v);
+	template<length_t L, typename T, length_t N> GLM_FUNC_DECL vec<L, T, N> log(vec<L, T, N> const& v);
+
+	// -- Array-of-structures adapters --
+
+	/// Loads in[0] ... in[count - 1] into lanes 0 ... count - 1, count <= N.
+	/// Lanes past count are zero.
+	template<length_t N, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, N> gather(glm::vec<L, T, Q> const* in, std::size_t count = N);
+
+	/// Stores lanes 0 ... count - 1 to out[0] ... out[count - 1], count <= N.
+	template<length_t L, typename T, length_t N, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void scatter(vec<L, T, N> const& v, glm::vec<L, T, Q>* out, std::size_t count = N);
+
+#	if GLM_HAS_SPAN
+	/// Loads in[first] ... in[first + N - 1], clamped to the span; lanes past the end are zero.
+	template<length_t N, length_t L, typename T, qualifier Q, std::size_t Extent>
+	GLM_FUNC_DECL vec<L, T, N> gather(std::span<glm::vec<L, T, Q> const, Extent> in, std::size_t first);
+	template<length_t N, length_t L, typename T, qualifier Q, std::size_t Extent>
+	GLM_FUNC_DECL vec<L, T, N> gather(std::span<glm::vec<L, T, Q>, Extent> in, std::size_t first);
+
+	/// Stores the lanes to out[first] ... out[first + N - 1], clamped to the span.
+	template<length_t L, typename T, length_t N, qualifier Q, std::size_t Extent>
+	GLM_FUNC_DISCARD_DECL void scatter(vec<L, T, N> const& v, std::span<glm::vec<L, T, Q>, Extent> out, std::size_t first);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace wide
+}//namespace glm
+
+#include "vector_wide.inl"
@@ -0,0 +1,1210 @@
+#include <cassert>
+#include <cmath>
+
+namespace glm{
+namespace detail
+{
+	template<typename T, length_t N>
+	struct wide_array
+	{
+		T v[N];
+	};
+
+	template<length_t N>
+	struct wide_bool_array
+	{
+		bool v[N];
+	};
+
+	template<typename T, length_t N>
+	struct compute_wide
+	{
+		typedef wide_array<T, N> type;
+		typedef wide_bool_array<N> mask_type;
+
+		GLM_FUNC_QUALIFIER static type splat(T s)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = s;
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type load(T const* p)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = p[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static void store(T* p, type const& a)
+		{
+			for(length_t i = 0; i < N; ++i)
+				p[i] = a.v[i];
+		}
+
+		GLM_FUNC_QUALIFIER static T get(type const& a, length_t i)
+		{
+			return a.v[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void set(type& a, length_t i, T s)
+		{
+			a.v[i] = s;
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] + b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type sub(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] - b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type mul(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] * b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type div(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] / b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type neg(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = -a.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type fma(type const& a, type const& b, type const& c)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] * b.v[i] + c.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type min(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = b.v[i] < a.v[i] ? b.v[i] : a.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type max(type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] < b.v[i] ? b.v[i] : a.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type abs(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] < static_cast<T>(0) ? -a.v[i] : a.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type sqrt(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::sqrt(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type floor(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::floor(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type sin(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::sin(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type cos(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::cos(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type exp(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::exp(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type log(type const& a)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = std::log(a.v[i]);
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type lt(type const& a, type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] < b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type le(type const& a, type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] <= b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type eq(type const& a, type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] == b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type ne(type const& a, type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] != b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static type select(mask_type const& m, type const& a, type const& b)
+		{
+			type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = m.v[i] ? a.v[i] : b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_splat(bool b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = b;
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static bool mask_get(mask_type const& m, length_t i)
+		{
+			return m.v[i];
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type const& a, mask_type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] && b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type const& a, mask_type const& b)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = a.v[i] || b.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type const& a)
+		{
+			mask_type r;
+			for(length_t i = 0; i < N; ++i)
+				r.v[i] = !a.v[i];
+			return r;
+		}
+
+		GLM_FUNC_QUALIFIER static bool any(mask_type const& m)
+		{
+			for(length_t i = 0; i < N; ++i)
+				if(m.v[i])
+					return true;
+			return false;
+		}
+
+		GLM_FUNC_QUALIFIER static bool all(mask_type const& m)
+		{
+			for(length_t i = 0; i < N; ++i)
+				if(!m.v[i])
+					return false;
+			return true;
+		}
+	};
+
+	// Conversion between N array-of-structures vectors and one wide vector,
+	// through a component-major staging buffer
+	template<length_t L, typename T, length_t N, qualifier Q, bool UseSimd>
+	struct compute_wide_aos
+	{
+		GLM_FUNC_QUALIFIER static wide::vec<L, T, N> gather(glm::vec<L, T, Q> const* in, std::size_t count)
+		{
+			T Block[L][N];
+			for(length_t i = 0; i < N; ++i)
+				for(length_t c = 0; c < L; ++c)
+					Block[c][i] = static_cast<std::size_t>(i) < count ? in[i][c] : static_cast<T>(0);
+
+			wide::vec<L, T, N> Result;
+			for(length_t c = 0; c < L; ++c)
+				Result[c] = wide::scalar<T, N>::load(Block[c]);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void scatter(wide::vec<L, T, N> const& v, glm::vec<L, T, Q>* out, std::size_t count)
+		{
+			T Block[L][N];
+			for(length_t c = 0; c < L; ++c)
+				v[c].store(Block[c]);
+
+			for(length_t i = 0; static_cast<std::size_t>(i) < count; ++i)
+				for(length_t c = 0; c < L; ++c)
+					out[i][c] = Block[c][i];
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_wide_simd.inl"
+#endif
+
+namespace glm{
+namespace wide
+{
+	// -- mask --
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N>::mask(bool b)
+		: data(detail::compute_wide<T, N>::mask_splat(b))
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER bool mask<T, N>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < N);
+		return detail::compute_wide<T, N>::mask_get(data, i);
+	}
+
+	// -- scalar --
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N>::scalar(T s)
+		: data(detail::compute_wide<T, N>::splat(s))
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> scalar<T, N>::load(T const* p)
+	{
+		scalar Result;
+		Result.data = detail::compute_wide<T, N>::load(p);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER void scalar<T, N>::store(T* p) const
+	{
+		detail::compute_wide<T, N>::store(p, data);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER T scalar<T, N>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < N);
+		return detail::compute_wide<T, N>::get(data, i);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER void scalar<T, N>::set(length_t i, T s)
+	{
+		assert(i >= 0 && i < N);
+		detail::compute_wide<T, N>::set(data, i, s);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N>& scalar<T, N>::operator+=(scalar const& s)
+	{
+		data = detail::compute_wide<T, N>::add(data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N>& scalar<T, N>::operator-=(scalar const& s)
+	{
+		data = detail::compute_wide<T, N>::sub(data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N>& scalar<T, N>::operator*=(scalar const& s)
+	{
+		data = detail::compute_wide<T, N>::mul(data, s.data);
+		return *this;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N>& scalar<T, N>::operator/=(scalar const& s)
+	{
+		data = detail::compute_wide<T, N>::div(data, s.data);
+		return *this;
+	}
+
+	// -- vec --
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<2, T, N>::vec(value_type const& s)
+		: x(s), y(s)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<2, T, N>::vec(value_type const& _x, value_type const& _y)
+		: x(_x), y(_y)
+	{}
+
+	template<typename T, length_t N>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, N>::vec(glm::vec<2, T, Q> const& v)
+		: x(v.x), y(v.y)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<2, T, N>::value_type& vec<2, T, N>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < 2);
+		return i == 0 ? x : y;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<2, T, N>::value_type const& vec<2, T, N>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 2);
+		return i == 0 ? x : y;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<3, T, N>::vec(value_type const& s)
+		: x(s), y(s), z(s)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<3, T, N>::vec(value_type const& _x, value_type const& _y, value_type const& _z)
+		: x(_x), y(_y), z(_z)
+	{}
+
+	template<typename T, length_t N>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, N>::vec(glm::vec<3, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<3, T, N>::value_type& vec<3, T, N>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < 3);
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<3, T, N>::value_type const& vec<3, T, N>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 3);
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		}
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<4, T, N>::vec(value_type const& s)
+		: x(s), y(s), z(s), w(s)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<4, T, N>::vec(value_type const& _x, value_type const& _y, value_type const& _z, value_type const& _w)
+		: x(_x), y(_y), z(_z), w(_w)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<4, T, N>::vec(vec<3, T, N> const& _xyz, value_type const& _w)
+		: x(_xyz.x), y(_xyz.y), z(_xyz.z), w(_w)
+	{}
+
+	template<typename T, length_t N>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, N>::vec(glm::vec<4, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<4, T, N>::value_type& vec<4, T, N>::operator[](length_t i)
+	{
+		assert(i >= 0 && i < 4);
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		case 3:
+			return w;
+		}
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER typename vec<4, T, N>::value_type const& vec<4, T, N>::operator[](length_t i) const
+	{
+		assert(i >= 0 && i < 4);
+		switch(i)
+		{
+		default:
+		case 0:
+			return x;
+		case 1:
+			return y;
+		case 2:
+			return z;
+		case 3:
+			return w;
+		}
+	}
+
+	// -- scalar operators --
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator-(scalar<T, N> const& a)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::neg(a.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator+(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result(a);
+		Result += b;
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator-(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result(a);
+		Result -= b;
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator*(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result(a);
+		Result *= b;
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator/(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result(a);
+		Result /= b;
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator+(scalar<T, N> const& a, T b)
+	{
+		return a + scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator-(scalar<T, N> const& a, T b)
+	{
+		return a - scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator*(scalar<T, N> const& a, T b)
+	{
+		return a * scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator/(scalar<T, N> const& a, T b)
+	{
+		return a / scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator+(T a, scalar<T, N> const& b)
+	{
+		return scalar<T, N>(a) + b;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator-(T a, scalar<T, N> const& b)
+	{
+		return scalar<T, N>(a) - b;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator*(T a, scalar<T, N> const& b)
+	{
+		return scalar<T, N>(a) * b;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> operator/(T a, scalar<T, N> const& b)
+	{
+		return scalar<T, N>(a) / b;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator<(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::lt(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator<=(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::le(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator>(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		return b < a;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator>=(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		return b <= a;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator==(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::eq(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator!=(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::ne(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator<(scalar<T, N> const& a, T b)
+	{
+		return a < scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator<=(scalar<T, N> const& a, T b)
+	{
+		return a <= scalar<T, N>(b);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator>(scalar<T, N> const& a, T b)
+	{
+		return scalar<T, N>(b) < a;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator>=(scalar<T, N> const& a, T b)
+	{
+		return scalar<T, N>(b) <= a;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator&&(mask<T, N> const& a, mask<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::mask_and(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator||(mask<T, N> const& a, mask<T, N> const& b)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::mask_or(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER mask<T, N> operator!(mask<T, N> const& a)
+	{
+		mask<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::mask_not(a.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER bool any(mask<T, N> const& m)
+	{
+		return detail::compute_wide<T, N>::any(m.data);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER bool all(mask<T, N> const& m)
+	{
+		return detail::compute_wide<T, N>::all(m.data);
+	}
+
+	// -- scalar functions --
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> select(mask<T, N> const& m, scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::select(m.data, a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> min(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::min(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> max(scalar<T, N> const& a, scalar<T, N> const& b)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::max(a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> clamp(scalar<T, N> const& x, scalar<T, N> const& minVal, scalar<T, N> const& maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> abs(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::abs(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> fma(scalar<T, N> const& a, scalar<T, N> const& b, scalar<T, N> const& c)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::fma(a.data, b.data, c.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> mix(scalar<T, N> const& x, scalar<T, N> const& y, scalar<T, N> const& a)
+	{
+		return fma(y - x, a, x);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> sqrt(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::sqrt(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> inversesqrt(scalar<T, N> const& x)
+	{
+		return static_cast<T>(1) / sqrt(x);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> floor(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::floor(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> fract(scalar<T, N> const& x)
+	{
+		return x - floor(x);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> sin(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::sin(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> cos(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::cos(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> exp(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::exp(x.data);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> log(scalar<T, N> const& x)
+	{
+		scalar<T, N> Result;
+		Result.data = detail::compute_wide<T, N>::log(x.data);
+		return Result;
+	}
+
+	// -- vec operators --
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator-(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = -v[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator+(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result(a);
+		Result += b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator-(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result(a);
+		Result -= b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator*(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result(a);
+		Result *= b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator/(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] / b[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator+(vec<L, T, N> const& v, scalar<T, N> const& s)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = v[c] + s;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator-(vec<L, T, N> const& v, scalar<T, N> const& s)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = v[c] - s;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator*(vec<L, T, N> const& v, scalar<T, N> const& s)
+	{
+		vec<L, T, N> Result(v);
+		Result *= s;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator*(scalar<T, N> const& s, vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result(v);
+		Result *= s;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator/(vec<L, T, N> const& v, scalar<T, N> const& s)
+	{
+		vec<L, T, N> Result(v);
+		Result /= s;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator+(vec<L, T, N> const& v, T s)
+	{
+		return v + scalar<T, N>(s);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator-(vec<L, T, N> const& v, T s)
+	{
+		return v - scalar<T, N>(s);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator*(vec<L, T, N> const& v, T s)
+	{
+		return v * scalar<T, N>(s);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator*(T s, vec<L, T, N> const& v)
+	{
+		return v * scalar<T, N>(s);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> operator/(vec<L, T, N> const& v, T s)
+	{
+		return v / scalar<T, N>(s);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N>& operator+=(vec<L, T, N>& a, vec<L, T, N> const& b)
+	{
+		for(length_t c = 0; c < L; ++c)
+			a[c] += b[c];
+		return a;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N>& operator-=(vec<L, T, N>& a, vec<L, T, N> const& b)
+	{
+		for(length_t c = 0; c < L; ++c)
+			a[c] -= b[c];
+		return a;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N>& operator*=(vec<L, T, N>& a, vec<L, T, N> const& b)
+	{
+		for(length_t c = 0; c < L; ++c)
+			a[c] *= b[c];
+		return a;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N>& operator*=(vec<L, T, N>& v, scalar<T, N> const& s)
+	{
+		for(length_t c = 0; c < L; ++c)
+			v[c] *= s;
+		return v;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N>& operator/=(vec<L, T, N>& v, scalar<T, N> const& s)
+	{
+		for(length_t c = 0; c < L; ++c)
+			v[c] /= s;
+		return v;
+	}
+
+	// -- vec functions --
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> dot(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		scalar<T, N> Result = a[0] * b[0];
+		for(length_t c = 1; c < L; ++c)
+			Result = fma(a[c], b[c], Result);
+		return Result;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<3, T, N> cross(vec<3, T, N> const& a, vec<3, T, N> const& b)
+	{
+		return vec<3, T, N>(
+			a.y * b.z - b.y * a.z,
+			a.z * b.x - b.z * a.x,
+			a.x * b.y - b.x * a.y);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> length(vec<L, T, N> const& v)
+	{
+		return sqrt(dot(v, v));
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER scalar<T, N> distance(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		return length(b - a);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> normalize(vec<L, T, N> const& v)
+	{
+		return v * inversesqrt(dot(v, v));
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> select(mask<T, N> const& m, vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = select(m, a[c], b[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> min(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = min(a[c], b[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> max(vec<L, T, N> const& a, vec<L, T, N> const& b)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = max(a[c], b[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> clamp(vec<L, T, N> const& x, scalar<T, N> const& minVal, scalar<T, N> const& maxVal)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = clamp(x[c], minVal, maxVal);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> clamp(vec<L, T, N> const& x, vec<L, T, N> const& minVal, vec<L, T, N> const& maxVal)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = clamp(x[c], minVal[c], maxVal[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> abs(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = abs(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> mix(vec<L, T, N> const& x, vec<L, T, N> const& y, scalar<T, N> const& a)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = mix(x[c], y[c], a);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> mix(vec<L, T, N> const& x, vec<L, T, N> const& y, vec<L, T, N> const& a)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = mix(x[c], y[c], a[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> fma(vec<L, T, N> const& a, vec<L, T, N> const& b, vec<L, T, N> const& c)
+	{
+		vec<L, T, N> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = fma(a[i], b[i], c[i]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> sqrt(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = sqrt(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> floor(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = floor(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> fract(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = fract(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> sin(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = sin(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> cos(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = cos(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> exp(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = exp(v[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER vec<L, T, N> log(vec<L, T, N> const& v)
+	{
+		vec<L, T, N> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = log(v[c]);
+		return Result;
+	}
+
+	// -- Array-of-structures adapters --
+
+	template<length_t N, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, N> gather(glm::vec<L, T, Q> const* in, std::size_t count)
+	{
+		assert(count <= static_cast<std::size_t>(N));
+		return detail::compute_wide_aos<L, T, N, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::gather(in, count);
+	}
+
+	template<length_t L, typename T, length_t N, qualifier Q>
+	GLM_FUNC_QUALIFIER void scatter(vec<L, T, N> const& v, glm::vec<L, T, Q>* out, std::size_t count)
+	{
+		assert(count <= static_cast<std::size_t>(N));
+		detail::compute_wide_aos<L, T, N, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::scatter(v, out, count);
+	}
+
+#	if GLM_HAS_SPAN
+	template<length_t N, length_t L, typename T, qualifier Q, std::size_t Extent>
+	GLM_FUNC_QUALIFIER vec<L, T, N> gather(std::span<glm::vec<L, T, Q> const, Extent> in, std::size_t first)
+	{
+		assert(first <= in.size());
+		std::size_t const Count = in.size() - first;
+		return gather<N>(in.data() + first, Count < static_cast<std::size_t>(N) ? Count : static_cast<std::size_t>(N));
+	}
+
+	template<length_t N, length_t L, typename T, qualifier Q, std::size_t Extent>
+	GLM_FUNC_QUALIFIER vec<L, T, N> gather(std::span<glm::vec<L, T, Q>, Extent> in, std::size_t first)
+	{
+		return gather<N>(std::span<glm::vec<L, T, Q> const, Extent>(in), first);
+	}
+
+	template<length_t L, typename T, length_t N, qualifier Q, std::size_t Extent>
+	GLM_FUNC_QUALIFIER void scatter(vec<L, T, N> const& v, std::span<glm::vec<L, T, Q>, Extent> out, std::size_t first)
+	{
+		assert(first <= out.size());
+		std::size_t const Count = out.size() - first;
+		scatter(v, out.data() + first, Count < static_cast<std::size_t>(N) ? Count : static_cast<std::size_t>(N));
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace wide
+}//namespace glm
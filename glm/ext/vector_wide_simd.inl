@@ -0,0 +1,285 @@
+#include "../simd/matrix.h"
+#include "../detail/simd_transcendental.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_wide<float, 4>
+	{
+		typedef glm_f32vec4 type;
+		typedef glm_f32vec4 mask_type;
+
+		GLM_FUNC_QUALIFIER static type splat(float s) { return _mm_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type a) { _mm_storeu_ps(p, a); }
+
+		GLM_FUNC_QUALIFIER static float get(type a, length_t i)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			return Lanes[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void set(type& a, length_t i, float s)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			Lanes[i] = s;
+			a = _mm_loadu_ps(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c) { return glm_vec4_fma(a, b, c); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return glm_vec4_abs(a); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type floor(type a) { return glm_vec4_floor(a); }
+
+#		if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+		GLM_FUNC_QUALIFIER static type sin(type a) { type s, c; glm_sincos_ps(a, s, c); return s; }
+		GLM_FUNC_QUALIFIER static type cos(type a) { type s, c; glm_sincos_ps(a, s, c); return c; }
+		GLM_FUNC_QUALIFIER static type exp(type a) { return glm_exp_ps(a); }
+		GLM_FUNC_QUALIFIER static type log(type a) { return glm_log_ps(a); }
+#		else
+		GLM_FUNC_QUALIFIER static type sin(type a)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			for(length_t i = 0; i < 4; ++i)
+				Lanes[i] = std::sin(Lanes[i]);
+			return _mm_loadu_ps(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static type cos(type a)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			for(length_t i = 0; i < 4; ++i)
+				Lanes[i] = std::cos(Lanes[i]);
+			return _mm_loadu_ps(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static type exp(type a)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			for(length_t i = 0; i < 4; ++i)
+				Lanes[i] = std::exp(Lanes[i]);
+			return _mm_loadu_ps(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static type log(type a)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a);
+			for(length_t i = 0; i < 4; ++i)
+				Lanes[i] = std::log(Lanes[i]);
+			return _mm_loadu_ps(Lanes);
+		}
+#		endif
+
+		GLM_FUNC_QUALIFIER static mask_type lt(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type le(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type eq(type a, type b) { return _mm_cmpeq_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type ne(type a, type b) { return _mm_cmpneq_ps(a, b); }
+
+		GLM_FUNC_QUALIFIER static type select(mask_type m, type a, type b)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return _mm_blendv_ps(b, a, m);
+#			else
+				return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static mask_type mask_splat(bool b) { return _mm_castsi128_ps(_mm_set1_epi32(b ? -1 : 0)); }
+		GLM_FUNC_QUALIFIER static bool mask_get(mask_type m, length_t i) { return ((_mm_movemask_ps(m) >> i) & 1) != 0; }
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type a, mask_type b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type a, mask_type b) { return _mm_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+		GLM_FUNC_QUALIFIER static bool any(mask_type m) { return _mm_movemask_ps(m) != 0; }
+		GLM_FUNC_QUALIFIER static bool all(mask_type m) { return _mm_movemask_ps(m) == 0xF; }
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<>
+	struct compute_wide<float, 8>
+	{
+		typedef __m256 type;
+		typedef __m256 mask_type;
+
+		GLM_FUNC_QUALIFIER static type splat(float s) { return _mm256_set1_ps(s); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type a) { _mm256_storeu_ps(p, a); }
+
+		GLM_FUNC_QUALIFIER static float get(type a, length_t i)
+		{
+			float Lanes[8];
+			_mm256_storeu_ps(Lanes, a);
+			return Lanes[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void set(type& a, length_t i, float s)
+		{
+			float Lanes[8];
+			_mm256_storeu_ps(Lanes, a);
+			Lanes[i] = s;
+			a = _mm256_loadu_ps(Lanes);
+		}
+
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type neg(type a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+		GLM_FUNC_QUALIFIER static type fma(type a, type b, type c) { return glm_vec8_fma(a, b, c); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		GLM_FUNC_QUALIFIER static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static type floor(type a) { return _mm256_floor_ps(a); }
+
+		GLM_FUNC_QUALIFIER static type sin(type a) { type s, c; sincos(a, s, c); return s; }
+		GLM_FUNC_QUALIFIER static type cos(type a) { type s, c; sincos(a, s, c); return c; }
+
+#		if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+		GLM_FUNC_QUALIFIER static void sincos(type a, type& s, type& c) { glm_sincos_ps256(a, s, c); }
+		GLM_FUNC_QUALIFIER static type exp(type a) { return glm_exp_ps256(a); }
+		GLM_FUNC_QUALIFIER static type log(type a) { return glm_log_ps256(a); }
+#		else
+		// The 8-wide kernels need AVX2: run each half through the 4-wide path
+		GLM_FUNC_QUALIFIER static void sincos(type a, type& s, type& c)
+		{
+			glm_f32vec4 s0, c0, s1, c1;
+			glm_f32vec4 const a0 = _mm256_castps256_ps128(a);
+			glm_f32vec4 const a1 = _mm256_extractf128_ps(a, 1);
+			s0 = compute_wide<float, 4>::sin(a0); c0 = compute_wide<float, 4>::cos(a0);
+			s1 = compute_wide<float, 4>::sin(a1); c1 = compute_wide<float, 4>::cos(a1);
+			s = combine(s0, s1);
+			c = combine(c0, c1);
+		}
+		GLM_FUNC_QUALIFIER static type exp(type a) { return combine(compute_wide<float, 4>::exp(_mm256_castps256_ps128(a)), compute_wide<float, 4>::exp(_mm256_extractf128_ps(a, 1))); }
+		GLM_FUNC_QUALIFIER static type log(type a) { return combine(compute_wide<float, 4>::log(_mm256_castps256_ps128(a)), compute_wide<float, 4>::log(_mm256_extractf128_ps(a, 1))); }
+
+		GLM_FUNC_QUALIFIER static type combine(glm_f32vec4 lo, glm_f32vec4 hi) { return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1); }
+#		endif
+
+		GLM_FUNC_QUALIFIER static mask_type lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static mask_type le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static mask_type eq(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		GLM_FUNC_QUALIFIER static mask_type ne(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+		GLM_FUNC_QUALIFIER static type select(mask_type m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+
+		GLM_FUNC_QUALIFIER static mask_type mask_splat(bool b) { return _mm256_castsi256_ps(_mm256_set1_epi32(b ? -1 : 0)); }
+		GLM_FUNC_QUALIFIER static bool mask_get(mask_type m, length_t i) { return ((_mm256_movemask_ps(m) >> i) & 1) != 0; }
+		GLM_FUNC_QUALIFIER static mask_type mask_and(mask_type a, mask_type b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type mask_or(mask_type a, mask_type b) { return _mm256_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static mask_type mask_not(mask_type a) { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+		GLM_FUNC_QUALIFIER static bool any(mask_type m) { return _mm256_movemask_ps(m) != 0; }
+		GLM_FUNC_QUALIFIER static bool all(mask_type m) { return _mm256_movemask_ps(m) == 0xFF; }
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Full blocks of tightly packed vectors deinterleave in registers; partial
+	// blocks and padded layouts go through the staging buffer
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_wide_aos<3, float, 4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static wide::vec<3, float, 4> gather(vec<3, float, Q> const* in, std::size_t count)
+		{
+			if(count < 4 || sizeof(vec<3, float, Q>) != 3 * sizeof(float))
+				return compute_wide_aos<3, float, 4, Q, false>::gather(in, count);
+
+			wide::vec<3, float, 4> Result;
+			glm_vec3x4_load_soa(&in[0].x, Result.x.data, Result.y.data, Result.z.data);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void scatter(wide::vec<3, float, 4> const& v, vec<3, float, Q>* out, std::size_t count)
+		{
+			if(count < 4 || sizeof(vec<3, float, Q>) != 3 * sizeof(float))
+				return compute_wide_aos<3, float, 4, Q, false>::scatter(v, out, count);
+
+			glm_vec3x4_store_soa(&out[0].x, v.x.data, v.y.data, v.z.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_wide_aos<4, float, 4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static wide::vec<4, float, 4> gather(vec<4, float, Q> const* in, std::size_t count)
+		{
+			if(count < 4)
+				return compute_wide_aos<4, float, 4, Q, false>::gather(in, count);
+
+			wide::vec<4, float, 4> Result;
+			glm_vec4x4_load_soa(&in[0].x, Result.x.data, Result.y.data, Result.z.data, Result.w.data);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void scatter(wide::vec<4, float, 4> const& v, vec<4, float, Q>* out, std::size_t count)
+		{
+			if(count < 4)
+				return compute_wide_aos<4, float, 4, Q, false>::scatter(v, out, count);
+
+			glm_vec4x4_store_soa(&out[0].x, v.x.data, v.y.data, v.z.data, v.w.data);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_wide_aos<3, float, 8, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static wide::vec<3, float, 8> gather(vec<3, float, Q> const* in, std::size_t count)
+		{
+			if(count < 8 || sizeof(vec<3, float, Q>) != 3 * sizeof(float))
+				return compute_wide_aos<3, float, 8, Q, false>::gather(in, count);
+
+			wide::vec<3, float, 8> Result;
+			glm_vec3x8_load_soa(&in[0].x, Result.x.data, Result.y.data, Result.z.data);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void scatter(wide::vec<3, float, 8> const& v, vec<3, float, Q>* out, std::size_t count)
+		{
+			if(count < 8 || sizeof(vec<3, float, Q>) != 3 * sizeof(float))
+				return compute_wide_aos<3, float, 8, Q, false>::scatter(v, out, count);
+
+			glm_vec3x8_store_soa(&out[0].x, v.x.data, v.y.data, v.z.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_wide_aos<4, float, 8, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static wide::vec<4, float, 8> gather(vec<4, float, Q> const* in, std::size_t count)
+		{
+			if(count < 8)
+				return compute_wide_aos<4, float, 8, Q, false>::gather(in, count);
+
+			wide::vec<4, float, 8> Result;
+			glm_vec4x8_load_soa(&in[0].x, Result.x.data, Result.y.data, Result.z.data, Result.w.data);
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static void scatter(wide::vec<4, float, 8> const& v, vec<4, float, Q>* out, std::size_t count)
+		{
+			if(count < 8)
+				return compute_wide_aos<4, float, 8, Q, false>::scatter(v, out, count);
+
+			glm_vec4x8_store_soa(&out[0].x, v.x.data, v.y.data, v.z.data, v.w.data);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
+}//namespace glm
@@ -13,6 +13,19 @@
 /// https://github.com/ashima/webgl-noise
 /// Following Stefan Gustavson's paper "Simplex noise demystified":
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
+///
+/// The wide::vec overloads evaluate N points at once, one per lane, with the
+/// same formulas as the scalar functions; glm::batch::perlin and
+/// glm::batch::simplex run them over arrays of points, and perlinGrid and
+/// simplexGrid over regular 2D, 3D or 4D grids, 8 points per packet with AVX
+/// and 4 otherwise.
+///
+/// fbm, ridged, billow and turbulence sum a compile-time number of octaves
+/// of simplex or perlin noise, unrolled, for one point or for a packet; the
+/// overloads taking a gradient also return the analytic gradient of the sum,
+/// built from perlinDerivative or simplexDerivative. warp displaces a point
+/// by fbm for domain warping. glm::batch::noise and glm::batch::noiseGrid
+/// run any of them, or any other noise kernel, over arrays and grids.
 
 #pragma once
 
@@ -26,6 +39,13 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include "../ext/vector_wide.hpp"
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,7 +75,288 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Classic perlin noise of N points, one per lane.
+	/// Each lane agrees with perlin(p) for its point up to float rounding.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> perlin(
+		wide::vec<L, T, N> const& p);
+
+	/// Periodic perlin noise of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> perlin(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N> const& rep);
+
+	/// Simplex noise of N points, one per lane.
+	/// Each lane agrees with simplex(p) for its point up to float rounding.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> simplex(
+		wide::vec<L, T, N> const& p);
+
+	/// Classic perlin noise, with its analytic gradient written to gradient.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T perlinDerivative(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient);
+
+	/// Simplex noise, with its analytic gradient written to gradient.
+	/// @see gtc_noise
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T simplexDerivative(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient);
+
+	/// Classic perlin noise of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> perlinDerivative(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient);
+
+	/// Simplex noise of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> simplexDerivative(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient);
+
+	/// Noise summed by the fractal functions
+	enum noise_basis
+	{
+		noise_simplex,
+		noise_perlin
+	};
+
+	/// Fractal Brownian motion: the sum over the octaves i in [0, Octaves) of
+	/// gain^i * noise(p * lacunarity^i), with noise the Basis function.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T fbm(
+		vec<L, T, Q> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// Ridged noise: the octaves of fbm with each noise value n replaced by
+	/// (1 - |n|)^2, which turns the zero crossings into sharp crests.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T ridged(
+		vec<L, T, Q> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// Billow noise: the octaves of fbm with each noise value n replaced by
+	/// 2 * |n| - 1.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T billow(
+		vec<L, T, Q> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// Turbulence: the octaves of fbm with each noise value n replaced by |n|.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T turbulence(
+		vec<L, T, Q> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// fbm(p, lacunarity, gain), with its analytic gradient written to
+	/// gradient.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T fbm(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// ridged(p, lacunarity, gain), with its analytic gradient written to
+	/// gradient.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T ridged(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// billow(p, lacunarity, gain), with its analytic gradient written to
+	/// gradient.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T billow(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// turbulence(p, lacunarity, gain), with its analytic gradient written to
+	/// gradient.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T turbulence(
+		vec<L, T, Q> const& p,
+		vec<L, T, Q>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// Domain warping: p displaced by amplitude * fbm along each axis, component
+	/// c using fbm(p + 5.2 * c, lacunarity, gain). Sample a noise function at
+	/// the result to warp it.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> warp(
+		vec<L, T, Q> const& p,
+		T amplitude,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// fbm of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> fbm(
+		wide::vec<L, T, N> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// ridged of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> ridged(
+		wide::vec<L, T, N> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// billow of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> billow(
+		wide::vec<L, T, N> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// turbulence of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> turbulence(
+		wide::vec<L, T, N> const& p,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// fbm of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> fbm(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// ridged of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> ridged(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// billow of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> billow(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// turbulence of N points and their gradients, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::scalar<T, N> turbulence(
+		wide::vec<L, T, N> const& p,
+		wide::vec<L, T, N>& gradient,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// warp of N points, one per lane.
+	/// @see gtc_noise
+	template<length_t Octaves, noise_basis Basis = noise_simplex, length_t L, typename T, length_t N>
+	GLM_FUNC_DECL wide::vec<L, T, N> warp(
+		wide::vec<L, T, N> const& p,
+		T amplitude,
+		T lacunarity = static_cast<T>(2),
+		T gain = static_cast<T>(0.5));
+
+	/// @}
+
+namespace batch
+{
+	/// @addtogroup gtc_noise
+	/// @{
+
+	/// out[i] = perlin(in[i]) for i in [0, count).
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(vec<L, T, Q> const* in, T* out, std::size_t count);
+
+	/// out[i] = perlin(in[i], rep) for i in [0, count).
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(vec<L, T, Q> const* in, vec<L, T, Q> const& rep, T* out, std::size_t count);
+
+	/// out[i] = simplex(in[i]) for i in [0, count).
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplex(vec<L, T, Q> const* in, T* out, std::size_t count);
+
+	/// Fills out with perlin(origin + vec(x, y, z, w) * spacing) over the
+	/// size.x * size.y * ... grid points, x varying fastest:
+	/// out[x + size.x * (y + size.y * (z + size.z * w))].
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out);
+
+	/// Fills out with perlin(origin + vec(x, y, z, w) * spacing, rep), laid
+	/// out as perlinGrid.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, vec<L, T, Q> const& rep, T* out);
+
+	/// Fills out with simplex(origin + vec(x, y, z, w) * spacing), laid out
+	/// as perlinGrid.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out);
+
+	/// out[i] = kernel(in[i]) for i in [0, count). kernel is called with
+	/// wide::vec<L, T, N> packets where the noise packets use SIMD for T and
+	/// with single vec<L, T, Q> otherwise, so a generic lambda covers both:
+	/// noise(in, out, count, [](auto const& p){ return glm::fbm<6>(p); }).
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_DISCARD_DECL void noise(vec<L, T, Q> const* in, T* out, std::size_t count, kernel Kernel);
+
+	/// Fills out with kernel(origin + vec(x, y, z, w) * spacing), laid out as
+	/// perlinGrid; kernel is called as by noise.
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_DISCARD_DECL void noiseGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out, kernel Kernel);
+
+#	if GLM_HAS_SPAN
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(std::span<vec<L, T, Q> const> in, std::span<T> out);
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(std::span<vec<L, T, Q> const> in, std::type_identity_t<vec<L, T, Q> > const& rep, std::span<T> out);
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplex(std::span<vec<L, T, Q> const> in, std::span<T> out);
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_DISCARD_DECL void noise(std::span<vec<L, T, Q> const> in, std::span<T> out, kernel Kernel);
+#	endif//GLM_HAS_SPAN
+
 	/// @}
+}//namespace batch
 }//namespace glm
 
 #include "noise.inl"
@@ -83,7 +83,7 @@ namespace detail
 		vec<4, T, Q> gy0 = fract(floor(gx0) * T(1.0 / 7.0)) - T(0.5);
 		gx0 = fract(gx0);
 		vec<4, T, Q> gz0 = vec<4, T, Q>(0.5) - abs(gx0) - abs(gy0);
-		vec<4, T, Q> sz0 = step(gz0, vec<4, T, Q>(0.0));
+		vec<4, T, Q> sz0 = detail::gradientFold(ixy0);
 		gx0 -= sz0 * (step(T(0), gx0) - T(0.5));
 		gy0 -= sz0 * (step(T(0), gy0) - T(0.5));
 
@@ -91,7 +91,7 @@ namespace detail
 		vec<4, T, Q> gy1 = fract(floor(gx1) * T(1.0 / 7.0)) - T(0.5);
 		gx1 = fract(gx1);
 		vec<4, T, Q> gz1 = vec<4, T, Q>(0.5) - abs(gx1) - abs(gy1);
-		vec<4, T, Q> sz1 = step(gz1, vec<4, T, Q>(0.0));
+		vec<4, T, Q> sz1 = detail::gradientFold(ixy1);
 		gx1 -= sz1 * (step(T(0), gx1) - T(0.5));
 		gy1 -= sz1 * (step(T(0), gy1) - T(0.5));
 
@@ -804,4 +804,1082 @@ namespace detail
 			(dot(m0 * m0, vec<3, T, Q>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) +
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
+
+namespace detail
+{
+	// -- Packets --
+	// The scalar functions keep the corners of the cell around one point in
+	// vec4 lanes; the packet functions keep one wide::scalar per corner, each
+	// lane holding a different point, and follow the same formulas.
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::vec<L, T, N> noise_mod(wide::vec<L, T, N> const& x, wide::vec<L, T, N> const& y)
+	{
+		return x - y * wide::floor(x / y);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::vec<L, T, N> noise_mod(wide::vec<L, T, N> const& x, T y)
+	{
+		return x - wide::floor(x / y) * y;
+	}
+
+	// step(edge, x) with a constant x or a constant edge
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_step(wide::scalar<T, N> const& edge, T x)
+	{
+		return wide::select(edge > x, wide::scalar<T, N>(static_cast<T>(0)), wide::scalar<T, N>(static_cast<T>(1)));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_step(T edge, wide::scalar<T, N> const& x)
+	{
+		return wide::select(x < edge, wide::scalar<T, N>(static_cast<T>(0)), wide::scalar<T, N>(static_cast<T>(1)));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> gradientFold(wide::scalar<T, N> const& x)
+	{
+		wide::scalar<T, N> const j = wide::floor(x * static_cast<T>(1.0 / 7.0));
+		wide::scalar<T, N> const i = x - j * static_cast<T>(7);
+		wide::scalar<T, N> const k = j - wide::floor(j * static_cast<T>(1.0 / 7.0)) * static_cast<T>(7);
+		return noise_step(static_cast<T>(7), i * static_cast<T>(2) + wide::abs(k * static_cast<T>(2) - static_cast<T>(7)));
+	}
+
+	// Blends the 2^L corner values v (clobbered) with the weights u, the
+	// highest axis first
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin_blend(wide::scalar<T, N>* v, wide::vec<L, T, N> const& u)
+	{
+		for(length_t k = L; k-- > 0;)
+			for(int c = 0; c < (1 << k); ++c)
+				v[c] = wide::mix(v[c], v[c + (1 << k)], u[k]);
+		return v[0];
+	}
+
+	// Gradient of the blend of the corner values n, whose own gradients are g:
+	// the weights are products of fade(Pf0) and 1 - fade(Pf0) terms, and
+	// fade'(t) = 30 t^2 (t - 1)^2
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::vec<L, T, N> perlin_gradient(wide::scalar<T, N> const* n, wide::vec<L, T, N> const* g, wide::vec<L, T, N> const& Pf0)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+		int const Corners = 1 << L;
+
+		wide::vec<L, T, N> u;
+		for(length_t k = 0; k < L; ++k)
+			u[k] = fade(Pf0[k]);
+
+		wide::vec<L, T, N> Result;
+		for(length_t k = 0; k < L; ++k)
+		{
+			int const Bit = 1 << k;
+			scalar_type Edge[Corners];
+			scalar_type Slope[Corners];
+			for(int c = 0; c < Corners; ++c)
+			{
+				Edge[c] = n[c | Bit] - n[c & ~Bit];
+				Slope[c] = g[c][k];
+			}
+
+			scalar_type const t = Pf0[k] * (Pf0[k] - static_cast<T>(1));
+			Result[k] = perlin_blend(Slope, u) + static_cast<T>(30) * t * t * perlin_blend(Edge, u);
+		}
+		return Result;
+	}
+
+	// Corner c of the cell is at Pi0 + (c & 1, (c >> 1) & 1, ...), as n00, n10,
+	// n01 and n11 in the scalar function. With Gradient, the gradient of the
+	// noise is written to *Grad as well.
+	template<bool Gradient, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin_packet(wide::vec<2, T, N> const& Pi0, wide::vec<2, T, N> const& Pi1, wide::vec<2, T, N> const& Pf0, wide::vec<2, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+
+		wide::vec<2, T, N> const Pf1 = Pf0 - static_cast<T>(1);
+		scalar_type const ix[2] = {permute(Pi0.x), permute(Pi1.x)};
+
+		scalar_type n[4];
+		wide::vec<2, T, N> g[Gradient ? 4 : 1];
+		for(int c = 0; c < 4; ++c)
+		{
+			scalar_type const i = permute(ix[c & 1] + (c & 2 ? Pi1.y : Pi0.y));
+
+			scalar_type gx = static_cast<T>(2) * wide::fract(i / static_cast<T>(41)) - static_cast<T>(1);
+			scalar_type const gy = wide::abs(gx) - static_cast<T>(0.5);
+			gx = gx - wide::floor(gx + static_cast<T>(0.5));
+
+			scalar_type const norm = taylorInvSqrt(gx * gx + gy * gy);
+			n[c] = norm * (gx * (c & 1 ? Pf1.x : Pf0.x) + gy * (c & 2 ? Pf1.y : Pf0.y));
+			if constexpr(Gradient)
+				g[c] = wide::vec<2, T, N>(norm * gx, norm * gy);
+		}
+
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(2.3) * perlin_gradient(n, g, Pf0);
+
+		scalar_type const fade_x = fade(Pf0.x);
+		scalar_type const n_x0 = wide::mix(n[0], n[1], fade_x);
+		scalar_type const n_x1 = wide::mix(n[2], n[3], fade_x);
+		return static_cast<T>(2.3) * wide::mix(n_x0, n_x1, fade(Pf0.y));
+	}
+
+	// The periodic scalar function divides by 7 where the other one multiplies
+	// by 1 / 7: the results differ where a gradient lands on gz = 0, so the
+	// packet follows each one
+	template<bool Gradient, bool Periodic, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin_packet(wide::vec<3, T, N> const& Pi0, wide::vec<3, T, N> const& Pi1, wide::vec<3, T, N> const& Pf0, wide::vec<3, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+
+		wide::vec<3, T, N> const Pf1 = Pf0 - static_cast<T>(1);
+		scalar_type const ix[2] = {permute(Pi0.x), permute(Pi1.x)};
+		scalar_type ixy[4];
+		for(int c = 0; c < 4; ++c)
+			ixy[c] = permute(ix[c & 1] + (c & 2 ? Pi1.y : Pi0.y));
+
+		scalar_type n[8];
+		wide::vec<3, T, N> g[Gradient ? 8 : 1];
+		for(int c = 0; c < 8; ++c)
+		{
+			scalar_type const ixyz = permute(ixy[c & 3] + (c & 4 ? Pi1.z : Pi0.z));
+
+			scalar_type gx = Periodic ? ixyz / static_cast<T>(7) : ixyz * static_cast<T>(1.0 / 7.0);
+			scalar_type gy = wide::fract(Periodic ? wide::floor(gx) / static_cast<T>(7) : wide::floor(gx) * static_cast<T>(1.0 / 7.0)) - static_cast<T>(0.5);
+			gx = wide::fract(gx);
+			scalar_type const gz = static_cast<T>(0.5) - wide::abs(gx) - wide::abs(gy);
+			scalar_type const sz = Periodic ? noise_step(gz, static_cast<T>(0)) : gradientFold(ixyz);
+			gx -= sz * (noise_step(static_cast<T>(0), gx) - static_cast<T>(0.5));
+			gy -= sz * (noise_step(static_cast<T>(0), gy) - static_cast<T>(0.5));
+
+			scalar_type const norm = taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+			n[c] = norm * (gx * (c & 1 ? Pf1.x : Pf0.x) + gy * (c & 2 ? Pf1.y : Pf0.y) + gz * (c & 4 ? Pf1.z : Pf0.z));
+			if constexpr(Gradient)
+				g[c] = wide::vec<3, T, N>(norm * gx, norm * gy, norm * gz);
+		}
+
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(2.2) * perlin_gradient(n, g, Pf0);
+
+		scalar_type const fade_z = fade(Pf0.z);
+		scalar_type const fade_y = fade(Pf0.y);
+		scalar_type n_z[4];
+		for(int c = 0; c < 4; ++c)
+			n_z[c] = wide::mix(n[c], n[c + 4], fade_z);
+		scalar_type const n_yz0 = wide::mix(n_z[0], n_z[2], fade_y);
+		scalar_type const n_yz1 = wide::mix(n_z[1], n_z[3], fade_y);
+		return static_cast<T>(2.2) * wide::mix(n_yz0, n_yz1, fade(Pf0.x));
+	}
+
+	template<bool Gradient, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin_packet(wide::vec<4, T, N> const& Pi0, wide::vec<4, T, N> const& Pi1, wide::vec<4, T, N> const& Pf0, wide::vec<4, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+
+		wide::vec<4, T, N> const Pf1 = Pf0 - static_cast<T>(1);
+		scalar_type const ix[2] = {permute(Pi0.x), permute(Pi1.x)};
+		scalar_type ixy[4];
+		for(int c = 0; c < 4; ++c)
+			ixy[c] = permute(ix[c & 1] + (c & 2 ? Pi1.y : Pi0.y));
+		scalar_type ixyz[8];
+		for(int c = 0; c < 8; ++c)
+			ixyz[c] = permute(ixy[c & 3] + (c & 4 ? Pi1.z : Pi0.z));
+
+		scalar_type n[16];
+		wide::vec<4, T, N> g[Gradient ? 16 : 1];
+		for(int c = 0; c < 16; ++c)
+		{
+			scalar_type const ixyzw = permute(ixyz[c & 7] + (c & 8 ? Pi1.w : Pi0.w));
+
+			scalar_type gx = ixyzw / static_cast<T>(7);
+			scalar_type gy = wide::floor(gx) / static_cast<T>(7);
+			scalar_type gz = wide::floor(gy) / static_cast<T>(6);
+			gx = wide::fract(gx) - static_cast<T>(0.5);
+			gy = wide::fract(gy) - static_cast<T>(0.5);
+			gz = wide::fract(gz) - static_cast<T>(0.5);
+			scalar_type const gw = static_cast<T>(0.75) - wide::abs(gx) - wide::abs(gy) - wide::abs(gz);
+			scalar_type const sw = noise_step(gw, static_cast<T>(0));
+			gx -= sw * (noise_step(static_cast<T>(0), gx) - static_cast<T>(0.5));
+			gy -= sw * (noise_step(static_cast<T>(0), gy) - static_cast<T>(0.5));
+
+			scalar_type const norm = taylorInvSqrt(gx * gx + gy * gy + gz * gz + gw * gw);
+			n[c] = norm * (
+				gx * (c & 1 ? Pf1.x : Pf0.x) + gy * (c & 2 ? Pf1.y : Pf0.y) +
+				gz * (c & 4 ? Pf1.z : Pf0.z) + gw * (c & 8 ? Pf1.w : Pf0.w));
+			if constexpr(Gradient)
+				g[c] = wide::vec<4, T, N>(norm * gx, norm * gy, norm * gz, norm * gw);
+		}
+
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(2.2) * perlin_gradient(n, g, Pf0);
+
+		scalar_type const fade_w = fade(Pf0.w);
+		scalar_type const fade_z = fade(Pf0.z);
+		scalar_type const fade_y = fade(Pf0.y);
+		scalar_type n_w[8];
+		for(int c = 0; c < 8; ++c)
+			n_w[c] = wide::mix(n[c], n[c + 8], fade_w);
+		scalar_type n_zw[4];
+		for(int c = 0; c < 4; ++c)
+			n_zw[c] = wide::mix(n_w[c], n_w[c + 4], fade_z);
+		scalar_type const n_yzw0 = wide::mix(n_zw[0], n_zw[2], fade_y);
+		scalar_type const n_yzw1 = wide::mix(n_zw[1], n_zw[3], fade_y);
+		return static_cast<T>(2.2) * wide::mix(n_yzw0, n_yzw1, fade(Pf0.x));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::vec<4, T, N> grad4(wide::scalar<T, N> const& j)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+
+		T const ip[3] = {static_cast<T>(1) / static_cast<T>(294), static_cast<T>(1) / static_cast<T>(49), static_cast<T>(1) / static_cast<T>(7)};
+
+		wide::vec<4, T, N> p;
+		for(length_t c = 0; c < 3; ++c)
+			p[c] = wide::floor(wide::fract(j * ip[c]) * static_cast<T>(7)) * ip[2] - static_cast<T>(1);
+		p.w = static_cast<T>(1.5) - (wide::abs(p.x) + wide::abs(p.y) + wide::abs(p.z));
+
+		scalar_type const Zero(static_cast<T>(0));
+		scalar_type const One(static_cast<T>(1));
+		scalar_type const sw = wide::select(p.w < static_cast<T>(0), One, Zero);
+		for(length_t c = 0; c < 3; ++c)
+			p[c] += (wide::select(p[c] < static_cast<T>(0), One, Zero) * static_cast<T>(2) - static_cast<T>(1)) * sw;
+		return p;
+	}
+}//namespace detail
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<2, T, N> const& Position)
+	{
+		wide::vec<2, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<false>(
+			detail::noise_mod(Pi, static_cast<T>(289)),
+			detail::noise_mod(Pi + static_cast<T>(1), static_cast<T>(289)),
+			wide::fract(Position), static_cast<wide::vec<2, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<3, T, N> const& Position)
+	{
+		wide::vec<3, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<false, false>(detail::mod289(Pi), detail::mod289(Pi + static_cast<T>(1)), wide::fract(Position), static_cast<wide::vec<3, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<4, T, N> const& Position)
+	{
+		wide::vec<4, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<false>(
+			detail::noise_mod(Pi, static_cast<T>(289)),
+			detail::noise_mod(Pi + static_cast<T>(1), static_cast<T>(289)),
+			wide::fract(Position), static_cast<wide::vec<4, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<2, T, N> const& Position, wide::vec<2, T, N> const& rep)
+	{
+		wide::vec<2, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<false>(
+			detail::noise_mod(detail::noise_mod(Pi, rep), static_cast<T>(289)),
+			detail::noise_mod(detail::noise_mod(Pi + static_cast<T>(1), rep), static_cast<T>(289)),
+			wide::fract(Position), static_cast<wide::vec<2, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<3, T, N> const& Position, wide::vec<3, T, N> const& rep)
+	{
+		wide::vec<3, T, N> const Pi0 = detail::noise_mod(wide::floor(Position), rep);
+		wide::vec<3, T, N> const Pi1 = detail::noise_mod(Pi0 + static_cast<T>(1), rep);
+		return detail::perlin_packet<false, true>(
+			detail::noise_mod(Pi0, static_cast<T>(289)),
+			detail::noise_mod(Pi1, static_cast<T>(289)),
+			wide::fract(Position), static_cast<wide::vec<3, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlin(wide::vec<4, T, N> const& Position, wide::vec<4, T, N> const& rep)
+	{
+		wide::vec<4, T, N> const Pi0 = detail::noise_mod(wide::floor(Position), rep);
+		return detail::perlin_packet<false>(Pi0, detail::noise_mod(Pi0 + static_cast<T>(1), rep), wide::fract(Position), static_cast<wide::vec<4, T, N>*>(nullptr));
+	}
+
+namespace detail
+{
+	// Each corner adds m^4 * dot(g, x) with m = max(r - dot(x, x), 0), so its
+	// gradient is m^4 * g - 8 * m^3 * dot(g, x) * x
+	template<bool Gradient, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex_packet(wide::vec<2, T, N> const& v, wide::vec<2, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+		scalar_type const Zero(static_cast<T>(0));
+		scalar_type const One(static_cast<T>(1));
+
+		T const Cx = static_cast<T>( 0.211324865405187);
+		T const Cy = static_cast<T>( 0.366025403784439);
+		T const Cz = static_cast<T>(-0.577350269189626);
+		T const Cw = static_cast<T>( 0.024390243902439);
+
+		// First corner
+		wide::vec<2, T, N> i = wide::floor(v + (v.x * Cy + v.y * Cy));
+		wide::vec<2, T, N> const x0 = v - i + (i.x * Cx + i.y * Cx);
+
+		// Other corners
+		scalar_type const i1x = wide::select(x0.x > x0.y, One, Zero);
+		scalar_type const i1y = static_cast<T>(1) - i1x;
+		wide::vec<2, T, N> const x[3] = {
+			x0,
+			wide::vec<2, T, N>(x0.x + Cx - i1x, x0.y + Cx - i1y),
+			wide::vec<2, T, N>(x0.x + Cz, x0.y + Cz)};
+
+		// Permutations
+		i = detail::noise_mod(i, static_cast<T>(289));
+		scalar_type const ox[3] = {Zero, i1x, One};
+		scalar_type const oy[3] = {Zero, i1y, One};
+
+		scalar_type Result(static_cast<T>(0));
+		wide::vec<2, T, N> Slope(Zero);
+		for(int c = 0; c < 3; ++c)
+		{
+			scalar_type const p = detail::permute(detail::permute(i.y + oy[c]) + i.x + ox[c]);
+
+			scalar_type const m1 = wide::max(static_cast<T>(0.5) - wide::dot(x[c], x[c]), Zero);
+			scalar_type const m2 = m1 * m1;
+			scalar_type const m4 = m2 * m2;
+
+			// Gradients: 41 points uniformly over a line, mapped onto a diamond
+			scalar_type const gx = static_cast<T>(2) * wide::fract(p * Cw) - static_cast<T>(1);
+			scalar_type const h = wide::abs(gx) - static_cast<T>(0.5);
+			scalar_type const a0 = gx - wide::floor(gx + static_cast<T>(0.5));
+
+			scalar_type const norm = static_cast<T>(1.79284291400159) - static_cast<T>(0.85373472095314) * (a0 * a0 + h * h);
+			Result += m4 * norm * (a0 * x[c].x + h * x[c].y);
+			if constexpr(Gradient)
+			{
+				wide::vec<2, T, N> const g(norm * a0, norm * h);
+				Slope += m4 * g - (static_cast<T>(8) * m2 * m1 * wide::dot(g, x[c])) * x[c];
+			}
+		}
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(130) * Slope;
+		return static_cast<T>(130) * Result;
+	}
+
+	template<bool Gradient, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex_packet(wide::vec<3, T, N> const& v, wide::vec<3, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+		scalar_type const Zero(static_cast<T>(0));
+		scalar_type const One(static_cast<T>(1));
+
+		T const Cx = static_cast<T>(1.0 / 6.0);
+		T const Cy = static_cast<T>(1.0 / 3.0);
+
+		// First corner
+		wide::vec<3, T, N> i = wide::floor(v + (v.x * Cy + v.y * Cy + v.z * Cy));
+		wide::vec<3, T, N> const x0 = v - i + (i.x * Cx + i.y * Cx + i.z * Cx);
+
+		// Other corners
+		wide::vec<3, T, N> const g(
+			wide::select(x0.x < x0.y, Zero, One),
+			wide::select(x0.y < x0.z, Zero, One),
+			wide::select(x0.z < x0.x, Zero, One));
+		wide::vec<3, T, N> const l = wide::vec<3, T, N>(One) - g;
+		wide::vec<3, T, N> const i1(wide::min(g.x, l.z), wide::min(g.y, l.x), wide::min(g.z, l.y));
+		wide::vec<3, T, N> const i2(wide::max(g.x, l.z), wide::max(g.y, l.x), wide::max(g.z, l.y));
+
+		wide::vec<3, T, N> const x[4] = {
+			x0,
+			x0 - i1 + Cx,
+			x0 - i2 + Cy,
+			x0 - static_cast<T>(0.5)};
+
+		// Permutations
+		i = detail::mod289(i);
+		wide::vec<3, T, N> const o[4] = {
+			wide::vec<3, T, N>(Zero),
+			i1,
+			i2,
+			wide::vec<3, T, N>(One)};
+
+		// Gradients: 7x7 points over a square, mapped onto an octahedron
+		T const n_ = static_cast<T>(0.142857142857); // 1.0/7.0
+		T const ns_x = n_ * static_cast<T>(2);
+		T const ns_y = n_ * static_cast<T>(0.5) - static_cast<T>(1);
+		T const ns_z = n_;
+
+		scalar_type Result(static_cast<T>(0));
+		wide::vec<3, T, N> Slope(Zero);
+		for(int c = 0; c < 4; ++c)
+		{
+			scalar_type const p = detail::permute(detail::permute(detail::permute(
+				i.z + o[c].z) + i.y + o[c].y) + i.x + o[c].x);
+
+			scalar_type const j = p - static_cast<T>(49) * wide::floor(p * ns_z * ns_z); // mod(p,7*7)
+			scalar_type const x_ = wide::floor(j * ns_z);
+			scalar_type const y_ = wide::floor(j - static_cast<T>(7) * x_); // mod(j,N)
+
+			scalar_type const gx = x_ * ns_x + ns_y;
+			scalar_type const gy = y_ * ns_x + ns_y;
+			scalar_type const h = static_cast<T>(1) - wide::abs(gx) - wide::abs(gy);
+
+			scalar_type const sh = -detail::noise_step(h, static_cast<T>(0));
+			wide::vec<3, T, N> const grad(
+				gx + (wide::floor(gx) * static_cast<T>(2) + static_cast<T>(1)) * sh,
+				gy + (wide::floor(gy) * static_cast<T>(2) + static_cast<T>(1)) * sh,
+				h);
+
+			scalar_type const m1 = wide::max(static_cast<T>(0.6) - wide::dot(x[c], x[c]), Zero);
+			scalar_type const m2 = m1 * m1;
+			scalar_type const norm = detail::taylorInvSqrt(wide::dot(grad, grad));
+			Result += m2 * m2 * (norm * wide::dot(grad, x[c]));
+			if constexpr(Gradient)
+			{
+				wide::vec<3, T, N> const g = grad * norm;
+				Slope += (m2 * m2) * g - (static_cast<T>(8) * m2 * m1 * wide::dot(g, x[c])) * x[c];
+			}
+		}
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(42) * Slope;
+		return static_cast<T>(42) * Result;
+	}
+
+	template<bool Gradient, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex_packet(wide::vec<4, T, N> const& v, wide::vec<4, T, N>* Grad)
+	{
+		typedef wide::scalar<T, N> scalar_type;
+		scalar_type const Zero(static_cast<T>(0));
+		scalar_type const One(static_cast<T>(1));
+
+		T const Cx = static_cast<T>( 0.138196601125011); // (5 - sqrt(5))/20  G4
+		T const Cy = static_cast<T>( 0.276393202250021); // 2 * G4
+		T const Cz = static_cast<T>( 0.414589803375032); // 3 * G4
+		T const Cw = static_cast<T>(-0.447213595499958); // -1 + 4 * G4
+		T const F4 = static_cast<T>(0.309016994374947451);
+
+		// First corner
+		wide::vec<4, T, N> i = wide::floor(v + (v.x * F4 + v.y * F4 + v.z * F4 + v.w * F4));
+		wide::vec<4, T, N> const x0 = v - i + (i.x * Cx + i.y * Cx + i.z * Cx + i.w * Cx);
+
+		// Other corners: rank sorting, i0 holds 0, 1, 2 and 3 once each
+		scalar_type const isX[3] = {
+			wide::select(x0.x < x0.y, Zero, One),
+			wide::select(x0.x < x0.z, Zero, One),
+			wide::select(x0.x < x0.w, Zero, One)};
+		scalar_type const isYZ[3] = {
+			wide::select(x0.y < x0.z, Zero, One),
+			wide::select(x0.y < x0.w, Zero, One),
+			wide::select(x0.z < x0.w, Zero, One)};
+
+		wide::vec<4, T, N> i0(isX[0] + isX[1] + isX[2], static_cast<T>(1) - isX[0], static_cast<T>(1) - isX[1], static_cast<T>(1) - isX[2]);
+		i0.y += isYZ[0] + isYZ[1];
+		i0.z += static_cast<T>(1) - isYZ[0];
+		i0.w += static_cast<T>(1) - isYZ[1];
+		i0.z += isYZ[2];
+		i0.w += static_cast<T>(1) - isYZ[2];
+
+		wide::vec<4, T, N> const i3 = wide::clamp(i0, Zero, One);
+		wide::vec<4, T, N> const i2 = wide::clamp(i0 - static_cast<T>(1), Zero, One);
+		wide::vec<4, T, N> const i1 = wide::clamp(i0 - static_cast<T>(2), Zero, One);
+
+		wide::vec<4, T, N> const x[5] = {
+			x0,
+			x0 - i1 + Cx,
+			x0 - i2 + Cy,
+			x0 - i3 + Cz,
+			x0 + Cw};
+
+		// Permutations
+		i = detail::noise_mod(i, static_cast<T>(289));
+		wide::vec<4, T, N> const o[5] = {
+			wide::vec<4, T, N>(Zero),
+			i1,
+			i2,
+			i3,
+			wide::vec<4, T, N>(One)};
+
+		// Gradients: 7x7x6 points over a cube, mapped onto a 4-cross polytope
+		scalar_type Result(static_cast<T>(0));
+		wide::vec<4, T, N> Slope(Zero);
+		for(int c = 0; c < 5; ++c)
+		{
+			scalar_type const j = detail::permute(detail::permute(detail::permute(detail::permute(
+				i.w + o[c].w) + i.z + o[c].z) + i.y + o[c].y) + i.x + o[c].x);
+
+			wide::vec<4, T, N> const p = detail::grad4(j);
+
+			scalar_type const m1 = wide::max(static_cast<T>(0.6) - wide::dot(x[c], x[c]), Zero);
+			scalar_type const m2 = m1 * m1;
+			scalar_type const norm = detail::taylorInvSqrt(wide::dot(p, p));
+			Result += m2 * m2 * (norm * wide::dot(p, x[c]));
+			if constexpr(Gradient)
+			{
+				wide::vec<4, T, N> const g = p * norm;
+				Slope += (m2 * m2) * g - (static_cast<T>(8) * m2 * m1 * wide::dot(g, x[c])) * x[c];
+			}
+		}
+		if constexpr(Gradient)
+			*Grad = static_cast<T>(49) * Slope;
+		return static_cast<T>(49) * Result;
+	}
+}//namespace detail
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex(wide::vec<2, T, N> const& v)
+	{
+		return detail::simplex_packet<false>(v, static_cast<wide::vec<2, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex(wide::vec<3, T, N> const& v)
+	{
+		return detail::simplex_packet<false>(v, static_cast<wide::vec<3, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplex(wide::vec<4, T, N> const& v)
+	{
+		return detail::simplex_packet<false>(v, static_cast<wide::vec<4, T, N>*>(nullptr));
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlinDerivative(wide::vec<2, T, N> const& Position, wide::vec<2, T, N>& gradient)
+	{
+		wide::vec<2, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<true>(
+			detail::noise_mod(Pi, static_cast<T>(289)),
+			detail::noise_mod(Pi + static_cast<T>(1), static_cast<T>(289)),
+			wide::fract(Position), &gradient);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlinDerivative(wide::vec<3, T, N> const& Position, wide::vec<3, T, N>& gradient)
+	{
+		wide::vec<3, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<true, false>(detail::mod289(Pi), detail::mod289(Pi + static_cast<T>(1)), wide::fract(Position), &gradient);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> perlinDerivative(wide::vec<4, T, N> const& Position, wide::vec<4, T, N>& gradient)
+	{
+		wide::vec<4, T, N> const Pi = wide::floor(Position);
+		return detail::perlin_packet<true>(
+			detail::noise_mod(Pi, static_cast<T>(289)),
+			detail::noise_mod(Pi + static_cast<T>(1), static_cast<T>(289)),
+			wide::fract(Position), &gradient);
+	}
+
+	template<length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> simplexDerivative(wide::vec<L, T, N> const& v, wide::vec<L, T, N>& gradient)
+	{
+		return detail::simplex_packet<true>(v, &gradient);
+	}
+
+	// One point is a packet of one lane
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T perlinDerivative(vec<L, T, Q> const& Position, vec<L, T, Q>& gradient)
+	{
+		wide::vec<L, T, 1> Gradient;
+		T const Result = glm::perlinDerivative(wide::vec<L, T, 1>(Position), Gradient)[0];
+		for(length_t c = 0; c < L; ++c)
+			gradient[c] = Gradient[c][0];
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T simplexDerivative(vec<L, T, Q> const& v, vec<L, T, Q>& gradient)
+	{
+		wide::vec<L, T, 1> Gradient;
+		T const Result = glm::simplexDerivative(wide::vec<L, T, 1>(v), Gradient)[0];
+		for(length_t c = 0; c < L; ++c)
+			gradient[c] = Gradient[c][0];
+		return Result;
+	}
+
+namespace detail
+{
+	// -- Fractals --
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T noise_abs(T x)
+	{
+		return x < static_cast<T>(0) ? -x : x;
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_abs(wide::scalar<T, N> const& x)
+	{
+		return wide::abs(x);
+	}
+
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_sign(wide::scalar<T, N> const& x)
+	{
+		return wide::select(x < static_cast<T>(0), wide::scalar<T, N>(static_cast<T>(-1)), wide::scalar<T, N>(static_cast<T>(1)));
+	}
+
+	template<noise_basis Basis, typename position>
+	GLM_FUNC_QUALIFIER auto noise_sample(position const& p)
+	{
+		if constexpr(Basis == noise_perlin)
+			return glm::perlin(p);
+		else
+			return glm::simplex(p);
+	}
+
+	template<noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_sample(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& Gradient)
+	{
+		if constexpr(Basis == noise_perlin)
+			return glm::perlinDerivative(p, Gradient);
+		else
+			return glm::simplexDerivative(p, Gradient);
+	}
+
+	// Calls Octave(0), ..., Octave(Octaves - 1), unrolled
+	template<typename octave, length_t... Index>
+	GLM_FUNC_QUALIFIER void noise_octaves(octave Octave, std::integer_sequence<length_t, Index...>)
+	{
+		(Octave(Index), ...);
+	}
+
+	// Octave i adds gain^i * Shape(noise(p * lacunarity^i))
+	template<length_t Octaves, noise_basis Basis, typename position, typename T, typename shape>
+	GLM_FUNC_QUALIFIER auto noise_fractal(position const& p, T lacunarity, T gain, shape Shape)
+	{
+		static_assert(Octaves > 0, "'Octaves' must be at least one");
+
+		decltype(Shape(noise_sample<Basis>(p))) Result(static_cast<T>(0));
+		T Frequency = static_cast<T>(1);
+		T Amplitude = static_cast<T>(1);
+		noise_octaves([&](length_t)
+		{
+			Result += Amplitude * Shape(noise_sample<Basis>(p * Frequency));
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}, std::make_integer_sequence<length_t, Octaves>());
+		return Result;
+	}
+
+	// By the chain rule, octave i adds gain^i * lacunarity^i * Slope(n, g) to
+	// the gradient, with n the noise and g its gradient at p * lacunarity^i,
+	// and Slope(n, g) = Shape'(n) * g
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N, typename shape, typename slope>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> noise_fractal(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& gradient, T lacunarity, T gain, shape Shape, slope Slope)
+	{
+		static_assert(Octaves > 0, "'Octaves' must be at least one");
+
+		wide::scalar<T, N> Result(static_cast<T>(0));
+		wide::vec<L, T, N> Gradient(Result);
+		T Frequency = static_cast<T>(1);
+		T Amplitude = static_cast<T>(1);
+		noise_octaves([&](length_t)
+		{
+			wide::vec<L, T, N> g;
+			wide::scalar<T, N> const n = noise_sample<Basis>(p * Frequency, g);
+			Result += Amplitude * Shape(n);
+			Gradient += (Amplitude * Frequency) * Slope(n, g);
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}, std::make_integer_sequence<length_t, Octaves>());
+		gradient = Gradient;
+		return Result;
+	}
+
+	// One point is a packet of one lane
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q, typename shape, typename slope>
+	GLM_FUNC_QUALIFIER T noise_fractal(vec<L, T, Q> const& p, vec<L, T, Q>& gradient, T lacunarity, T gain, shape Shape, slope Slope)
+	{
+		wide::vec<L, T, 1> Gradient;
+		T const Result = noise_fractal<Octaves, Basis>(wide::vec<L, T, 1>(p), Gradient, lacunarity, gain, Shape, Slope)[0];
+		for(length_t c = 0; c < L; ++c)
+			gradient[c] = Gradient[c][0];
+		return Result;
+	}
+
+	// Shapes of the octaves: n -> Shape(n), and (n, g) -> Shape'(n) * g
+	template<typename T>
+	struct noise_fbm
+	{
+		template<typename value_type>
+		GLM_FUNC_QUALIFIER value_type operator()(value_type const& n) const { return n; }
+
+		template<length_t L, length_t N>
+		GLM_FUNC_QUALIFIER wide::vec<L, T, N> operator()(wide::scalar<T, N> const&, wide::vec<L, T, N> const& g) const { return g; }
+	};
+
+	template<typename T>
+	struct noise_ridged
+	{
+		template<typename value_type>
+		GLM_FUNC_QUALIFIER value_type operator()(value_type const& n) const
+		{
+			value_type const r = static_cast<T>(1) - noise_abs(n);
+			return r * r;
+		}
+
+		template<length_t L, length_t N>
+		GLM_FUNC_QUALIFIER wide::vec<L, T, N> operator()(wide::scalar<T, N> const& n, wide::vec<L, T, N> const& g) const
+		{
+			return ((noise_abs(n) - static_cast<T>(1)) * static_cast<T>(2) * noise_sign(n)) * g;
+		}
+	};
+
+	template<typename T>
+	struct noise_billow
+	{
+		template<typename value_type>
+		GLM_FUNC_QUALIFIER value_type operator()(value_type const& n) const
+		{
+			return noise_abs(n) * static_cast<T>(2) - static_cast<T>(1);
+		}
+
+		template<length_t L, length_t N>
+		GLM_FUNC_QUALIFIER wide::vec<L, T, N> operator()(wide::scalar<T, N> const& n, wide::vec<L, T, N> const& g) const
+		{
+			return (noise_sign(n) * static_cast<T>(2)) * g;
+		}
+	};
+
+	template<typename T>
+	struct noise_turbulence
+	{
+		template<typename value_type>
+		GLM_FUNC_QUALIFIER value_type operator()(value_type const& n) const
+		{
+			return noise_abs(n);
+		}
+
+		template<length_t L, length_t N>
+		GLM_FUNC_QUALIFIER wide::vec<L, T, N> operator()(wide::scalar<T, N> const& n, wide::vec<L, T, N> const& g) const
+		{
+			return noise_sign(n) * g;
+		}
+	};
+
+	// p + amplitude * (fbm(p), fbm(p + 5.2), ...)
+	template<length_t Octaves, noise_basis Basis, typename position, typename T>
+	GLM_FUNC_QUALIFIER position noise_warp(position const& p, T amplitude, T lacunarity, T gain)
+	{
+		position Result(p);
+		for(length_t c = 0; c < position::length(); ++c)
+			Result[c] += amplitude * noise_fractal<Octaves, Basis>(p + static_cast<T>(c) * static_cast<T>(5.2), lacunarity, gain, noise_fbm<T>());
+		return Result;
+	}
+}//namespace detail
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T fbm(vec<L, T, Q> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_fbm<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T fbm(vec<L, T, Q> const& p, vec<L, T, Q>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_fbm<T>(), detail::noise_fbm<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> fbm(wide::vec<L, T, N> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_fbm<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> fbm(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_fbm<T>(), detail::noise_fbm<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T ridged(vec<L, T, Q> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_ridged<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T ridged(vec<L, T, Q> const& p, vec<L, T, Q>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_ridged<T>(), detail::noise_ridged<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> ridged(wide::vec<L, T, N> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_ridged<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> ridged(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_ridged<T>(), detail::noise_ridged<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T billow(vec<L, T, Q> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_billow<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T billow(vec<L, T, Q> const& p, vec<L, T, Q>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_billow<T>(), detail::noise_billow<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> billow(wide::vec<L, T, N> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_billow<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> billow(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_billow<T>(), detail::noise_billow<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T turbulence(vec<L, T, Q> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_turbulence<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T turbulence(vec<L, T, Q> const& p, vec<L, T, Q>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_turbulence<T>(), detail::noise_turbulence<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> turbulence(wide::vec<L, T, N> const& p, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, lacunarity, gain, detail::noise_turbulence<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::scalar<T, N> turbulence(wide::vec<L, T, N> const& p, wide::vec<L, T, N>& gradient, T lacunarity, T gain)
+	{
+		return detail::noise_fractal<Octaves, Basis>(p, gradient, lacunarity, gain, detail::noise_turbulence<T>(), detail::noise_turbulence<T>());
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> warp(vec<L, T, Q> const& p, T amplitude, T lacunarity, T gain)
+	{
+		return detail::noise_warp<Octaves, Basis>(p, amplitude, lacunarity, gain);
+	}
+
+	template<length_t Octaves, noise_basis Basis, length_t L, typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::vec<L, T, N> warp(wide::vec<L, T, N> const& p, T amplitude, T lacunarity, T gain)
+	{
+		return detail::noise_warp<Octaves, Basis>(p, amplitude, lacunarity, gain);
+	}
+
+namespace detail
+{
+	// Points per packet of the bulk functions: one __m256 with AVX, one __m128
+	// with SSE2; array lanes are no faster than the scalar functions, which
+	// take one point at a time otherwise
+	template<typename T>
+	struct noise_lanes
+	{
+		static constexpr length_t value = 1;
+	};
+
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+	template<>
+	struct noise_lanes<float>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			static constexpr length_t value = 8;
+#		else
+			static constexpr length_t value = 4;
+#		endif
+	};
+#	endif
+
+	// perlin(p, rep) of a point or of a packet
+	template<length_t L, typename T, qualifier Q>
+	struct noise_periodic
+	{
+		typedef wide::vec<L, T, noise_lanes<T>::value> packet_type;
+
+		vec<L, T, Q> rep;
+		packet_type packet_rep;
+
+		GLM_FUNC_QUALIFIER explicit noise_periodic(vec<L, T, Q> const& Rep) : rep(Rep), packet_rep(Rep) {}
+
+		GLM_FUNC_QUALIFIER T operator()(vec<L, T, Q> const& p) const { return glm::perlin(p, rep); }
+		GLM_FUNC_QUALIFIER typename packet_type::value_type operator()(packet_type const& p) const { return glm::perlin(p, packet_rep); }
+	};
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_QUALIFIER void noise_points(vec<L, T, Q> const* in, T* out, std::size_t count, kernel Kernel)
+	{
+		constexpr length_t N = noise_lanes<T>::value;
+
+		if constexpr(N == 1)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = Kernel(in[i]);
+		}
+		else
+		{
+			std::size_t i = 0;
+			for(; i + N <= count; i += N)
+				Kernel(wide::gather<N>(in + i)).store(out + i);
+
+			// Partial packet: the missing lanes evaluate the origin
+			if(i < count)
+			{
+				T Lanes[N];
+				Kernel(wide::gather<N>(in + i, count - i)).store(Lanes);
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Lanes[j];
+			}
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_QUALIFIER void noise_grid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out, kernel Kernel)
+	{
+		constexpr length_t N = noise_lanes<T>::value;
+
+		std::size_t Rows = 1;
+		for(length_t c = 0; c < L; ++c)
+		{
+			assert(size[c] >= 0);
+			if(c > 0)
+				Rows *= static_cast<std::size_t>(size[c]);
+		}
+		std::size_t const Width = static_cast<std::size_t>(size.x);
+
+		for(std::size_t Row = 0; Row < Rows; ++Row, out += Width)
+		{
+			// The other coordinates are the same for the whole row
+			vec<L, T, Q> p(origin);
+			std::size_t Index = Row;
+			for(length_t c = 1; c < L; ++c)
+			{
+				std::size_t const Extent = static_cast<std::size_t>(size[c]);
+				p[c] = origin[c] + static_cast<T>(Index % Extent) * spacing[c];
+				Index /= Extent;
+			}
+
+			if constexpr(N == 1)
+			{
+				for(std::size_t x = 0; x < Width; ++x)
+				{
+					p.x = origin.x + static_cast<T>(x) * spacing.x;
+					out[x] = Kernel(p);
+				}
+			}
+			else
+			{
+				T Ramp[N];
+				for(length_t l = 0; l < N; ++l)
+					Ramp[l] = static_cast<T>(l);
+				wide::scalar<T, N> const Lane = wide::scalar<T, N>::load(Ramp);
+
+				wide::vec<L, T, N> Packet(p);
+				std::size_t x = 0;
+				for(; x + N <= Width; x += N)
+				{
+					Packet.x = origin.x + (static_cast<T>(x) + Lane) * spacing.x;
+					Kernel(Packet).store(out + x);
+				}
+
+				if(x < Width)
+				{
+					Packet.x = origin.x + (static_cast<T>(x) + Lane) * spacing.x;
+					T Lanes[N];
+					Kernel(Packet).store(Lanes);
+					for(std::size_t j = 0; x + j < Width; ++j)
+						out[x + j] = Lanes[j];
+				}
+			}
+		}
+	}
+}//namespace detail
+
+namespace batch
+{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* in, T* out, std::size_t count)
+	{
+		detail::noise_points(in, out, count, [](auto const& p){ return glm::perlin(p); });
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec<L, T, Q> const* in, vec<L, T, Q> const& rep, T* out, std::size_t count)
+	{
+		detail::noise_points(in, out, count, detail::noise_periodic<L, T, Q>(rep));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec<L, T, Q> const* in, T* out, std::size_t count)
+	{
+		detail::noise_points(in, out, count, [](auto const& p){ return glm::simplex(p); });
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out)
+	{
+		detail::noise_grid(origin, spacing, size, out, [](auto const& p){ return glm::perlin(p); });
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, vec<L, T, Q> const& rep, T* out)
+	{
+		detail::noise_grid(origin, spacing, size, out, detail::noise_periodic<L, T, Q>(rep));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out)
+	{
+		detail::noise_grid(origin, spacing, size, out, [](auto const& p){ return glm::simplex(p); });
+	}
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_QUALIFIER void noise(vec<L, T, Q> const* in, T* out, std::size_t count, kernel Kernel)
+	{
+		detail::noise_points(in, out, count, Kernel);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_QUALIFIER void noiseGrid(vec<L, T, Q> const& origin, vec<L, T, Q> const& spacing, vec<L, int, defaultp> const& size, T* out, kernel Kernel)
+	{
+		detail::noise_grid(origin, spacing, size, out, Kernel);
+	}
+
+#	if GLM_HAS_SPAN
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(std::span<vec<L, T, Q> const> in, std::span<T> out)
+	{
+		assert(in.size() == out.size());
+		glm::batch::perlin(in.data(), out.data(), in.size());
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(std::span<vec<L, T, Q> const> in, std::type_identity_t<vec<L, T, Q> > const& rep, std::span<T> out)
+	{
+		assert(in.size() == out.size());
+		glm::batch::perlin(in.data(), rep, out.data(), in.size());
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(std::span<vec<L, T, Q> const> in, std::span<T> out)
+	{
+		assert(in.size() == out.size());
+		glm::batch::simplex(in.data(), out.data(), in.size());
+	}
+
+	template<length_t L, typename T, qualifier Q, typename kernel>
+	GLM_FUNC_QUALIFIER void noise(std::span<vec<L, T, Q> const> in, std::span<T> out, kernel Kernel)
+	{
+		assert(in.size() == out.size());
+		glm::batch::noise(in.data(), out.data(), in.size(), Kernel);
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
 }//namespace glm
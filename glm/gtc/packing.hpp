@@ -16,6 +16,12 @@
 // Dependency:
 #include "type_precision.hpp"
 #include "../ext/vector_packing.hpp"
+#include "../packing.hpp"
+#include "../ext/quaternion_float.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -470,6 +476,106 @@ namespace glm
 	/// @see uint32 packF3x9_E1x5(vec3 const& v)
 	GLM_FUNC_DECL vec3 unpackF3x9_E1x5(uint32 p);
 
+	/// Encodes a direction with the octahedral mapping into two 8-bit signed
+	/// normalized values, x in the least significant bits.
+	///
+	/// The direction is projected on the octahedron |x| + |y| + |z| = 1 and the
+	/// lower hemisphere folded over the diagonals of the xy square, so v needs
+	/// not be normalized but must not be null. The largest error is about 1 degree
+	/// with 16 bits, 0.06 with 24 and 0.004 with 32.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral16(uint16 p)
+	/// @see uint32 packOctahedral24(vec3 const& v)
+	/// @see uint32 packOctahedral32(vec3 const& v)
+	GLM_FUNC_DECL uint16 packOctahedral16(vec3 const& v);
+
+	/// Decodes a direction encoded by packOctahedral16; the result is normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packOctahedral16(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOctahedral16(uint16 p);
+
+	/// Encodes a direction with the octahedral mapping into two 12-bit signed
+	/// normalized values in the 24 least significant bits, x first.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral24(uint32 p)
+	/// @see uint16 packOctahedral16(vec3 const& v)
+	GLM_FUNC_DECL uint32 packOctahedral24(vec3 const& v);
+
+	/// Decodes a direction encoded by packOctahedral24; the result is normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral24(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOctahedral24(uint32 p);
+
+	/// Encodes a direction with the octahedral mapping into two 16-bit signed
+	/// normalized values, x in the least significant bits.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOctahedral32(uint32 p)
+	/// @see uint16 packOctahedral16(vec3 const& v)
+	GLM_FUNC_DECL uint32 packOctahedral32(vec3 const& v);
+
+	/// Decodes a direction encoded by packOctahedral32; the result is normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOctahedral32(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOctahedral32(uint32 p);
+
+	/// Compresses a unit quaternion into 32 bits with the smallest three encoding.
+	///
+	/// The component of largest magnitude is dropped and its index stored in the
+	/// 2 most significant bits; q is negated if needed so that the dropped
+	/// component is positive, which represents the same rotation. The three
+	/// others lie in [-1/sqrt(2), 1/sqrt(2)] and are stored as 10-bit signed
+	/// normalized values over that range, in x, y, z, w order from the least
+	/// significant bits. The largest error of a component is about 2e-3.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuat32(uint32 p)
+	/// @see uint64 packQuat48(quat const& q)
+	/// @see uint64 packQuat64(quat const& q)
+	GLM_FUNC_DECL uint32 packQuat32(quat const& q);
+
+	/// Decompresses a quaternion compressed by packQuat32. The dropped component
+	/// is rebuilt from the unit norm, so the result is normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packQuat32(quat const& q)
+	GLM_FUNC_DECL quat unpackQuat32(uint32 p);
+
+	/// Compresses a unit quaternion into the 48 least significant bits with the
+	/// smallest three encoding: three 15-bit components then the 2-bit index.
+	/// The largest error of a component is about 6e-5.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuat48(uint64 p)
+	/// @see uint32 packQuat32(quat const& q)
+	GLM_FUNC_DECL uint64 packQuat48(quat const& q);
+
+	/// Decompresses a quaternion compressed by packQuat48.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQuat48(quat const& q)
+	GLM_FUNC_DECL quat unpackQuat48(uint64 p);
+
+	/// Compresses a unit quaternion into 64 bits with the smallest three
+	/// encoding: three 20-bit components then the 2-bit index.
+	/// The largest error of a component is about 2e-6.
+	///
+	/// @see gtc_packing
+	/// @see quat unpackQuat64(uint64 p)
+	/// @see uint32 packQuat32(quat const& q)
+	GLM_FUNC_DECL uint64 packQuat64(quat const& q);
+
+	/// Decompresses a quaternion compressed by packQuat64.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQuat64(quat const& q)
+	GLM_FUNC_DECL quat unpackQuat64(uint64 p);
+
 	/// Returns an unsigned integer vector obtained by converting the components of a floating-point vector
 	/// to the 16-bit floating-point representation found in the OpenGL Specification.
 	/// The first vector component specifies the 16 least-significant bits of the result;
@@ -512,6 +618,74 @@ namespace glm
 	template<length_t L, qualifier Q>
 	GLM_FUNC_DECL vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& p);
 
+	/// Converts count floats to 16-bit floating-point values, rounding to nearest even.
+	/// Uses F16C when the build enables it (8 values per instruction with AVX) and an
+	/// SSE2 bit manipulation otherwise; NaN may lose its payload.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	GLM_FUNC_DISCARD_DECL void packHalf(float const* in, uint16* out, std::size_t count);
+
+	/// Converts count 16-bit floating-point values to floats. The conversion is exact.
+	///
+	/// @see gtc_packing
+	/// @see void packHalf(float const* in, uint16* out, std::size_t count)
+	GLM_FUNC_DISCARD_DECL void unpackHalf(uint16 const* in, float* out, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overloads; in and out must have the same size.
+	GLM_FUNC_DISCARD_DECL void packHalf(std::span<float const> in, std::span<uint16> out);
+	GLM_FUNC_DISCARD_DECL void unpackHalf(std::span<uint16 const> in, std::span<float> out);
+#	endif//GLM_HAS_SPAN
+
+	/// Strided array forms of the packed formats above, for converting vertex
+	/// attributes in bulk: count values are read every inStride bytes from in
+	/// and written every outStride bytes to out, so interleaved vertex buffers
+	/// work directly; the default strides are tightly packed arrays. in and out
+	/// must not overlap.
+	///
+	/// The results are those of the per-element functions, bit for bit; the
+	/// octahedral and quaternion decoders may differ in the last bit where the
+	/// compiler contracts their sums of squares into FMA. With SIMD enabled the
+	/// conversions run 4 elements per step with SSE2 and 8 with AVX2; NaN inputs
+	/// to the normalized formats are undefined, as for the per-element functions.
+	///
+	/// @see gtc_packing
+	GLM_FUNC_DISCARD_DECL void packUnorm4x8(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x8(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packSnorm4x8(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x8(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packUnorm2x16(vec2 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec2), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackUnorm2x16(uint32 const* in, vec2* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec2));
+	GLM_FUNC_DISCARD_DECL void packSnorm2x16(vec2 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec2), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackSnorm2x16(uint32 const* in, vec2* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec2));
+	GLM_FUNC_DISCARD_DECL void packUnorm4x16(vec4 const* in, uint64* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint64));
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x16(uint64 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint64), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packSnorm4x16(vec4 const* in, uint64* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint64));
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x16(uint64 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint64), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packUnorm3x10_1x2(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackUnorm3x10_1x2(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packSnorm3x10_1x2(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec4), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackSnorm3x10_1x2(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec4));
+	GLM_FUNC_DISCARD_DECL void packUnorm1x5_1x6_1x5(vec3 const* in, uint16* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint16));
+	GLM_FUNC_DISCARD_DECL void unpackUnorm1x5_1x6_1x5(uint16 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint16), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packF2x11_1x10(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackF2x11_1x10(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packF3x9_E1x5(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackF3x9_E1x5(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packOctahedral16(vec3 const* in, uint16* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint16));
+	GLM_FUNC_DISCARD_DECL void unpackOctahedral16(uint16 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint16), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packOctahedral24(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackOctahedral24(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packOctahedral32(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(vec3), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackOctahedral32(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(vec3));
+	GLM_FUNC_DISCARD_DECL void packQuat32(quat const* in, uint32* out, std::size_t count, std::size_t inStride = sizeof(quat), std::size_t outStride = sizeof(uint32));
+	GLM_FUNC_DISCARD_DECL void unpackQuat32(uint32 const* in, quat* out, std::size_t count, std::size_t inStride = sizeof(uint32), std::size_t outStride = sizeof(quat));
+	GLM_FUNC_DISCARD_DECL void packQuat48(quat const* in, uint64* out, std::size_t count, std::size_t inStride = sizeof(quat), std::size_t outStride = sizeof(uint64));
+	GLM_FUNC_DISCARD_DECL void unpackQuat48(uint64 const* in, quat* out, std::size_t count, std::size_t inStride = sizeof(uint64), std::size_t outStride = sizeof(quat));
+	GLM_FUNC_DISCARD_DECL void packQuat64(quat const* in, uint64* out, std::size_t count, std::size_t inStride = sizeof(quat), std::size_t outStride = sizeof(uint64));
+	GLM_FUNC_DISCARD_DECL void unpackQuat64(uint64 const* in, quat* out, std::size_t count, std::size_t inStride = sizeof(uint64), std::size_t outStride = sizeof(quat));
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
@@ -8,6 +8,8 @@
 #include "../vec4.hpp"
 #include "../detail/type_half.hpp"
 #include "type_ptr.hpp"
+#include <cassert>
+#include <cstddef>
 #include <cstring>
 #include <limits>
 
@@ -134,9 +136,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 11) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 6))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed11ToFloat(x);
 
@@ -164,9 +166,9 @@ namespace detail
 		if(x == 0)
 			return 0.0f;
 		else if(x == ((1 << 10) - 1))
-			return ~0;//NaN
+			return std::numeric_limits<float>::quiet_NaN();
 		else if(x == (0x1f << 5))
-			return ~0;//Inf
+			return std::numeric_limits<float>::infinity();
 
 		uint Result = packed10ToFloat(x);
 
@@ -285,12 +287,12 @@ namespace detail
 		uint32 pack;
 	};
 
-	template<length_t L, qualifier Q>
+	template<length_t L, qualifier Q, bool UseSimd>
 	struct compute_half
 	{};
 
-	template<qualifier Q>
-	struct compute_half<1, Q>
+	template<qualifier Q, bool UseSimd>
+	struct compute_half<1, Q, UseSimd>
 	{
 		GLM_FUNC_QUALIFIER static vec<1, uint16, Q> pack(vec<1, float, Q> const& v)
 		{
@@ -308,8 +310,8 @@ namespace detail
 		}
 	};
 
-	template<qualifier Q>
-	struct compute_half<2, Q>
+	template<qualifier Q, bool UseSimd>
+	struct compute_half<2, Q, UseSimd>
 	{
 		GLM_FUNC_QUALIFIER static vec<2, uint16, Q> pack(vec<2, float, Q> const& v)
 		{
@@ -327,8 +329,8 @@ namespace detail
 		}
 	};
 
-	template<qualifier Q>
-	struct compute_half<3, Q>
+	template<qualifier Q, bool UseSimd>
+	struct compute_half<3, Q, UseSimd>
 	{
 		GLM_FUNC_QUALIFIER static vec<3, uint16, Q> pack(vec<3, float, Q> const& v)
 		{
@@ -346,8 +348,8 @@ namespace detail
 		}
 	};
 
-	template<qualifier Q>
-	struct compute_half<4, Q>
+	template<qualifier Q, bool UseSimd>
+	struct compute_half<4, Q, UseSimd>
 	{
 		GLM_FUNC_QUALIFIER static vec<4, uint16, Q> pack(vec<4, float, Q> const& v)
 		{
@@ -364,7 +366,266 @@ namespace detail
 			return vec<4, float, Q>(detail::toFloat32(Unpack.x), detail::toFloat32(Unpack.y), detail::toFloat32(Unpack.z), detail::toFloat32(Unpack.w));
 		}
 	};
+
+	template<bool UseSimd>
+	struct compute_half_array
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* in, uint16* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				int16 const Half(detail::toFloat16(in[i]));
+				memcpy(out + i, &Half, sizeof(Half));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* in, float* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				int16 Half = 0;
+				memcpy(&Half, in + i, sizeof(Half));
+				out[i] = detail::toFloat32(Half);
+			}
+		}
+	};
+
+	// Octahedral map of a direction to [-1, 1]^2, the lower hemisphere folded
+	// over the diagonals
+	GLM_FUNC_QUALIFIER vec2 octahedral_encode(vec3 const& v)
+	{
+		vec2 const p = vec2(v.x, v.y) / (abs(v.x) + abs(v.y) + abs(v.z));
+		if(v.z >= 0.0f)
+			return p;
+		return (1.0f - abs(vec2(p.y, p.x))) * vec2(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 octahedral_decode(vec2 const& p)
+	{
+		vec3 v(p.x, p.y, 1.0f - abs(p.x) - abs(p.y));
+		float const t = max(-v.z, 0.0f);
+		v.x += v.x >= 0.0f ? -t : t;
+		v.y += v.y >= 0.0f ? -t : t;
+		return v * (1.0f / sqrt(v.x * v.x + v.y * v.y + v.z * v.z));
+	}
+
+	// Sign extended field of Bits bits at Shift
+	GLM_FUNC_QUALIFIER int packed_signed_bits(uint64 p, int Shift, int Bits)
+	{
+		return static_cast<int>(static_cast<int64>(p << (64 - Shift - Bits)) >> (64 - Bits));
+	}
+
+	// Smallest three quaternion encoding: the three components other than the
+	// largest, scaled from [-1/sqrt(2), 1/sqrt(2)] to Bits-bit signed normalized
+	// values, and the index of the largest in w
+	template<int Bits>
+	GLM_FUNC_QUALIFIER ivec4 quat_smallest_three_encode(quat const& q)
+	{
+		vec4 const v(q.x, q.y, q.z, q.w);
+		vec4 const a(abs(v));
+		int Index = 0;
+		for(int i = 1; i < 4; ++i)
+			if(a[i] > a[Index])
+				Index = i;
+
+		float const Sign = v[Index] < 0.0f ? -1.0f : 1.0f;
+		float const Scale = static_cast<float>((1 << (Bits - 1)) - 1);
+		ivec4 Result(0, 0, 0, Index);
+		for(int i = 0, j = 0; i < 4; ++i)
+			if(i != Index)
+				Result[j++] = static_cast<int>(round(clamp(v[i] * Sign * 1.41421356237309504880168872420969808f, -1.0f, 1.0f) * Scale));
+		return Result;
+	}
+
+	template<int Bits>
+	GLM_FUNC_QUALIFIER quat quat_smallest_three_decode(ivec4 const& Fields)
+	{
+		float const Scale = 1.0f / static_cast<float>((1 << (Bits - 1)) - 1);
+		vec3 const c(clamp(vec3(Fields) * Scale, -1.0f, 1.0f) * 0.707106781186547524400844362104849039f);
+		float const Largest = sqrt(max(1.0f - c.x * c.x - c.y * c.y - c.z * c.z, 0.0f));
+
+		int const Index = Fields.w;
+		vec4 v;
+		for(int i = 0, j = 0; i < 4; ++i)
+			v[i] = i == Index ? Largest : c[j++];
+		return quat::wxyz(v.w, v.x, v.y, v.z);
+	}
+
+	// Formats of the strided array converters: the element and packed types and
+	// the per-element functions, which the SIMD kernels reproduce bit for bit
+	struct packed_unorm4x8
+	{
+		typedef vec4 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const& v) { return packUnorm4x8(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 p) { return unpackUnorm4x8(p); }
+	};
+
+	struct packed_snorm4x8
+	{
+		typedef vec4 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const& v) { return packSnorm4x8(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 p) { return unpackSnorm4x8(p); }
+	};
+
+	struct packed_unorm2x16
+	{
+		typedef vec2 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec2 const& v) { return packUnorm2x16(v); }
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint32 p) { return unpackUnorm2x16(p); }
+	};
+
+	struct packed_snorm2x16
+	{
+		typedef vec2 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec2 const& v) { return packSnorm2x16(v); }
+		GLM_FUNC_QUALIFIER static vec2 unpack(uint32 p) { return unpackSnorm2x16(p); }
+	};
+
+	struct packed_unorm4x16
+	{
+		typedef vec4 value_type;
+		typedef uint64 packed_type;
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const& v) { return packUnorm4x16(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p) { return unpackUnorm4x16(p); }
+	};
+
+	struct packed_snorm4x16
+	{
+		typedef vec4 value_type;
+		typedef uint64 packed_type;
+		GLM_FUNC_QUALIFIER static uint64 pack(vec4 const& v) { return packSnorm4x16(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint64 p) { return unpackSnorm4x16(p); }
+	};
+
+	struct packed_unorm3x10_1x2
+	{
+		typedef vec4 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const& v) { return packUnorm3x10_1x2(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 p) { return unpackUnorm3x10_1x2(p); }
+	};
+
+	struct packed_snorm3x10_1x2
+	{
+		typedef vec4 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec4 const& v) { return packSnorm3x10_1x2(v); }
+		GLM_FUNC_QUALIFIER static vec4 unpack(uint32 p) { return unpackSnorm3x10_1x2(p); }
+	};
+
+	struct packed_unorm1x5_1x6_1x5
+	{
+		typedef vec3 value_type;
+		typedef uint16 packed_type;
+		GLM_FUNC_QUALIFIER static uint16 pack(vec3 const& v) { return packUnorm1x5_1x6_1x5(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint16 p) { return unpackUnorm1x5_1x6_1x5(p); }
+	};
+
+	struct packed_f2x11_1x10
+	{
+		typedef vec3 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec3 const& v) { return packF2x11_1x10(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint32 p) { return unpackF2x11_1x10(p); }
+	};
+
+	struct packed_f3x9_E1x5
+	{
+		typedef vec3 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec3 const& v) { return packF3x9_E1x5(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint32 p) { return unpackF3x9_E1x5(p); }
+	};
+
+	struct packed_octahedral16
+	{
+		typedef vec3 value_type;
+		typedef uint16 packed_type;
+		GLM_FUNC_QUALIFIER static uint16 pack(vec3 const& v) { return packOctahedral16(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint16 p) { return unpackOctahedral16(p); }
+	};
+
+	struct packed_octahedral24
+	{
+		typedef vec3 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec3 const& v) { return packOctahedral24(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint32 p) { return unpackOctahedral24(p); }
+	};
+
+	struct packed_octahedral32
+	{
+		typedef vec3 value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(vec3 const& v) { return packOctahedral32(v); }
+		GLM_FUNC_QUALIFIER static vec3 unpack(uint32 p) { return unpackOctahedral32(p); }
+	};
+
+	struct packed_quat32
+	{
+		typedef quat value_type;
+		typedef uint32 packed_type;
+		GLM_FUNC_QUALIFIER static uint32 pack(quat const& v) { return packQuat32(v); }
+		GLM_FUNC_QUALIFIER static quat unpack(uint32 p) { return unpackQuat32(p); }
+	};
+
+	struct packed_quat48
+	{
+		typedef quat value_type;
+		typedef uint64 packed_type;
+		GLM_FUNC_QUALIFIER static uint64 pack(quat const& v) { return packQuat48(v); }
+		GLM_FUNC_QUALIFIER static quat unpack(uint64 p) { return unpackQuat48(p); }
+	};
+
+	struct packed_quat64
+	{
+		typedef quat value_type;
+		typedef uint64 packed_type;
+		GLM_FUNC_QUALIFIER static uint64 pack(quat const& v) { return packQuat64(v); }
+		GLM_FUNC_QUALIFIER static quat unpack(uint64 p) { return unpackQuat64(p); }
+	};
+
+	template<typename Format, bool UseSimd>
+	struct compute_packed_array
+	{
+		typedef typename Format::value_type value_type;
+		typedef typename Format::packed_type packed_type;
+
+		GLM_FUNC_QUALIFIER static void pack(char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				value_type Value;
+				memcpy(&Value, in + i * inStride, sizeof(Value));
+				packed_type const Packed = Format::pack(Value);
+				memcpy(out + i * outStride, &Packed, sizeof(Packed));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				packed_type Packed;
+				memcpy(&Packed, in + i * inStride, sizeof(Packed));
+				value_type const Value = Format::unpack(Packed);
+				memcpy(out + i * outStride, &Value, sizeof(Value));
+			}
+		}
+	};
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "packing_simd.inl"
+#endif
+
+namespace glm
+{
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
 	{
@@ -504,11 +765,7 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
-		i16vec4 const Unpack(
-			detail::toFloat16(v.x),
-			detail::toFloat16(v.y),
-			detail::toFloat16(v.z),
-			detail::toFloat16(v.w));
+		u16vec4 const Unpack(detail::compute_half<4, defaultp, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(v));
 		uint64 Packed = 0;
 		memcpy(&Packed, value_ptr(Unpack), sizeof(Packed));
 		return Packed;
@@ -516,15 +773,35 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::vec4 unpackHalf4x16(uint64 v)
 	{
-		i16vec4 Unpack;
+		u16vec4 Unpack;
 		memcpy(value_ptr(Unpack), &v, sizeof(Unpack));
-		return vec4(
-			detail::toFloat32(Unpack.x),
-			detail::toFloat32(Unpack.y),
-			detail::toFloat32(Unpack.z),
-			detail::toFloat32(Unpack.w));
+		return detail::compute_half<4, defaultp, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(Unpack);
+	}
+
+	GLM_FUNC_QUALIFIER void packHalf(float const* in, uint16* out, std::size_t count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(in, out, count);
 	}
 
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(in, out, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void packHalf(std::span<float const> in, std::span<uint16> out)
+	{
+		assert(in.size() == out.size());
+		packHalf(in.data(), out.data(), in.size());
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(std::span<uint16 const> in, std::span<float> out)
+	{
+		assert(in.size() == out.size());
+		unpackHalf(in.data(), out.data(), in.size());
+	}
+#	endif//GLM_HAS_SPAN
+
 	GLM_FUNC_QUALIFIER uint32 packI3x10_1x2(ivec4 const& v)
 	{
 		detail::i10i10i10i2 Result;
@@ -621,9 +898,9 @@ namespace detail
 	GLM_FUNC_QUALIFIER vec3 unpackF2x11_1x10(uint32 v)
 	{
 		return vec3(
-			detail::packed11bitToFloat(v >> 0),
-			detail::packed11bitToFloat(v >> 11),
-			detail::packed10bitToFloat(v >> 22));
+			detail::packed11bitToFloat((v >> 0) & ((1 << 11) - 1)),
+			detail::packed11bitToFloat((v >> 11) & ((1 << 11) - 1)),
+			detail::packed10bitToFloat((v >> 22) & ((1 << 10) - 1)));
 	}
 
 	GLM_FUNC_QUALIFIER uint32 packF3x9_E1x5(vec3 const& v)
@@ -654,6 +931,275 @@ namespace detail
 		return vec3(Unpack.data.x, Unpack.data.y, Unpack.data.z) * pow(2.0f, static_cast<float>(Unpack.data.w) - 15.f - 9.f);
 	}
 
+	GLM_FUNC_QUALIFIER uint16 packOctahedral16(vec3 const& v)
+	{
+		i8vec2 const Topack(round(clamp(detail::octahedral_encode(v), -1.0f, 1.0f) * 127.0f));
+		uint16 Packed = 0;
+		memcpy(&Packed, &Topack, sizeof(Packed));
+		return Packed;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral16(uint16 p)
+	{
+		i8vec2 Unpack;
+		memcpy(&Unpack, &p, sizeof(Unpack));
+		return detail::octahedral_decode(clamp(vec2(Unpack) * (1.0f / 127.0f), -1.0f, 1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral24(vec3 const& v)
+	{
+		ivec2 const Topack(round(clamp(detail::octahedral_encode(v), -1.0f, 1.0f) * 2047.0f));
+		return (static_cast<uint32>(Topack.x) & 0xFFF) | ((static_cast<uint32>(Topack.y) & 0xFFF) << 12);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral24(uint32 p)
+	{
+		vec2 const Unpack(detail::packed_signed_bits(p, 0, 12), detail::packed_signed_bits(p, 12, 12));
+		return detail::octahedral_decode(clamp(Unpack * (1.0f / 2047.0f), -1.0f, 1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOctahedral32(vec3 const& v)
+	{
+		i16vec2 const Topack(round(clamp(detail::octahedral_encode(v), -1.0f, 1.0f) * 32767.0f));
+		uint32 Packed = 0;
+		memcpy(&Packed, &Topack, sizeof(Packed));
+		return Packed;
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOctahedral32(uint32 p)
+	{
+		i16vec2 Unpack;
+		memcpy(&Unpack, &p, sizeof(Unpack));
+		return detail::octahedral_decode(clamp(vec2(Unpack) * (1.0f / 32767.0f), -1.0f, 1.0f));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packQuat32(quat const& q)
+	{
+		ivec4 const Fields(detail::quat_smallest_three_encode<10>(q));
+		return
+			((static_cast<uint32>(Fields.x) & 0x3FF) << 0) |
+			((static_cast<uint32>(Fields.y) & 0x3FF) << 10) |
+			((static_cast<uint32>(Fields.z) & 0x3FF) << 20) |
+			(static_cast<uint32>(Fields.w) << 30);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuat32(uint32 p)
+	{
+		return detail::quat_smallest_three_decode<10>(ivec4(
+			detail::packed_signed_bits(p, 0, 10),
+			detail::packed_signed_bits(p, 10, 10),
+			detail::packed_signed_bits(p, 20, 10),
+			static_cast<int>(p >> 30)));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 packQuat48(quat const& q)
+	{
+		ivec4 const Fields(detail::quat_smallest_three_encode<15>(q));
+		return
+			((static_cast<uint64>(Fields.x) & 0x7FFF) << 0) |
+			((static_cast<uint64>(Fields.y) & 0x7FFF) << 15) |
+			((static_cast<uint64>(Fields.z) & 0x7FFF) << 30) |
+			(static_cast<uint64>(Fields.w) << 45);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuat48(uint64 p)
+	{
+		return detail::quat_smallest_three_decode<15>(ivec4(
+			detail::packed_signed_bits(p, 0, 15),
+			detail::packed_signed_bits(p, 15, 15),
+			detail::packed_signed_bits(p, 30, 15),
+			static_cast<int>((p >> 45) & 0x3)));
+	}
+
+	GLM_FUNC_QUALIFIER uint64 packQuat64(quat const& q)
+	{
+		ivec4 const Fields(detail::quat_smallest_three_encode<20>(q));
+		return
+			((static_cast<uint64>(Fields.x) & 0xFFFFF) << 0) |
+			((static_cast<uint64>(Fields.y) & 0xFFFFF) << 20) |
+			((static_cast<uint64>(Fields.z) & 0xFFFFF) << 40) |
+			(static_cast<uint64>(Fields.w) << 60);
+	}
+
+	GLM_FUNC_QUALIFIER quat unpackQuat64(uint64 p)
+	{
+		return detail::quat_smallest_three_decode<20>(ivec4(
+			detail::packed_signed_bits(p, 0, 20),
+			detail::packed_signed_bits(p, 20, 20),
+			detail::packed_signed_bits(p, 40, 20),
+			static_cast<int>((p >> 60) & 0x3)));
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x8(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm4x8, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm4x8, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x8(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm4x8, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm4x8, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm2x16(vec2 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm2x16, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm2x16(uint32 const* in, vec2* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm2x16, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm2x16(vec2 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm2x16, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm2x16(uint32 const* in, vec2* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm2x16, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm4x16(vec4 const* in, uint64* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm4x16, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm4x16(uint64 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm4x16, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm4x16(vec4 const* in, uint64* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm4x16, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm4x16(uint64 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm4x16, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm3x10_1x2(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm3x10_1x2, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm3x10_1x2(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm3x10_1x2, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packSnorm3x10_1x2(vec4 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm3x10_1x2, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackSnorm3x10_1x2(uint32 const* in, vec4* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_snorm3x10_1x2, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packUnorm1x5_1x6_1x5(vec3 const* in, uint16* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm1x5_1x6_1x5, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackUnorm1x5_1x6_1x5(uint16 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_unorm1x5_1x6_1x5, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packF2x11_1x10(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_f2x11_1x10, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF2x11_1x10(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_f2x11_1x10, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packF3x9_E1x5(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_f3x9_E1x5, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackF3x9_E1x5(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_f3x9_E1x5, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral16(vec3 const* in, uint16* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral16, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral16(uint16 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral16, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral24(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral24, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral24(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral24, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packOctahedral32(vec3 const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral32, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackOctahedral32(uint32 const* in, vec3* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_octahedral32, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuat32(quat const* in, uint32* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat32, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuat32(uint32 const* in, quat* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat32, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuat48(quat const* in, uint64* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat48, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuat48(uint64 const* in, quat* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat48, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void packQuat64(quat const* in, uint64* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat64, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQuat64(uint64 const* in, quat* out, std::size_t count, std::size_t inStride, std::size_t outStride)
+	{
+		detail::compute_packed_array<detail::packed_quat64, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
 	// Based on Brian Karis http://graphicrants.blogspot.fr/2009/04/rgbm-color-encoding.html
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<4, T, Q> packRGBM(vec<3, T, Q> const& rgb)
@@ -673,13 +1219,13 @@ namespace detail
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uint16, Q> packHalf(vec<L, float, Q> const& v)
 	{
-		return detail::compute_half<L, Q>::pack(v);
+		return detail::compute_half<L, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::pack(v);
 	}
 
 	template<length_t L, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& v)
 	{
-		return detail::compute_half<L, Q>::unpack(v);
+		return detail::compute_half<L, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(v);
 	}
 
 	template<typename uintType, length_t L, typename floatType, qualifier Q>
@@ -0,0 +1,934 @@
+#include "../simd/packing.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_half<4, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, uint16, Q> pack(vec<4, float, Q> const& v)
+		{
+			vec<4, uint16, Q> Result;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&Result.x), glm_vec4_to_half(_mm_loadu_ps(&v.x)));
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> unpack(vec<4, uint16, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_from_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v.x))));
+			return Result;
+		}
+	};
+
+	// 8 elements per step with F16C and AVX, 4 otherwise; the remainder goes
+	// through one zero padded block
+	template<>
+	struct compute_half_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* in, uint16* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_SIMD_F16C == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+				for(; i + 8 <= count; i += 8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_vec8_to_half(_mm256_loadu_ps(in + i)));
+#			endif
+			for(; i + 4 <= count; i += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), glm_vec4_to_half(_mm_loadu_ps(in + i)));
+			if(i < count)
+			{
+				float Block[4] = {0.f, 0.f, 0.f, 0.f};
+				uint16 Packed[4];
+				for(std::size_t j = 0; i + j < count; ++j)
+					Block[j] = in[i + j];
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Packed), glm_vec4_to_half(_mm_loadu_ps(Block)));
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Packed[j];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* in, float* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_SIMD_F16C == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+				for(; i + 8 <= count; i += 8)
+					_mm256_storeu_ps(out + i, glm_vec8_from_half(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i))));
+#			endif
+			for(; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, glm_vec4_from_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i))));
+			if(i < count)
+			{
+				uint16 Block[4] = {0, 0, 0, 0};
+				float Unpacked[4];
+				for(std::size_t j = 0; i + j < count; ++j)
+					Block[j] = in[i + j];
+				_mm_storeu_ps(Unpacked, glm_vec4_from_half(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(Block))));
+				for(std::size_t j = 0; i + j < count; ++j)
+					out[i + j] = Unpacked[j];
+			}
+		}
+	};
+
+	// Lane operations of the packed format kernels: 4 lanes with SSE2, 8 with AVX2.
+	// load() inserts the lanes one by one: they were just written as scalars and
+	// a vector load of them would stall on store forwarding
+	struct packed_simd_sse2
+	{
+		typedef glm_f32vec4 fvec;
+		typedef glm_i32vec4 ivec;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static ivec seti(int x) { return _mm_set1_epi32(x); }
+		GLM_FUNC_QUALIFIER static fvec min(fvec a, fvec b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec max(fvec a, fvec b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec addi(ivec a, ivec b) { return _mm_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec subi(ivec a, ivec b) { return _mm_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec andi(ivec a, ivec b) { return _mm_and_si128(a, b); }
+		GLM_FUNC_QUALIFIER static ivec ori(ivec a, ivec b) { return _mm_or_si128(a, b); }
+		GLM_FUNC_QUALIFIER static ivec xori(ivec a, ivec b) { return _mm_xor_si128(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec slli(ivec a) { return _mm_slli_epi32(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec srli(ivec a) { return _mm_srli_epi32(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec srai(ivec a) { return _mm_srai_epi32(a, N); }
+		GLM_FUNC_QUALIFIER static fvec cvt(ivec a) { return _mm_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec cvtt(fvec a) { return _mm_cvttps_epi32(a); }
+		GLM_FUNC_QUALIFIER static fvec asfloat(ivec a) { return _mm_castsi128_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec asint(fvec a) { return _mm_castps_si128(a); }
+		GLM_FUNC_QUALIFIER static ivec cmpeqi(ivec a, ivec b) { return _mm_cmpeq_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec cmpgti(ivec a, ivec b) { return _mm_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec cmpge(fvec a, fvec b) { return _mm_castps_si128(_mm_cmpge_ps(a, b)); }
+		GLM_FUNC_QUALIFIER static ivec cmple(fvec a, fvec b) { return _mm_castps_si128(_mm_cmple_ps(a, b)); }
+		GLM_FUNC_QUALIFIER static ivec select(ivec m, ivec a, ivec b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+		GLM_FUNC_QUALIFIER static ivec load(uint32 const* p) { return _mm_setr_epi32(static_cast<int>(p[0]), static_cast<int>(p[1]), static_cast<int>(p[2]), static_cast<int>(p[3])); }
+		GLM_FUNC_QUALIFIER static void store(uint32* p, ivec a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a); }
+		GLM_FUNC_QUALIFIER static fvec join(glm_f32vec4 const* Parts) { return Parts[0]; }
+		GLM_FUNC_QUALIFIER static void split(fvec a, glm_f32vec4* Parts) { Parts[0] = a; }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	struct packed_simd_avx2
+	{
+		typedef __m256 fvec;
+		typedef __m256i ivec;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static ivec seti(int x) { return _mm256_set1_epi32(x); }
+		GLM_FUNC_QUALIFIER static fvec min(fvec a, fvec b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec max(fvec a, fvec b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec addi(ivec a, ivec b) { return _mm256_add_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec subi(ivec a, ivec b) { return _mm256_sub_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec andi(ivec a, ivec b) { return _mm256_and_si256(a, b); }
+		GLM_FUNC_QUALIFIER static ivec ori(ivec a, ivec b) { return _mm256_or_si256(a, b); }
+		GLM_FUNC_QUALIFIER static ivec xori(ivec a, ivec b) { return _mm256_xor_si256(a, b); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec slli(ivec a) { return _mm256_slli_epi32(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec srli(ivec a) { return _mm256_srli_epi32(a, N); }
+		template<int N> GLM_FUNC_QUALIFIER static ivec srai(ivec a) { return _mm256_srai_epi32(a, N); }
+		GLM_FUNC_QUALIFIER static fvec cvt(ivec a) { return _mm256_cvtepi32_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec cvtt(fvec a) { return _mm256_cvttps_epi32(a); }
+		GLM_FUNC_QUALIFIER static fvec asfloat(ivec a) { return _mm256_castsi256_ps(a); }
+		GLM_FUNC_QUALIFIER static ivec asint(fvec a) { return _mm256_castps_si256(a); }
+		GLM_FUNC_QUALIFIER static ivec cmpeqi(ivec a, ivec b) { return _mm256_cmpeq_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec cmpgti(ivec a, ivec b) { return _mm256_cmpgt_epi32(a, b); }
+		GLM_FUNC_QUALIFIER static ivec cmpge(fvec a, fvec b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+		GLM_FUNC_QUALIFIER static ivec cmple(fvec a, fvec b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_LE_OQ)); }
+		GLM_FUNC_QUALIFIER static ivec select(ivec m, ivec a, ivec b) { return _mm256_blendv_epi8(b, a, m); }
+		GLM_FUNC_QUALIFIER static ivec load(uint32 const* p)
+		{
+			return _mm256_inserti128_si256(_mm256_castsi128_si256(packed_simd_sse2::load(p)), packed_simd_sse2::load(p + 4), 1);
+		}
+		GLM_FUNC_QUALIFIER static void store(uint32* p, ivec a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a); }
+		GLM_FUNC_QUALIFIER static fvec join(glm_f32vec4 const* Parts) { return _mm256_insertf128_ps(_mm256_castps128_ps256(Parts[0]), Parts[1], 1); }
+		GLM_FUNC_QUALIFIER static void split(fvec a, glm_f32vec4* Parts) { Parts[0] = _mm256_castps256_ps128(a); Parts[1] = _mm256_extractf128_ps(a, 1); }
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// round() of the per-element functions, halfway cases away from zero;
+	// v - trunc(v) is exact so the tie test is too
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::ivec packed_round(typename simd::fvec v)
+	{
+		typename simd::ivec const Trunc = simd::cvtt(v);
+		typename simd::fvec const Frac = simd::sub(v, simd::cvt(Trunc));
+		return simd::addi(simd::subi(Trunc, simd::cmpge(Frac, simd::set(0.5f))), simd::cmple(Frac, simd::set(-0.5f)));
+	}
+
+	// round(clamp(v, Min, 1) * Scale)
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::ivec packed_norm(typename simd::fvec v, float Min, float Scale)
+	{
+		return packed_round<simd>(simd::mul(simd::min(simd::max(v, simd::set(Min)), simd::set(1.0f)), simd::set(Scale)));
+	}
+
+	template<typename simd, int Shift, int Bits>
+	GLM_FUNC_QUALIFIER typename simd::ivec packed_field(typename simd::ivec p)
+	{
+		return simd::andi(simd::template srli<Shift>(p), simd::seti((1 << Bits) - 1));
+	}
+
+	template<typename simd, int Shift, int Bits>
+	GLM_FUNC_QUALIFIER typename simd::ivec packed_signed_field(typename simd::ivec p)
+	{
+		return simd::template srai<32 - Bits>(simd::template slli<32 - Bits - Shift>(p));
+	}
+
+	// f * Scale for unorm fields, clamp(f * Scale, -1, 1) for snorm fields
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_unorm(typename simd::ivec f, float Scale)
+	{
+		return simd::mul(simd::cvt(f), simd::set(Scale));
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_snorm(typename simd::ivec f, float Scale)
+	{
+		return simd::min(simd::max(simd::mul(simd::cvt(f), simd::set(Scale)), simd::set(-1.0f)), simd::set(1.0f));
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_selectf(typename simd::ivec m, typename simd::fvec a, typename simd::fvec b)
+	{
+		return simd::asfloat(simd::select(m, simd::asint(a), simd::asint(b)));
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_abs(typename simd::fvec v)
+	{
+		return simd::asfloat(simd::andi(simd::asint(v), simd::seti(0x7FFFFFFF)));
+	}
+
+	// v with its sign flipped where the Mask lanes are set
+	template<typename simd>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_negate(typename simd::fvec v, typename simd::ivec Mask)
+	{
+		return simd::asfloat(simd::xori(simd::asint(v), simd::andi(Mask, simd::seti(static_cast<int>(0x80000000u)))));
+	}
+
+	// floatTo11bit / floatTo10bit: truncated mantissa, sign dropped, zero, NaN
+	// and infinity handled first
+	template<typename simd, int Shift, int ExpMask, int MantMask>
+	GLM_FUNC_QUALIFIER typename simd::ivec packed_small_float(typename simd::fvec v)
+	{
+		typedef typename simd::ivec ivec;
+		ivec const Bits = simd::asint(v);
+		ivec const Abs = simd::andi(Bits, simd::seti(0x7fffffff));
+		ivec const Exponent = simd::andi(simd::template srli<Shift>(simd::subi(simd::andi(Bits, simd::seti(0x7f800000)), simd::seti(0x38000000))), simd::seti(ExpMask));
+		ivec const Mantissa = simd::andi(simd::template srli<Shift>(Bits), simd::seti(MantMask));
+		ivec Result = simd::ori(Exponent, Mantissa);
+		Result = simd::select(simd::cmpgti(Abs, simd::seti(0x7f800000)), simd::seti(ExpMask | MantMask), Result);
+		Result = simd::select(simd::cmpeqi(Abs, simd::seti(0x7f800000)), simd::seti(ExpMask), Result);
+		return simd::select(simd::cmpeqi(Abs, simd::seti(0)), simd::seti(0), Result);
+	}
+
+	// packed11bitToFloat / packed10bitToFloat
+	template<typename simd, int Shift, int ExpMask, int MantMask>
+	GLM_FUNC_QUALIFIER typename simd::fvec packed_small_float_unpack(typename simd::ivec f)
+	{
+		typedef typename simd::ivec ivec;
+		ivec const Exponent = simd::andi(simd::addi(simd::template slli<Shift>(simd::andi(f, simd::seti(ExpMask))), simd::seti(0x38000000)), simd::seti(0x7f800000));
+		ivec Result = simd::ori(Exponent, simd::template slli<Shift>(simd::andi(f, simd::seti(MantMask))));
+		Result = simd::select(simd::cmpeqi(f, simd::seti(ExpMask | MantMask)), simd::seti(0x7fc00000), Result);
+		Result = simd::select(simd::cmpeqi(f, simd::seti(ExpMask)), simd::seti(0x7f800000), Result);
+		return simd::asfloat(simd::select(simd::cmpeqi(f, simd::seti(0)), simd::seti(0), Result));
+	}
+
+	// Kernels of the formats on the x, y, z and w components of simd::size
+	// elements; the packed values are 32-bit lanes, 64-bit formats put their
+	// high halves in Words[1]
+	template<typename Format>
+	struct compute_packed_simd
+	{};
+
+	template<>
+	struct compute_packed_simd<packed_unorm4x8>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(
+				simd::ori(packed_norm<simd>(v[0], 0.0f, 255.0f), simd::template slli<8>(packed_norm<simd>(v[1], 0.0f, 255.0f))),
+				simd::ori(simd::template slli<16>(packed_norm<simd>(v[2], 0.0f, 255.0f)), simd::template slli<24>(packed_norm<simd>(v[3], 0.0f, 255.0f))));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 0.0039215686274509803921568627451f;
+			v[0] = packed_unorm<simd>(packed_field<simd, 0, 8>(Words[0]), Scale);
+			v[1] = packed_unorm<simd>(packed_field<simd, 8, 8>(Words[0]), Scale);
+			v[2] = packed_unorm<simd>(packed_field<simd, 16, 8>(Words[0]), Scale);
+			v[3] = packed_unorm<simd>(packed_field<simd, 24, 8>(Words[0]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_snorm4x8>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0xFF);
+			Words[0] = simd::ori(
+				simd::ori(simd::andi(packed_norm<simd>(v[0], -1.0f, 127.0f), Mask), simd::template slli<8>(simd::andi(packed_norm<simd>(v[1], -1.0f, 127.0f), Mask))),
+				simd::ori(simd::template slli<16>(simd::andi(packed_norm<simd>(v[2], -1.0f, 127.0f), Mask)), simd::template slli<24>(packed_norm<simd>(v[3], -1.0f, 127.0f))));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 0.0078740157480315f;
+			v[0] = packed_snorm<simd>(packed_signed_field<simd, 0, 8>(Words[0]), Scale);
+			v[1] = packed_snorm<simd>(packed_signed_field<simd, 8, 8>(Words[0]), Scale);
+			v[2] = packed_snorm<simd>(packed_signed_field<simd, 16, 8>(Words[0]), Scale);
+			v[3] = packed_snorm<simd>(packed_signed_field<simd, 24, 8>(Words[0]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_unorm2x16>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(packed_norm<simd>(v[0], 0.0f, 65535.0f), simd::template slli<16>(packed_norm<simd>(v[1], 0.0f, 65535.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 1.5259021896696421759365224689097e-5f;
+			v[0] = packed_unorm<simd>(packed_field<simd, 0, 16>(Words[0]), Scale);
+			v[1] = packed_unorm<simd>(packed_field<simd, 16, 16>(Words[0]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_snorm2x16>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(simd::andi(packed_norm<simd>(v[0], -1.0f, 32767.0f), simd::seti(0xFFFF)), simd::template slli<16>(packed_norm<simd>(v[1], -1.0f, 32767.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 3.0518509475997192297128208258309e-5f;
+			v[0] = packed_snorm<simd>(packed_signed_field<simd, 0, 16>(Words[0]), Scale);
+			v[1] = packed_snorm<simd>(packed_signed_field<simd, 16, 16>(Words[0]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_unorm4x16>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(packed_norm<simd>(v[0], 0.0f, 65535.0f), simd::template slli<16>(packed_norm<simd>(v[1], 0.0f, 65535.0f)));
+			Words[1] = simd::ori(packed_norm<simd>(v[2], 0.0f, 65535.0f), simd::template slli<16>(packed_norm<simd>(v[3], 0.0f, 65535.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 1.5259021896696421759365224689097e-5f;
+			v[0] = packed_unorm<simd>(packed_field<simd, 0, 16>(Words[0]), Scale);
+			v[1] = packed_unorm<simd>(packed_field<simd, 16, 16>(Words[0]), Scale);
+			v[2] = packed_unorm<simd>(packed_field<simd, 0, 16>(Words[1]), Scale);
+			v[3] = packed_unorm<simd>(packed_field<simd, 16, 16>(Words[1]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_snorm4x16>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0xFFFF);
+			Words[0] = simd::ori(simd::andi(packed_norm<simd>(v[0], -1.0f, 32767.0f), Mask), simd::template slli<16>(packed_norm<simd>(v[1], -1.0f, 32767.0f)));
+			Words[1] = simd::ori(simd::andi(packed_norm<simd>(v[2], -1.0f, 32767.0f), Mask), simd::template slli<16>(packed_norm<simd>(v[3], -1.0f, 32767.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			float const Scale = 3.0518509475997192297128208258309e-5f;
+			v[0] = packed_snorm<simd>(packed_signed_field<simd, 0, 16>(Words[0]), Scale);
+			v[1] = packed_snorm<simd>(packed_signed_field<simd, 16, 16>(Words[0]), Scale);
+			v[2] = packed_snorm<simd>(packed_signed_field<simd, 0, 16>(Words[1]), Scale);
+			v[3] = packed_snorm<simd>(packed_signed_field<simd, 16, 16>(Words[1]), Scale);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_unorm3x10_1x2>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(
+				simd::ori(packed_norm<simd>(v[0], 0.0f, 1023.f), simd::template slli<10>(packed_norm<simd>(v[1], 0.0f, 1023.f))),
+				simd::ori(simd::template slli<20>(packed_norm<simd>(v[2], 0.0f, 1023.f)), simd::template slli<30>(packed_norm<simd>(v[3], 0.0f, 3.f))));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			v[0] = packed_unorm<simd>(packed_field<simd, 0, 10>(Words[0]), 1.0f / 1023.f);
+			v[1] = packed_unorm<simd>(packed_field<simd, 10, 10>(Words[0]), 1.0f / 1023.f);
+			v[2] = packed_unorm<simd>(packed_field<simd, 20, 10>(Words[0]), 1.0f / 1023.f);
+			v[3] = packed_unorm<simd>(packed_field<simd, 30, 2>(Words[0]), 1.0f / 3.f);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_snorm3x10_1x2>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0x3FF);
+			Words[0] = simd::ori(
+				simd::ori(simd::andi(packed_norm<simd>(v[0], -1.0f, 511.f), Mask), simd::template slli<10>(simd::andi(packed_norm<simd>(v[1], -1.0f, 511.f), Mask))),
+				simd::ori(simd::template slli<20>(simd::andi(packed_norm<simd>(v[2], -1.0f, 511.f), Mask)), simd::template slli<30>(packed_norm<simd>(v[3], -1.0f, 1.f))));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			v[0] = packed_snorm<simd>(packed_signed_field<simd, 0, 10>(Words[0]), 1.f / 511.f);
+			v[1] = packed_snorm<simd>(packed_signed_field<simd, 10, 10>(Words[0]), 1.f / 511.f);
+			v[2] = packed_snorm<simd>(packed_signed_field<simd, 20, 10>(Words[0]), 1.f / 511.f);
+			v[3] = packed_snorm<simd>(packed_signed_field<simd, 30, 2>(Words[0]), 1.f);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_unorm1x5_1x6_1x5>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(
+				simd::ori(packed_norm<simd>(v[0], 0.0f, 31.f), simd::template slli<5>(packed_norm<simd>(v[1], 0.0f, 63.f))),
+				simd::template slli<11>(packed_norm<simd>(v[2], 0.0f, 31.f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			v[0] = packed_unorm<simd>(packed_field<simd, 0, 5>(Words[0]), 1.f / 31.f);
+			v[1] = packed_unorm<simd>(packed_field<simd, 5, 6>(Words[0]), 1.f / 63.f);
+			v[2] = packed_unorm<simd>(packed_field<simd, 11, 5>(Words[0]), 1.f / 31.f);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_f2x11_1x10>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			Words[0] = simd::ori(
+				simd::ori(packed_small_float<simd, 17, 0x7C0, 0x3F>(v[0]), simd::template slli<11>(packed_small_float<simd, 17, 0x7C0, 0x3F>(v[1]))),
+				simd::template slli<22>(packed_small_float<simd, 18, 0x3E0, 0x1F>(v[2])));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			v[0] = packed_small_float_unpack<simd, 17, 0x7C0, 0x3F>(packed_field<simd, 0, 11>(Words[0]));
+			v[1] = packed_small_float_unpack<simd, 17, 0x7C0, 0x3F>(packed_field<simd, 11, 11>(Words[0]));
+			v[2] = packed_small_float_unpack<simd, 18, 0x3E0, 0x1F>(packed_field<simd, 22, 10>(Words[0]));
+		}
+	};
+
+	// The shared exponent comes from the exponent bits of the largest component
+	// and every scale is an exact power of two, as in packF3x9_E1x5
+	template<>
+	struct compute_packed_simd<packed_f3x9_E1x5>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typedef typename simd::fvec fvec;
+			typedef typename simd::ivec ivec;
+
+			fvec const Zero = simd::set(0.0f);
+			fvec const SharedExpMax = simd::set(32768.f);
+			fvec const Half = simd::set(0.5f);
+			fvec const r = simd::min(simd::max(v[0], Zero), SharedExpMax);
+			fvec const g = simd::min(simd::max(v[1], Zero), SharedExpMax);
+			fvec const b = simd::min(simd::max(v[2], Zero), SharedExpMax);
+			fvec const MaxColor = simd::max(r, simd::max(g, b));
+
+			ivec Exp = simd::subi(packed_field<simd, 23, 8>(simd::asint(MaxColor)), simd::seti(127));
+			Exp = simd::select(simd::cmpgti(simd::seti(-16), Exp), simd::seti(-16), Exp);
+			ivec const ExpSharedP = simd::addi(Exp, simd::seti(16));
+			ivec const MaxShared = simd::cvtt(simd::add(simd::mul(MaxColor, simd::asfloat(simd::template slli<23>(simd::subi(simd::seti(127 + 24), ExpSharedP)))), Half));
+			ivec const ExpShared = simd::subi(ExpSharedP, simd::cmpeqi(MaxShared, simd::seti(512)));
+			fvec const Scale = simd::asfloat(simd::template slli<23>(simd::subi(simd::seti(127 + 24), ExpShared)));
+
+			ivec const Mask = simd::seti(0x1FF);
+			ivec const x = simd::andi(simd::cvtt(simd::add(simd::mul(r, Scale), Half)), Mask);
+			ivec const y = simd::andi(simd::cvtt(simd::add(simd::mul(g, Scale), Half)), Mask);
+			ivec const z = simd::andi(simd::cvtt(simd::add(simd::mul(b, Scale), Half)), Mask);
+			Words[0] = simd::ori(
+				simd::ori(x, simd::template slli<9>(y)),
+				simd::ori(simd::template slli<18>(z), simd::template slli<27>(ExpShared)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			typename simd::fvec const Scale = simd::asfloat(simd::template slli<23>(simd::addi(simd::template srli<27>(Words[0]), simd::seti(127 - 24))));
+			v[0] = simd::mul(simd::cvt(packed_field<simd, 0, 9>(Words[0])), Scale);
+			v[1] = simd::mul(simd::cvt(packed_field<simd, 9, 9>(Words[0])), Scale);
+			v[2] = simd::mul(simd::cvt(packed_field<simd, 18, 9>(Words[0])), Scale);
+		}
+	};
+
+	// octahedral_encode and octahedral_decode; the folds only flip signs so the
+	// encoders match the scalar path bit for bit
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void packed_octahedral_encode(typename simd::fvec const* v, typename simd::fvec* p)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const Zero = simd::set(0.0f);
+		fvec const One = simd::set(1.0f);
+		fvec const Sum = simd::add(simd::add(packed_abs<simd>(v[0]), packed_abs<simd>(v[1])), packed_abs<simd>(v[2]));
+		fvec const x = simd::div(v[0], Sum);
+		fvec const y = simd::div(v[1], Sum);
+		fvec const FoldX = packed_negate<simd>(simd::sub(One, packed_abs<simd>(y)), simd::xori(simd::cmpge(x, Zero), simd::seti(-1)));
+		fvec const FoldY = packed_negate<simd>(simd::sub(One, packed_abs<simd>(x)), simd::xori(simd::cmpge(y, Zero), simd::seti(-1)));
+		typename simd::ivec const Upper = simd::cmpge(v[2], Zero);
+		p[0] = packed_selectf<simd>(Upper, x, FoldX);
+		p[1] = packed_selectf<simd>(Upper, y, FoldY);
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void packed_octahedral_decode(typename simd::fvec x, typename simd::fvec y, typename simd::fvec* v)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const Zero = simd::set(0.0f);
+		fvec const z = simd::sub(simd::sub(simd::set(1.0f), packed_abs<simd>(x)), packed_abs<simd>(y));
+		fvec const t = simd::max(simd::sub(Zero, z), Zero);
+		x = simd::add(x, packed_negate<simd>(t, simd::cmpge(x, Zero)));
+		y = simd::add(y, packed_negate<simd>(t, simd::cmpge(y, Zero)));
+		fvec const InvLength = simd::div(simd::set(1.0f), simd::sqrt(simd::add(simd::add(simd::mul(x, x), simd::mul(y, y)), simd::mul(z, z))));
+		v[0] = simd::mul(x, InvLength);
+		v[1] = simd::mul(y, InvLength);
+		v[2] = simd::mul(z, InvLength);
+	}
+
+	template<>
+	struct compute_packed_simd<packed_octahedral16>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::fvec p[2];
+			packed_octahedral_encode<simd>(v, p);
+			Words[0] = simd::ori(simd::andi(packed_norm<simd>(p[0], -1.0f, 127.0f), simd::seti(0xFF)), simd::template slli<8>(packed_norm<simd>(p[1], -1.0f, 127.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			packed_octahedral_decode<simd>(
+				packed_snorm<simd>(packed_signed_field<simd, 0, 8>(Words[0]), 1.0f / 127.0f),
+				packed_snorm<simd>(packed_signed_field<simd, 8, 8>(Words[0]), 1.0f / 127.0f), v);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_octahedral24>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::fvec p[2];
+			packed_octahedral_encode<simd>(v, p);
+			Words[0] = simd::ori(simd::andi(packed_norm<simd>(p[0], -1.0f, 2047.0f), simd::seti(0xFFF)), simd::template slli<12>(simd::andi(packed_norm<simd>(p[1], -1.0f, 2047.0f), simd::seti(0xFFF))));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			packed_octahedral_decode<simd>(
+				packed_snorm<simd>(packed_signed_field<simd, 0, 12>(Words[0]), 1.0f / 2047.0f),
+				packed_snorm<simd>(packed_signed_field<simd, 12, 12>(Words[0]), 1.0f / 2047.0f), v);
+		}
+	};
+
+	template<>
+	struct compute_packed_simd<packed_octahedral32>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::fvec p[2];
+			packed_octahedral_encode<simd>(v, p);
+			Words[0] = simd::ori(simd::andi(packed_norm<simd>(p[0], -1.0f, 32767.0f), simd::seti(0xFFFF)), simd::template slli<16>(packed_norm<simd>(p[1], -1.0f, 32767.0f)));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			packed_octahedral_decode<simd>(
+				packed_snorm<simd>(packed_signed_field<simd, 0, 16>(Words[0]), 1.0f / 32767.0f),
+				packed_snorm<simd>(packed_signed_field<simd, 16, 16>(Words[0]), 1.0f / 32767.0f), v);
+		}
+	};
+
+	// quat_smallest_three_encode on x, y, z, w: Fields[0..2] get the three
+	// components other than the first largest one, Fields[3] its index
+	template<typename simd, int Bits>
+	GLM_FUNC_QUALIFIER void packed_smallest_three_encode(typename simd::fvec const* v, typename simd::ivec* Fields)
+	{
+		typedef typename simd::fvec fvec;
+		typedef typename simd::ivec ivec;
+
+		fvec const ax = packed_abs<simd>(v[0]);
+		fvec const ay = packed_abs<simd>(v[1]);
+		fvec const az = packed_abs<simd>(v[2]);
+		fvec const Max = simd::max(simd::max(ax, ay), simd::max(az, packed_abs<simd>(v[3])));
+		ivec Index = simd::seti(3);
+		Index = simd::select(simd::cmpge(az, Max), simd::seti(2), Index);
+		Index = simd::select(simd::cmpge(ay, Max), simd::seti(1), Index);
+		Index = simd::select(simd::cmpge(ax, Max), simd::seti(0), Index);
+
+		ivec const Is0 = simd::cmpeqi(Index, simd::seti(0));
+		ivec const Below2 = simd::cmpgti(simd::seti(2), Index);
+		ivec const Below3 = simd::cmpgti(simd::seti(3), Index);
+		fvec const Largest = packed_selectf<simd>(Is0, v[0], packed_selectf<simd>(Below2, v[1], packed_selectf<simd>(Below3, v[2], v[3])));
+		ivec const Negative = simd::xori(simd::cmpge(Largest, simd::set(0.0f)), simd::seti(-1));
+
+		fvec const Sqrt2 = simd::set(1.41421356237309504880168872420969808f);
+		float const Scale = static_cast<float>((1 << (Bits - 1)) - 1);
+		Fields[0] = packed_norm<simd>(simd::mul(packed_negate<simd>(packed_selectf<simd>(Is0, v[1], v[0]), Negative), Sqrt2), -1.0f, Scale);
+		Fields[1] = packed_norm<simd>(simd::mul(packed_negate<simd>(packed_selectf<simd>(Below2, v[2], v[1]), Negative), Sqrt2), -1.0f, Scale);
+		Fields[2] = packed_norm<simd>(simd::mul(packed_negate<simd>(packed_selectf<simd>(Below3, v[3], v[2]), Negative), Sqrt2), -1.0f, Scale);
+		Fields[3] = Index;
+	}
+
+	// quat_smallest_three_decode of sign extended fields to x, y, z, w
+	template<typename simd, int Bits>
+	GLM_FUNC_QUALIFIER void packed_smallest_three_decode(typename simd::ivec const* Fields, typename simd::fvec* v)
+	{
+		typedef typename simd::fvec fvec;
+		typedef typename simd::ivec ivec;
+
+		float const Scale = 1.0f / static_cast<float>((1 << (Bits - 1)) - 1);
+		fvec const InvSqrt2 = simd::set(0.707106781186547524400844362104849039f);
+		fvec const a = simd::mul(packed_snorm<simd>(Fields[0], Scale), InvSqrt2);
+		fvec const b = simd::mul(packed_snorm<simd>(Fields[1], Scale), InvSqrt2);
+		fvec const c = simd::mul(packed_snorm<simd>(Fields[2], Scale), InvSqrt2);
+		fvec const Largest = simd::sqrt(simd::max(simd::sub(simd::sub(simd::sub(simd::set(1.0f), simd::mul(a, a)), simd::mul(b, b)), simd::mul(c, c)), simd::set(0.0f)));
+
+		ivec const Index = Fields[3];
+		ivec const Below2 = simd::cmpgti(simd::seti(2), Index);
+		v[0] = packed_selectf<simd>(simd::cmpeqi(Index, simd::seti(0)), Largest, a);
+		v[1] = packed_selectf<simd>(simd::cmpeqi(Index, simd::seti(1)), Largest, packed_selectf<simd>(simd::cmpeqi(Index, simd::seti(0)), a, b));
+		v[2] = packed_selectf<simd>(simd::cmpeqi(Index, simd::seti(2)), Largest, packed_selectf<simd>(Below2, b, c));
+		v[3] = packed_selectf<simd>(simd::cmpeqi(Index, simd::seti(3)), Largest, c);
+	}
+
+	template<>
+	struct compute_packed_simd<packed_quat32>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0x3FF);
+			typename simd::ivec f[4];
+			packed_smallest_three_encode<simd, 10>(v, f);
+			Words[0] = simd::ori(
+				simd::ori(simd::andi(f[0], Mask), simd::template slli<10>(simd::andi(f[1], Mask))),
+				simd::ori(simd::template slli<20>(simd::andi(f[2], Mask)), simd::template slli<30>(f[3])));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			typename simd::ivec const f[4] = {
+				packed_signed_field<simd, 0, 10>(Words[0]),
+				packed_signed_field<simd, 10, 10>(Words[0]),
+				packed_signed_field<simd, 20, 10>(Words[0]),
+				simd::template srli<30>(Words[0])};
+			packed_smallest_three_decode<simd, 10>(f, v);
+		}
+	};
+
+	// The third field straddles the two words
+	template<>
+	struct compute_packed_simd<packed_quat48>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0x7FFF);
+			typename simd::ivec f[4];
+			packed_smallest_three_encode<simd, 15>(v, f);
+			Words[0] = simd::ori(
+				simd::ori(simd::andi(f[0], Mask), simd::template slli<15>(simd::andi(f[1], Mask))),
+				simd::template slli<30>(f[2]));
+			Words[1] = simd::ori(simd::template srli<2>(simd::andi(f[2], Mask)), simd::template slli<13>(f[3]));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			typename simd::ivec const f[4] = {
+				packed_signed_field<simd, 0, 15>(Words[0]),
+				packed_signed_field<simd, 15, 15>(Words[0]),
+				packed_signed_field<simd, 0, 15>(simd::ori(simd::template srli<30>(Words[0]), simd::template slli<2>(Words[1]))),
+				packed_field<simd, 13, 2>(Words[1])};
+			packed_smallest_three_decode<simd, 15>(f, v);
+		}
+	};
+
+	// The second field straddles the two words
+	template<>
+	struct compute_packed_simd<packed_quat64>
+	{
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void pack(typename simd::fvec const* v, typename simd::ivec* Words)
+		{
+			typename simd::ivec const Mask = simd::seti(0xFFFFF);
+			typename simd::ivec f[4];
+			packed_smallest_three_encode<simd, 20>(v, f);
+			Words[0] = simd::ori(simd::andi(f[0], Mask), simd::template slli<20>(f[1]));
+			Words[1] = simd::ori(
+				simd::ori(simd::template srli<12>(simd::andi(f[1], Mask)), simd::template slli<8>(simd::andi(f[2], Mask))),
+				simd::template slli<28>(f[3]));
+		}
+
+		template<typename simd>
+		GLM_FUNC_QUALIFIER static void unpack(typename simd::ivec const* Words, typename simd::fvec* v)
+		{
+			typename simd::ivec const f[4] = {
+				packed_signed_field<simd, 0, 20>(Words[0]),
+				packed_signed_field<simd, 0, 20>(simd::ori(simd::template srli<20>(Words[0]), simd::template slli<12>(Words[1]))),
+				packed_signed_field<simd, 8, 20>(Words[1]),
+				packed_field<simd, 28, 2>(Words[1])};
+			packed_smallest_three_decode<simd, 20>(f, v);
+		}
+	};
+
+	// Loads and stores of the 2, 3 and 4 float elements without touching the
+	// bytes past them; quaternions are loaded in x, y, z, w order whatever their
+	// storage order
+	template<typename T>
+	struct packed_simd_element
+	{};
+
+	template<qualifier Q>
+	struct packed_simd_element<vec<2, float, Q> >
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 load(char const* p)
+		{
+			return _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(char* p, glm_f32vec4 v)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+		}
+	};
+
+	template<qualifier Q>
+	struct packed_simd_element<vec<3, float, Q> >
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 load(char const* p)
+		{
+			float z;
+			memcpy(&z, p + 2 * sizeof(float), sizeof(z));
+			return _mm_movelh_ps(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p))), _mm_set_ss(z));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(char* p, glm_f32vec4 v)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(v));
+			float const z = _mm_cvtss_f32(_mm_movehl_ps(v, v));
+			memcpy(p + 2 * sizeof(float), &z, sizeof(z));
+		}
+	};
+
+	template<qualifier Q>
+	struct packed_simd_element<vec<4, float, Q> >
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 load(char const* p)
+		{
+			return _mm_loadu_ps(reinterpret_cast<float const*>(p));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(char* p, glm_f32vec4 v)
+		{
+			_mm_storeu_ps(reinterpret_cast<float*>(p), v);
+		}
+	};
+
+	template<qualifier Q>
+	struct packed_simd_element<qua<float, Q> >
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 load(char const* p)
+		{
+			glm_f32vec4 const v = _mm_loadu_ps(reinterpret_cast<float const*>(p));
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 3, 2, 1));
+#			else
+				return v;
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static void store(char* p, glm_f32vec4 v)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				v = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 1, 0, 3));
+#			endif
+			_mm_storeu_ps(reinterpret_cast<float*>(p), v);
+		}
+	};
+
+	// simd::size elements per step, transposed to one register per component;
+	// the remainder goes through one zero padded block
+	template<typename Format, typename simd>
+	struct compute_packed_array_simd
+	{
+		typedef typename Format::value_type value_type;
+		typedef typename Format::packed_type packed_type;
+		typedef packed_simd_element<value_type> element;
+		enum { size = simd::size, groups = simd::size / 4 };
+
+		GLM_FUNC_QUALIFIER static void pack_block(char const* in, std::size_t inStride, char* out, std::size_t outStride)
+		{
+			glm_f32vec4 Parts[4][groups];
+			for(std::size_t g = 0; g < groups; ++g)
+			{
+				glm_f32vec4 r0 = element::load(in + (g * 4 + 0) * inStride);
+				glm_f32vec4 r1 = element::load(in + (g * 4 + 1) * inStride);
+				glm_f32vec4 r2 = element::load(in + (g * 4 + 2) * inStride);
+				glm_f32vec4 r3 = element::load(in + (g * 4 + 3) * inStride);
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				Parts[0][g] = r0;
+				Parts[1][g] = r1;
+				Parts[2][g] = r2;
+				Parts[3][g] = r3;
+			}
+
+			typename simd::fvec const v[4] = {simd::join(Parts[0]), simd::join(Parts[1]), simd::join(Parts[2]), simd::join(Parts[3])};
+			typename simd::ivec Words[2] = {simd::seti(0), simd::seti(0)};
+			compute_packed_simd<Format>::template pack<simd>(v, Words);
+
+			uint32 Low[size];
+			uint32 High[size];
+			simd::store(Low, Words[0]);
+			simd::store(High, Words[1]);
+			for(std::size_t j = 0; j < size; ++j)
+			{
+				packed_type const Packed = static_cast<packed_type>(static_cast<uint64>(Low[j]) | (static_cast<uint64>(High[j]) << 32));
+				memcpy(out + j * outStride, &Packed, sizeof(Packed));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack_block(char const* in, std::size_t inStride, char* out, std::size_t outStride)
+		{
+			uint32 Low[size];
+			uint32 High[size];
+			for(std::size_t j = 0; j < size; ++j)
+			{
+				packed_type Packed;
+				memcpy(&Packed, in + j * inStride, sizeof(Packed));
+				Low[j] = static_cast<uint32>(Packed);
+				High[j] = static_cast<uint32>(static_cast<uint64>(Packed) >> 32);
+			}
+
+			typename simd::ivec const Words[2] = {simd::load(Low), simd::load(High)};
+			typename simd::fvec v[4] = {simd::set(0.0f), simd::set(0.0f), simd::set(0.0f), simd::set(0.0f)};
+			compute_packed_simd<Format>::template unpack<simd>(Words, v);
+
+			glm_f32vec4 Parts[4][groups];
+			for(std::size_t c = 0; c < 4; ++c)
+				simd::split(v[c], Parts[c]);
+			for(std::size_t g = 0; g < groups; ++g)
+			{
+				glm_f32vec4 r0 = Parts[0][g];
+				glm_f32vec4 r1 = Parts[1][g];
+				glm_f32vec4 r2 = Parts[2][g];
+				glm_f32vec4 r3 = Parts[3][g];
+				_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+				element::store(out + (g * 4 + 0) * outStride, r0);
+				element::store(out + (g * 4 + 1) * outStride, r1);
+				element::store(out + (g * 4 + 2) * outStride, r2);
+				element::store(out + (g * 4 + 3) * outStride, r3);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void pack(char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + size <= count; i += size)
+				pack_block(in + i * inStride, inStride, out + i * outStride, outStride);
+			if(i < count)
+			{
+				value_type Block[size];
+				packed_type Packed[size];
+				memset(Block, 0, sizeof(Block));
+				for(std::size_t j = 0; i + j < count; ++j)
+					memcpy(&Block[j], in + (i + j) * inStride, sizeof(value_type));
+				pack_block(reinterpret_cast<char const*>(Block), sizeof(value_type), reinterpret_cast<char*>(Packed), sizeof(packed_type));
+				for(std::size_t j = 0; i + j < count; ++j)
+					memcpy(out + (i + j) * outStride, &Packed[j], sizeof(packed_type));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + size <= count; i += size)
+				unpack_block(in + i * inStride, inStride, out + i * outStride, outStride);
+			if(i < count)
+			{
+				packed_type Block[size];
+				value_type Unpacked[size];
+				for(std::size_t j = 0; j < size; ++j)
+					Block[j] = 0;
+				for(std::size_t j = 0; i + j < count; ++j)
+					memcpy(&Block[j], in + (i + j) * inStride, sizeof(packed_type));
+				unpack_block(reinterpret_cast<char const*>(Block), sizeof(packed_type), reinterpret_cast<char*>(Unpacked), sizeof(value_type));
+				for(std::size_t j = 0; i + j < count; ++j)
+					memcpy(out + (i + j) * outStride, &Unpacked[j], sizeof(value_type));
+			}
+		}
+	};
+
+	template<typename Format>
+	struct compute_packed_array<Format, true>
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		: public compute_packed_array_simd<Format, packed_simd_avx2>
+#	else
+		: public compute_packed_array_simd<Format, packed_simd_sse2>
+#	endif
+	{};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -93,6 +93,55 @@ namespace glm
 			// Will be optimized out completely
 			return qua<T, Q>::wxyz(T(1), T(0), T(0), T(0));
 		}
+
+		template<typename T, qualifier Q, bool Aligned>
+		struct compute_mat3_cast
+		{
+			GLM_FUNC_QUALIFIER static mat<3, 3, T, Q> call(qua<T, Q> const& q)
+			{
+				mat<3, 3, T, Q> Result(T(1));
+				T qxx(q.x * q.x);
+				T qyy(q.y * q.y);
+				T qzz(q.z * q.z);
+				T qxz(q.x * q.z);
+				T qxy(q.x * q.y);
+				T qyz(q.y * q.z);
+				T qwx(q.w * q.x);
+				T qwy(q.w * q.y);
+				T qwz(q.w * q.z);
+
+				Result[0][0] = T(1) - T(2) * (qyy +  qzz);
+				Result[0][1] = T(2) * (qxy + qwz);
+				Result[0][2] = T(2) * (qxz - qwy);
+
+				Result[1][0] = T(2) * (qxy - qwz);
+				Result[1][1] = T(1) - T(2) * (qxx +  qzz);
+				Result[1][2] = T(2) * (qyz + qwx);
+
+				Result[2][0] = T(2) * (qxz + qwy);
+				Result[2][1] = T(2) * (qyz - qwx);
+				Result[2][2] = T(1) - T(2) * (qxx +  qyy);
+				return Result;
+			}
+		};
+
+		template<typename T, qualifier Q, bool Aligned>
+		struct compute_mat4_cast
+		{
+			GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(qua<T, Q> const& q)
+			{
+				return mat<4, 4, T, Q>(mat3_cast(q));
+			}
+		};
+
+		template<length_t C, typename T, qualifier Q, bool Aligned>
+		struct compute_quat_cast
+		{
+			GLM_FUNC_QUALIFIER static qua<T, Q> call(mat<C, C, T, Q> const& m)
+			{
+				return quat_cast_impl<mat<C, C, T, Q>, T, Q>(m);
+			}
+		};
 	}//namespace detail
 
 	template<typename T, qualifier Q>
@@ -135,47 +184,25 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> mat3_cast(qua<T, Q> const& q)
 	{
-		mat<3, 3, T, Q> Result(T(1));
-		T qxx(q.x * q.x);
-		T qyy(q.y * q.y);
-		T qzz(q.z * q.z);
-		T qxz(q.x * q.z);
-		T qxy(q.x * q.y);
-		T qyz(q.y * q.z);
-		T qwx(q.w * q.x);
-		T qwy(q.w * q.y);
-		T qwz(q.w * q.z);
-
-		Result[0][0] = T(1) - T(2) * (qyy +  qzz);
-		Result[0][1] = T(2) * (qxy + qwz);
-		Result[0][2] = T(2) * (qxz - qwy);
-
-		Result[1][0] = T(2) * (qxy - qwz);
-		Result[1][1] = T(1) - T(2) * (qxx +  qzz);
-		Result[1][2] = T(2) * (qyz + qwx);
-
-		Result[2][0] = T(2) * (qxz + qwy);
-		Result[2][1] = T(2) * (qyz - qwx);
-		Result[2][2] = T(1) - T(2) * (qxx +  qyy);
-		return Result;
+		return detail::compute_mat3_cast<T, Q, detail::is_aligned<Q>::value>::call(q);
 	}
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(qua<T, Q> const& q)
 	{
-		return mat<4, 4, T, Q>(mat3_cast(q));
+		return detail::compute_mat4_cast<T, Q, detail::is_aligned<Q>::value>::call(q);
 	}
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER qua<T, Q> quat_cast(mat<3, 3, T, Q> const& m)
 	{
-		return detail::quat_cast_impl<mat<3, 3, T, Q>, T, Q>(m);
+		return detail::compute_quat_cast<3, T, Q, detail::is_aligned<Q>::value>::call(m);
 	}
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER qua<T, Q> quat_cast(mat<4, 4, T, Q> const& m)
 	{
-		return detail::quat_cast_impl<mat<4, 4, T, Q>, T, Q>(m);
+		return detail::compute_quat_cast<4, T, Q, detail::is_aligned<Q>::value>::call(m);
 	}
 
 	template<typename T, qualifier Q>
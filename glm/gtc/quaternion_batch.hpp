@@ -0,0 +1,85 @@
+/// @ref gtc_quaternion_batch
+/// @file glm/gtc/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+///
+/// @defgroup gtc_quaternion_batch GLM_GTC_quaternion_batch
+/// @ingroup gtc
+///
+/// Convert whole arrays of float quaternions to rotation matrices and back,
+/// as when a skinning matrix palette is built from N joint rotations and
+/// translations every frame.
+///
+/// With SIMD enabled, quaternions and matrices are transposed to one register
+/// per component and converted 8 at a time with AVX and 4 at a time with
+/// SSE2. The conversions use the expressions of mat3_cast and quat_cast;
+/// quat_cast selects its largest component with lane masks instead of
+/// branches and returns the same quaternions as the per-element function.
+/// The remainder of an array is padded into a single SIMD block. Other builds
+/// fall back to the per-element functions.
+///
+/// Include <glm/gtc/quaternion_batch.hpp> to use the features of this extension.
+
+#pragma once
+
+// Dependencies
+#include "../gtc/quaternion.hpp"
+#include "../mat3x3.hpp"
+#include "../mat4x3.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTC_quaternion_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup gtc_quaternion_batch
+	/// @{
+
+	/// Computes out[i] = mat3_cast(q[i]) for count elements.
+	///
+	/// @see glm::mat3_cast(qua<T, Q> const& x)
+	GLM_FUNC_DISCARD_DECL void mat3_cast(quat const* q, mat3* out, std::size_t count);
+
+	/// Computes out[i] = mat4_cast(q[i]) for count elements.
+	///
+	/// @see glm::mat4_cast(qua<T, Q> const& x)
+	GLM_FUNC_DISCARD_DECL void mat4_cast(quat const* q, mat4* out, std::size_t count);
+
+	/// Builds count rigid transforms: the first three columns of out[i] are
+	/// mat3_cast(q[i]) and the last one is t[i]. This is the 3 * 4 affine
+	/// layout of a skinning matrix palette.
+	GLM_FUNC_DISCARD_DECL void mat4x3_cast(quat const* q, vec3 const* t, mat4x3* out, std::size_t count);
+
+	/// Computes out[i] = quat_cast(m[i]) for count pure rotation matrices.
+	///
+	/// @see glm::quat_cast(mat<3, 3, T, Q> const& x)
+	GLM_FUNC_DISCARD_DECL void quat_cast(mat3 const* m, quat* out, std::size_t count);
+
+	/// Computes out[i] = quat_cast(m[i]) for count pure rotation matrices.
+	///
+	/// @see glm::quat_cast(mat<4, 4, T, Q> const& x)
+	GLM_FUNC_DISCARD_DECL void quat_cast(mat4 const* m, quat* out, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overloads; the inputs and out must have the same size.
+	GLM_FUNC_DISCARD_DECL void mat3_cast(std::span<quat const> q, std::span<mat3> out);
+	GLM_FUNC_DISCARD_DECL void mat4_cast(std::span<quat const> q, std::span<mat4> out);
+	GLM_FUNC_DISCARD_DECL void mat4x3_cast(std::span<quat const> q, std::span<vec3 const> t, std::span<mat4x3> out);
+	GLM_FUNC_DISCARD_DECL void quat_cast(std::span<mat3 const> m, std::span<quat> out);
+	GLM_FUNC_DISCARD_DECL void quat_cast(std::span<mat4 const> m, std::span<quat> out);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,120 @@
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	template<length_t C, length_t R>
+	struct batch_rotation_matrix
+	{};
+
+	template<>
+	struct batch_rotation_matrix<3, 3>
+	{
+		GLM_FUNC_QUALIFIER static mat3 call(quat const& q, vec3 const*, std::size_t) { return glm::mat3_cast(q); }
+	};
+
+	template<>
+	struct batch_rotation_matrix<4, 4>
+	{
+		GLM_FUNC_QUALIFIER static mat4 call(quat const& q, vec3 const*, std::size_t) { return glm::mat4_cast(q); }
+	};
+
+	template<>
+	struct batch_rotation_matrix<4, 3>
+	{
+		GLM_FUNC_QUALIFIER static mat4x3 call(quat const& q, vec3 const* t, std::size_t i)
+		{
+			mat4x3 Result(glm::mat3_cast(q));
+			Result[3] = t[i];
+			return Result;
+		}
+	};
+
+	// t is only read for 4 * 3 matrices
+	template<length_t C, length_t R, bool UseSimd>
+	struct compute_mat_cast_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* q, vec3 const* t, mat<C, R, float, defaultp>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = batch_rotation_matrix<C, R>::call(q[i], t, i);
+		}
+	};
+
+	template<length_t C, bool UseSimd>
+	struct compute_quat_cast_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<C, C, float, defaultp> const* m, quat* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::quat_cast(m[i]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_batch_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void mat3_cast(quat const* q, mat3* out, std::size_t count)
+	{
+		detail::compute_mat_cast_batch<3, 3, GLM_CONFIG_SIMD == GLM_ENABLE>::call(q, nullptr, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_cast(quat const* q, mat4* out, std::size_t count)
+	{
+		detail::compute_mat_cast_batch<4, 4, GLM_CONFIG_SIMD == GLM_ENABLE>::call(q, nullptr, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mat4x3_cast(quat const* q, vec3 const* t, mat4x3* out, std::size_t count)
+	{
+		detail::compute_mat_cast_batch<4, 3, GLM_CONFIG_SIMD == GLM_ENABLE>::call(q, t, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_cast(mat3 const* m, quat* out, std::size_t count)
+	{
+		detail::compute_quat_cast_batch<3, GLM_CONFIG_SIMD == GLM_ENABLE>::call(m, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void quat_cast(mat4 const* m, quat* out, std::size_t count)
+	{
+		detail::compute_quat_cast_batch<4, GLM_CONFIG_SIMD == GLM_ENABLE>::call(m, out, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void mat3_cast(std::span<quat const> q, std::span<mat3> out)
+	{
+		assert(q.size() == out.size());
+		mat3_cast(q.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void mat4_cast(std::span<quat const> q, std::span<mat4> out)
+	{
+		assert(q.size() == out.size());
+		mat4_cast(q.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void mat4x3_cast(std::span<quat const> q, std::span<vec3 const> t, std::span<mat4x3> out)
+	{
+		assert(q.size() == out.size() && t.size() == out.size());
+		mat4x3_cast(q.data(), t.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void quat_cast(std::span<mat3 const> m, std::span<quat> out)
+	{
+		assert(m.size() == out.size());
+		quat_cast(m.data(), out.data(), out.size());
+	}
+
+	GLM_FUNC_QUALIFIER void quat_cast(std::span<mat4 const> m, std::span<quat> out)
+	{
+		assert(m.size() == out.size());
+		quat_cast(m.data(), out.data(), out.size());
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
@@ -0,0 +1,484 @@
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Register of each quaternion component after the transpose
+	struct batch_quat_lane
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			enum { x = 1, y = 2, z = 3, w = 0 };
+#		else
+			enum { x = 0, y = 1, z = 2, w = 3 };
+#		endif
+	};
+
+	// Lane operations of the conversion kernels: 4 elements with SSE2, 8 with
+	// AVX. Element j of a block is read from and written to p + j * stride
+	// floats, or p[j] for gather; load and store transpose 4 consecutive
+	// floats of each element into 4 registers and back, load3 and store3 touch
+	// only 3 of them.
+	struct batch_quat_cast_sse
+	{
+		typedef __m128 fvec;
+		enum { size = 4 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static fvec andf(fvec a, fvec b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec orf(fvec a, fvec b) { return _mm_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec xorf(fvec a, fvec b) { return _mm_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmpgt(fvec a, fvec b) { return _mm_cmpgt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec select(fvec m, fvec a, fvec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+		GLM_FUNC_QUALIFIER static void load(float const* p, std::size_t stride, fvec* r)
+		{
+			fvec r0 = _mm_loadu_ps(p);
+			fvec r1 = _mm_loadu_ps(p + stride);
+			fvec r2 = _mm_loadu_ps(p + 2 * stride);
+			fvec r3 = _mm_loadu_ps(p + 3 * stride);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			r[0] = r0;
+			r[1] = r1;
+			r[2] = r2;
+			r[3] = r3;
+		}
+
+		// Three floats, without reading past the third
+		GLM_FUNC_QUALIFIER static __m128 load3(float const* p)
+		{
+			return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(p))), _mm_load_ss(p + 2));
+		}
+
+		GLM_FUNC_QUALIFIER static void load3(float const* p, std::size_t stride, fvec* r)
+		{
+			fvec r0 = load3(p);
+			fvec r1 = load3(p + stride);
+			fvec r2 = load3(p + 2 * stride);
+			fvec r3 = load3(p + 3 * stride);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			r[0] = r0;
+			r[1] = r1;
+			r[2] = r2;
+			r[3] = r3;
+		}
+
+		// 4 floats from each of size addresses
+		GLM_FUNC_QUALIFIER static void gather(float const* const* p, fvec* r)
+		{
+			fvec r0 = _mm_loadu_ps(p[0]);
+			fvec r1 = _mm_loadu_ps(p[1]);
+			fvec r2 = _mm_loadu_ps(p[2]);
+			fvec r3 = _mm_loadu_ps(p[3]);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			r[0] = r0;
+			r[1] = r1;
+			r[2] = r2;
+			r[3] = r3;
+		}
+
+		GLM_FUNC_QUALIFIER static fvec load1(float const* p, std::size_t stride)
+		{
+			return _mm_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t stride, fvec const* c)
+		{
+			fvec r0 = c[0], r1 = c[1], r2 = c[2], r3 = c[3];
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			_mm_storeu_ps(p, r0);
+			_mm_storeu_ps(p + stride, r1);
+			_mm_storeu_ps(p + 2 * stride, r2);
+			_mm_storeu_ps(p + 3 * stride, r3);
+		}
+
+		// Three floats, without writing past the third
+		GLM_FUNC_QUALIFIER static void store3(float* p, __m128 v)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+			_mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+		}
+
+		GLM_FUNC_QUALIFIER static void store3(float* p, std::size_t stride, fvec const* c)
+		{
+			fvec r0 = c[0], r1 = c[1], r2 = c[2], r3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			store3(p, r0);
+			store3(p + stride, r1);
+			store3(p + 2 * stride, r2);
+			store3(p + 3 * stride, r3);
+		}
+
+		GLM_FUNC_QUALIFIER static void store1(float* p, std::size_t stride, fvec c)
+		{
+			_mm_store_ss(p, c);
+			_mm_store_ss(p + stride, _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 1, 1)));
+			_mm_store_ss(p + 2 * stride, _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 2, 2, 2)));
+			_mm_store_ss(p + 3 * stride, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 3, 3)));
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Elements j and j + 4 share a row, so the 4 * 4 transpose stays within
+	// the 128-bit lanes
+	struct batch_quat_cast_avx
+	{
+		typedef __m256 fvec;
+		enum { size = 8 };
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec div(fvec a, fvec b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sqrt(fvec a) { return _mm256_sqrt_ps(a); }
+		GLM_FUNC_QUALIFIER static fvec andf(fvec a, fvec b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec orf(fvec a, fvec b) { return _mm256_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec xorf(fvec a, fvec b) { return _mm256_xor_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmpgt(fvec a, fvec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		GLM_FUNC_QUALIFIER static fvec select(fvec m, fvec a, fvec b) { return _mm256_blendv_ps(b, a, m); }
+
+		GLM_FUNC_QUALIFIER static void transpose(fvec* r)
+		{
+			fvec const t0 = _mm256_unpacklo_ps(r[0], r[1]);
+			fvec const t1 = _mm256_unpacklo_ps(r[2], r[3]);
+			fvec const t2 = _mm256_unpackhi_ps(r[0], r[1]);
+			fvec const t3 = _mm256_unpackhi_ps(r[2], r[3]);
+			r[0] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			r[1] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			r[2] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			r[3] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+
+		GLM_FUNC_QUALIFIER static fvec pair(__m128 Lo, __m128 Hi)
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(Lo), Hi, 1);
+		}
+
+		GLM_FUNC_QUALIFIER static void load(float const* p, std::size_t stride, fvec* r)
+		{
+			r[0] = pair(_mm_loadu_ps(p), _mm_loadu_ps(p + 4 * stride));
+			r[1] = pair(_mm_loadu_ps(p + stride), _mm_loadu_ps(p + 5 * stride));
+			r[2] = pair(_mm_loadu_ps(p + 2 * stride), _mm_loadu_ps(p + 6 * stride));
+			r[3] = pair(_mm_loadu_ps(p + 3 * stride), _mm_loadu_ps(p + 7 * stride));
+			transpose(r);
+		}
+
+		GLM_FUNC_QUALIFIER static void load3(float const* p, std::size_t stride, fvec* r)
+		{
+			r[0] = pair(batch_quat_cast_sse::load3(p), batch_quat_cast_sse::load3(p + 4 * stride));
+			r[1] = pair(batch_quat_cast_sse::load3(p + stride), batch_quat_cast_sse::load3(p + 5 * stride));
+			r[2] = pair(batch_quat_cast_sse::load3(p + 2 * stride), batch_quat_cast_sse::load3(p + 6 * stride));
+			r[3] = pair(batch_quat_cast_sse::load3(p + 3 * stride), batch_quat_cast_sse::load3(p + 7 * stride));
+			transpose(r);
+		}
+
+		GLM_FUNC_QUALIFIER static void gather(float const* const* p, fvec* r)
+		{
+			r[0] = pair(_mm_loadu_ps(p[0]), _mm_loadu_ps(p[4]));
+			r[1] = pair(_mm_loadu_ps(p[1]), _mm_loadu_ps(p[5]));
+			r[2] = pair(_mm_loadu_ps(p[2]), _mm_loadu_ps(p[6]));
+			r[3] = pair(_mm_loadu_ps(p[3]), _mm_loadu_ps(p[7]));
+			transpose(r);
+		}
+
+		GLM_FUNC_QUALIFIER static fvec load1(float const* p, std::size_t stride)
+		{
+			return _mm256_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride], p[4 * stride], p[5 * stride], p[6 * stride], p[7 * stride]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(float* p, std::size_t stride, fvec const* c)
+		{
+			fvec r[4] = {c[0], c[1], c[2], c[3]};
+			transpose(r);
+			_mm_storeu_ps(p, _mm256_castps256_ps128(r[0]));
+			_mm_storeu_ps(p + stride, _mm256_castps256_ps128(r[1]));
+			_mm_storeu_ps(p + 2 * stride, _mm256_castps256_ps128(r[2]));
+			_mm_storeu_ps(p + 3 * stride, _mm256_castps256_ps128(r[3]));
+			_mm_storeu_ps(p + 4 * stride, _mm256_extractf128_ps(r[0], 1));
+			_mm_storeu_ps(p + 5 * stride, _mm256_extractf128_ps(r[1], 1));
+			_mm_storeu_ps(p + 6 * stride, _mm256_extractf128_ps(r[2], 1));
+			_mm_storeu_ps(p + 7 * stride, _mm256_extractf128_ps(r[3], 1));
+		}
+
+		GLM_FUNC_QUALIFIER static void store3(float* p, std::size_t stride, fvec const* c)
+		{
+			fvec r[4] = {c[0], c[1], c[2], _mm256_setzero_ps()};
+			transpose(r);
+			batch_quat_cast_sse::store3(p, _mm256_castps256_ps128(r[0]));
+			batch_quat_cast_sse::store3(p + stride, _mm256_castps256_ps128(r[1]));
+			batch_quat_cast_sse::store3(p + 2 * stride, _mm256_castps256_ps128(r[2]));
+			batch_quat_cast_sse::store3(p + 3 * stride, _mm256_castps256_ps128(r[3]));
+			batch_quat_cast_sse::store3(p + 4 * stride, _mm256_extractf128_ps(r[0], 1));
+			batch_quat_cast_sse::store3(p + 5 * stride, _mm256_extractf128_ps(r[1], 1));
+			batch_quat_cast_sse::store3(p + 6 * stride, _mm256_extractf128_ps(r[2], 1));
+			batch_quat_cast_sse::store3(p + 7 * stride, _mm256_extractf128_ps(r[3], 1));
+		}
+
+		GLM_FUNC_QUALIFIER static void store1(float* p, std::size_t stride, fvec c)
+		{
+			batch_quat_cast_sse::store1(p, stride, _mm256_castps256_ps128(c));
+			batch_quat_cast_sse::store1(p + 4 * stride, stride, _mm256_extractf128_ps(c, 1));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// mat3_cast of q (x, y, z, w) into m, m[c * 3 + r] holding column c, row r
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_to_mat3(typename simd::fvec const* q, typename simd::fvec* m)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const One = simd::set(1.0f);
+		fvec const Two = simd::set(2.0f);
+		fvec const qxx = simd::mul(q[0], q[0]);
+		fvec const qyy = simd::mul(q[1], q[1]);
+		fvec const qzz = simd::mul(q[2], q[2]);
+		fvec const qxz = simd::mul(q[0], q[2]);
+		fvec const qxy = simd::mul(q[0], q[1]);
+		fvec const qyz = simd::mul(q[1], q[2]);
+		fvec const qwx = simd::mul(q[3], q[0]);
+		fvec const qwy = simd::mul(q[3], q[1]);
+		fvec const qwz = simd::mul(q[3], q[2]);
+
+		m[0] = simd::sub(One, simd::mul(Two, simd::add(qyy, qzz)));
+		m[1] = simd::mul(Two, simd::add(qxy, qwz));
+		m[2] = simd::mul(Two, simd::sub(qxz, qwy));
+
+		m[3] = simd::mul(Two, simd::sub(qxy, qwz));
+		m[4] = simd::sub(One, simd::mul(Two, simd::add(qxx, qzz)));
+		m[5] = simd::mul(Two, simd::add(qyz, qwx));
+
+		m[6] = simd::mul(Two, simd::add(qxz, qwy));
+		m[7] = simd::mul(Two, simd::sub(qyz, qwx));
+		m[8] = simd::sub(One, simd::mul(Two, simd::add(qxx, qyy)));
+	}
+
+	// quat_cast_impl with the switch on the largest component replaced by lane
+	// selects, in the same order of priority (w, x, y, z)
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_mat3_to_quat(typename simd::fvec const* m, typename simd::fvec* q)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const FourW = simd::add(simd::add(m[0], m[4]), m[8]);
+		fvec const FourX = simd::sub(simd::sub(m[0], m[4]), m[8]);
+		fvec const FourY = simd::sub(simd::sub(m[4], m[0]), m[8]);
+		fvec const FourZ = simd::sub(simd::sub(m[8], m[0]), m[4]);
+
+		fvec Biggest = FourW;
+		fvec const IsX = simd::cmpgt(FourX, Biggest);
+		Biggest = simd::select(IsX, FourX, Biggest);
+		fvec const IsY = simd::cmpgt(FourY, Biggest);
+		Biggest = simd::select(IsY, FourY, Biggest);
+		fvec const IsZ = simd::cmpgt(FourZ, Biggest);
+		Biggest = simd::select(IsZ, FourZ, Biggest);
+
+		fvec const BiggestVal = simd::mul(simd::sqrt(simd::add(Biggest, simd::set(1.0f))), simd::set(0.5f));
+		fvec const Mult = simd::div(simd::set(0.25f), BiggestVal);
+
+		fvec const yz_zy = simd::sub(m[5], m[7]);
+		fvec const zx_xz = simd::sub(m[6], m[2]);
+		fvec const xy_yx = simd::sub(m[1], m[3]);
+		fvec const xy_plus_yx = simd::add(m[1], m[3]);
+		fvec const zx_plus_xz = simd::add(m[6], m[2]);
+		fvec const yz_plus_zy = simd::add(m[5], m[7]);
+
+		// A later mask takes precedence, so the intermediate selects need not
+		// exclude it; the lane of the largest component is replaced by BiggestVal
+		fvec const w = simd::select(IsZ, xy_yx, simd::select(IsY, zx_xz, yz_zy));
+		fvec const x = simd::select(IsZ, zx_plus_xz, simd::select(IsY, xy_plus_yx, yz_zy));
+		fvec const y = simd::select(IsZ, yz_plus_zy, simd::select(IsX, xy_plus_yx, zx_xz));
+		fvec const z = simd::select(IsY, yz_plus_zy, simd::select(IsX, zx_plus_xz, xy_yx));
+
+		fvec const IsYOnly = simd::select(IsZ, simd::set(0.0f), IsY);
+		fvec const IsXOnly = simd::select(simd::orf(IsY, IsZ), simd::set(0.0f), IsX);
+		fvec const NotW = simd::orf(simd::orf(IsX, IsY), IsZ);
+		q[0] = simd::select(IsXOnly, BiggestVal, simd::mul(x, Mult));
+		q[1] = simd::select(IsYOnly, BiggestVal, simd::mul(y, Mult));
+		q[2] = simd::select(IsZ, BiggestVal, simd::mul(z, Mult));
+		q[3] = simd::select(NotW, simd::mul(w, Mult), BiggestVal);
+	}
+
+	// Columns of 3 floats are stored back to back, so a packed matrix is
+	// written in runs of 4 floats that cross the columns; columns of 4 floats
+	// (aligned vec3, or vec4) are written one at a time
+	template<length_t C, length_t R, typename simd>
+	GLM_FUNC_QUALIFIER void batch_mat_cast_block(quat const* q, vec3 const* t, mat<C, R, float, defaultp>* out)
+	{
+		typedef typename simd::fvec fvec;
+		std::size_t const Stride = sizeof(typename mat<C, R, float, defaultp>::col_type) / sizeof(float);
+		std::size_t const Floats = C * Stride;
+
+		fvec v[4], Rotation[4], m[9];
+		simd::load(reinterpret_cast<float const*>(q), 4, v);
+		Rotation[0] = v[batch_quat_lane::x];
+		Rotation[1] = v[batch_quat_lane::y];
+		Rotation[2] = v[batch_quat_lane::z];
+		Rotation[3] = v[batch_quat_lane::w];
+		batch_quat_to_mat3<simd>(Rotation, m);
+
+		fvec Translation[4];
+		if constexpr(C == 4 && R == 3)
+		{
+			if constexpr(sizeof(vec3) == 3 * sizeof(float))
+				simd::load3(reinterpret_cast<float const*>(t), 3, Translation);
+			else
+				simd::load(reinterpret_cast<float const*>(t), sizeof(vec3) / sizeof(float), Translation);
+		}
+
+		fvec const Zero = simd::set(0.0f);
+		float* p = reinterpret_cast<float*>(out);
+		if constexpr(Stride == 3)
+		{
+			fvec const Run0[4] = {m[0], m[1], m[2], m[3]};
+			fvec const Run1[4] = {m[4], m[5], m[6], m[7]};
+			simd::store(p, Floats, Run0);
+			simd::store(p + 4, Floats, Run1);
+			if constexpr(C == 4)
+			{
+				fvec const Run2[4] = {m[8], Translation[0], Translation[1], Translation[2]};
+				simd::store(p + 8, Floats, Run2);
+			}
+			else
+				simd::store1(p + 8, Floats, m[8]);
+		}
+		else
+		{
+			fvec const Column0[4] = {m[0], m[1], m[2], Zero};
+			fvec const Column1[4] = {m[3], m[4], m[5], Zero};
+			fvec const Column2[4] = {m[6], m[7], m[8], Zero};
+			simd::store(p, Floats, Column0);
+			simd::store(p + 4, Floats, Column1);
+			simd::store(p + 8, Floats, Column2);
+			if constexpr(C == 4 && R == 4)
+			{
+				fvec const Column3[4] = {Zero, Zero, Zero, simd::set(1.0f)};
+				simd::store(p + 12, Floats, Column3);
+			}
+			else if constexpr(C == 4)
+			{
+				fvec const Column3[4] = {Translation[0], Translation[1], Translation[2], Zero};
+				simd::store(p + 12, Floats, Column3);
+			}
+		}
+	}
+
+	// Only the upper 3 * 3 block is read
+	template<length_t C, typename simd>
+	GLM_FUNC_QUALIFIER void batch_quat_cast_block(mat<C, C, float, defaultp> const* in, quat* out)
+	{
+		typedef typename simd::fvec fvec;
+		std::size_t const Stride = sizeof(typename mat<C, C, float, defaultp>::col_type) / sizeof(float);
+		std::size_t const Floats = C * Stride;
+
+		float const* p = reinterpret_cast<float const*>(in);
+		fvec m[9];
+		if constexpr(Stride == 3)
+		{
+			simd::load(p, Floats, m);
+			simd::load(p + 4, Floats, m + 4);
+			m[8] = simd::load1(p + 8, Floats);
+		}
+		else
+		{
+			fvec Column0[4], Column1[4], Column2[4];
+			simd::load(p, Floats, Column0);
+			simd::load(p + 4, Floats, Column1);
+			simd::load(p + 8, Floats, Column2);
+			m[0] = Column0[0];
+			m[1] = Column0[1];
+			m[2] = Column0[2];
+			m[3] = Column1[0];
+			m[4] = Column1[1];
+			m[5] = Column1[2];
+			m[6] = Column2[0];
+			m[7] = Column2[1];
+			m[8] = Column2[2];
+		}
+
+		fvec Result[4], v[4];
+		batch_mat3_to_quat<simd>(m, Result);
+		v[batch_quat_lane::x] = Result[0];
+		v[batch_quat_lane::y] = Result[1];
+		v[batch_quat_lane::z] = Result[2];
+		v[batch_quat_lane::w] = Result[3];
+		simd::store(reinterpret_cast<float*>(out), 4, v);
+	}
+
+	template<length_t C, length_t R>
+	struct compute_mat_cast_batch<C, R, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(quat const* q, vec3 const* t, mat<C, R, float, defaultp>* out, std::size_t count)
+		{
+			bool const Translate = C == 4 && R == 3;
+
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= count; i += 8)
+				batch_mat_cast_block<C, R, batch_quat_cast_avx>(q + i, Translate ? t + i : t, out + i);
+#			endif
+			for(; i + 4 <= count; i += 4)
+				batch_mat_cast_block<C, R, batch_quat_cast_sse>(q + i, Translate ? t + i : t, out + i);
+
+			// Pad the remainder with identities into one block so it goes through the same kernel
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				quat Q[4];
+				vec3 T[4];
+				mat<C, R, float, defaultp> Result[4];
+				for(std::size_t j = 0; j < 4; ++j)
+				{
+					Q[j] = quat::wxyz(1.f, 0.f, 0.f, 0.f);
+					T[j] = vec3(0.f);
+				}
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					Q[j] = q[i + j];
+					if(Translate)
+						T[j] = t[i + j];
+				}
+				batch_mat_cast_block<C, R, batch_quat_cast_sse>(Q, T, Result);
+				for(std::size_t j = 0; j < n; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+
+	template<length_t C>
+	struct compute_quat_cast_batch<C, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<C, C, float, defaultp> const* m, quat* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= count; i += 8)
+				batch_quat_cast_block<C, batch_quat_cast_avx>(m + i, out + i);
+#			endif
+			for(; i + 4 <= count; i += 4)
+				batch_quat_cast_block<C, batch_quat_cast_sse>(m + i, out + i);
+
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				mat<C, C, float, defaultp> M[4];
+				quat Result[4];
+				for(std::size_t j = 0; j < 4; ++j)
+					M[j] = mat<C, C, float, defaultp>(1.f);
+				for(std::size_t j = 0; j < n; ++j)
+					M[j] = m[i + j];
+				batch_quat_cast_block<C, batch_quat_cast_sse>(M, Result);
+				for(std::size_t j = 0; j < n; ++j)
+					out[i + j] = Result[j];
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -91,3 +91,138 @@ GLM_FUNC_QUALIFIER mat<3, 3, float, aligned_highp> mat3_cast(qua<float, aligned_
 
 #endif // GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 #endif // GLM_ARCH & GLM_ARCH_CLANG_BIT
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+namespace glm{
+namespace detail
+{
+	// Quaternion components in x, y, z, w lane order, whatever the storage order
+	GLM_FUNC_QUALIFIER glm_f32vec4 glm_quat_load_xyzw(glm_f32vec4 q)
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			return _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 3, 2, 1));
+#		else
+			return q;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm_f32vec4 glm_quat_store_xyzw(glm_f32vec4 q)
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			return _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 1, 0, 3));
+#		else
+			return q;
+#		endif
+	}
+
+	// Column i is k + s * (e + f), with e and f the products of the
+	// mat3_cast formula; the w lanes are zero.
+	GLM_FUNC_QUALIFIER void glm_quat_to_mat3(glm_f32vec4 q, glm_f32vec4 c[3])
+	{
+		glm_f32vec4 const e0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 0, 1)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 1, 1)));
+		glm_f32vec4 const f0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 2)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 2, 2)));
+		glm_f32vec4 const e1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 2, 0, 1)));
+		glm_f32vec4 const f1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 2, 3)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+		glm_f32vec4 const e2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 1, 0)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 0, 2, 2)));
+		glm_f32vec4 const f2 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 3, 3)), _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 1)));
+
+		c[0] = _mm_add_ps(_mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f), _mm_mul_ps(_mm_setr_ps(-2.0f, 2.0f, 2.0f, 0.0f), _mm_add_ps(e0, _mm_xor_ps(f0, _mm_setr_ps(0.0f, 0.0f, -0.0f, 0.0f)))));
+		c[1] = _mm_add_ps(_mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f), _mm_mul_ps(_mm_setr_ps(2.0f, -2.0f, 2.0f, 0.0f), _mm_add_ps(e1, _mm_xor_ps(f1, _mm_setr_ps(-0.0f, 0.0f, 0.0f, 0.0f)))));
+		c[2] = _mm_add_ps(_mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f), _mm_mul_ps(_mm_setr_ps(2.0f, 2.0f, -2.0f, 0.0f), _mm_add_ps(e2, _mm_xor_ps(f2, _mm_setr_ps(0.0f, -0.0f, 0.0f, 0.0f)))));
+	}
+
+	// quat_cast_impl without branches: the largest of the four candidates is
+	// chosen with the same priority (w, x, y, z), then the component
+	// expressions of all four cases are blended by lane masks.
+	GLM_FUNC_QUALIFIER glm_f32vec4 glm_mat3_to_quat(glm_f32vec4 c0, glm_f32vec4 c1, glm_f32vec4 c2)
+	{
+		// Diagonal (m00, m11, m22) and the candidates 4 * c^2 - 1 in x, y, z, w lanes
+		glm_f32vec4 const d = _mm_shuffle_ps(_mm_shuffle_ps(c0, c1, _MM_SHUFFLE(1, 1, 0, 0)), c2, _MM_SHUFFLE(2, 2, 2, 0));
+		glm_f32vec4 const Sign = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		glm_f32vec4 const a = _mm_shuffle_ps(d, d, _MM_SHUFFLE(0, 2, 1, 0));
+		glm_f32vec4 const b = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 0, 1)), Sign);
+		glm_f32vec4 const c = _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 1, 2, 2)), Sign);
+		glm_f32vec4 const Four = _mm_add_ps(_mm_add_ps(a, b), c);
+
+		glm_f32vec4 Biggest = _mm_max_ps(Four, _mm_shuffle_ps(Four, Four, _MM_SHUFFLE(2, 3, 0, 1)));
+		Biggest = _mm_max_ps(Biggest, _mm_shuffle_ps(Biggest, Biggest, _MM_SHUFFLE(1, 0, 3, 2)));
+
+		// First lane equal to the largest, in w, x, y, z order
+		int const Equal = _mm_movemask_ps(_mm_cmpeq_ps(Four, Biggest));
+		int const Ordered = ((Equal << 1) | (Equal >> 3)) & 0xF;
+		int const First = Ordered & -Ordered;
+		int const Lane = (First >> 1) | ((First & 1) << 3);
+		__m128i const Bits = _mm_setr_epi32(1, 2, 4, 8);
+		glm_f32vec4 const Mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(Lane), Bits), Bits));
+
+		glm_f32vec4 const BiggestVal = _mm_mul_ps(_mm_sqrt_ps(_mm_add_ps(Biggest, _mm_set1_ps(1.0f))), _mm_set1_ps(0.5f));
+		glm_f32vec4 const Mult = _mm_div_ps(_mm_set1_ps(0.25f), BiggestVal);
+
+		// (m12, m20, m01) and (m21, m02, m10)
+		glm_f32vec4 const p = _mm_shuffle_ps(_mm_shuffle_ps(c1, c2, _MM_SHUFFLE(0, 0, 2, 2)), c0, _MM_SHUFFLE(1, 1, 2, 0));
+		glm_f32vec4 const n = _mm_shuffle_ps(_mm_shuffle_ps(c2, c0, _MM_SHUFFLE(2, 2, 1, 1)), c1, _MM_SHUFFLE(0, 0, 2, 0));
+		glm_f32vec4 const Diff = _mm_sub_ps(p, n);
+		glm_f32vec4 const Sum = _mm_add_ps(p, n);
+
+		// The lane of the largest component is replaced by BiggestVal
+		glm_f32vec4 const CaseX = _mm_shuffle_ps(Sum, Diff, _MM_SHUFFLE(0, 0, 1, 2));
+		glm_f32vec4 const CaseY = _mm_shuffle_ps(Sum, Diff, _MM_SHUFFLE(1, 1, 0, 2));
+		glm_f32vec4 const CaseZ = _mm_shuffle_ps(Sum, Diff, _MM_SHUFFLE(2, 2, 0, 1));
+		glm_f32vec4 Num = _mm_and_ps(_mm_shuffle_ps(Mask, Mask, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(CaseX, CaseX, _MM_SHUFFLE(2, 1, 0, 0)));
+		Num = _mm_or_ps(Num, _mm_and_ps(_mm_shuffle_ps(Mask, Mask, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(CaseY, CaseY, _MM_SHUFFLE(2, 1, 0, 0))));
+		Num = _mm_or_ps(Num, _mm_and_ps(_mm_shuffle_ps(Mask, Mask, _MM_SHUFFLE(2, 2, 2, 2)), CaseZ));
+		Num = _mm_or_ps(Num, _mm_and_ps(_mm_shuffle_ps(Mask, Mask, _MM_SHUFFLE(3, 3, 3, 3)), Diff));
+
+		return _mm_or_ps(_mm_and_ps(Mask, BiggestVal), _mm_andnot_ps(Mask, _mm_mul_ps(Num, Mult)));
+	}
+
+	template<qualifier Q>
+	struct compute_mat3_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(qua<float, Q> const& q)
+		{
+			glm_f32vec4 c[3];
+			glm_quat_to_mat3(glm_quat_load_xyzw(q.data), c);
+
+			mat<3, 3, float, Q> Result;
+			Result[0].data = c[0];
+			Result[1].data = c[1];
+			Result[2].data = c[2];
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(qua<float, Q> const& q)
+		{
+			glm_f32vec4 c[3];
+			glm_quat_to_mat3(glm_quat_load_xyzw(q.data), c);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = c[0];
+			Result[1].data = c[1];
+			Result[2].data = c[2];
+			Result[3].data = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			return Result;
+		}
+	};
+
+	template<length_t C, qualifier Q>
+	struct compute_quat_cast<C, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(mat<C, C, float, Q> const& m)
+		{
+			qua<float, Q> Result;
+			Result.data = glm_quat_store_xyzw(glm_mat3_to_quat(m[0].data, m[1].data, m[2].data));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
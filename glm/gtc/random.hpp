@@ -10,6 +10,17 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// The functions without a generator parameter draw from std::rand. Each
+/// function also has an overload taking a generator object, either a
+/// xoshiro128x8 or any standard uniform random bit generator producing
+/// 32-bit values, so that every thread or caller can own its generator and
+/// its sequence; the glm::batch functions fill whole arrays from one.
+///
+/// The functions taking a philox4x32 and an index are counter based: the
+/// value is a pure function of the seed, the stream and the index, so a range
+/// of indices can be split between any number of jobs without changing the
+/// results.
 
 #pragma once
 
@@ -17,6 +28,10 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -46,7 +61,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
 
-	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
+	/// Generate random numbers according a gaussian distribution of the given mean and standard deviation
 	///
 	/// @see gtc_random
 	template<typename genType>
@@ -76,7 +91,263 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Pseudo-random generator running 8 interleaved xoshiro128++ streams.
+	///
+	/// Each call to operator() returns the next value of the next stream, in a
+	/// round robin, and the streams are stepped together: with SIMD enabled, 8
+	/// lanes at a time with AVX2 or 4 at a time with SSE2. The sequence only
+	/// depends on the seed and the stream, not on the instruction set.
+	///
+	/// Satisfies the UniformRandomBitGenerator requirements, so it can also
+	/// feed the standard library distributions. A generator is not meant to be
+	/// shared between threads: give each thread its own stream instead.
+	///
+	/// @see gtc_random
+	struct xoshiro128x8
+	{
+		typedef uint32 result_type;
+
+		/// Seeds the 8 streams from seed and stream with splitmix64; the
+		/// streams of one seed give unrelated sequences.
+		GLM_FUNC_DISCARD_DECL explicit xoshiro128x8(uint64 seed = 0, uint64 stream = 0);
+
+		GLM_FUNC_DISCARD_DECL void seed(uint64 seed, uint64 stream = 0);
+
+		GLM_FUNC_DECL static constexpr result_type min(){return 0;}
+		GLM_FUNC_DECL static constexpr result_type max(){return 0xFFFFFFFFu;}
+
+		/// Returns the next 32-bit value
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Writes the next count values, as count calls to operator() would
+		GLM_FUNC_DISCARD_DECL void generate(uint32* out, std::size_t count);
+
+		/// Writes count floats uniformly distributed in [0, 1), each made of
+		/// the 24 high bits of the next value
+		GLM_FUNC_DISCARD_DECL void generate(float* out, std::size_t count);
+
+		/// Lane l of the four state words of the streams
+		uint32 state[4][8];
+		/// The last values produced, returned before stepping the streams again
+		uint32 buffer[8];
+		uint32 index;
+	};
+
+	/// Counter-based generator: the Philox4x32-10 block cipher of Salmon et
+	/// al., keyed by a seed.
+	///
+	/// Block b is the encryption of the counter (b, stream), four 32-bit values
+	/// that only depend on the seed, the stream and b. The generator holds no
+	/// other state and can be shared between threads. With SIMD enabled, the
+	/// batch functions encrypt 8 blocks at a time with AVX2 and 4 at a time
+	/// with SSE2.
+	///
+	/// @see gtc_random
+	struct philox4x32
+	{
+		GLM_FUNC_DISCARD_DECL explicit philox4x32(uint64 seed = 0, uint64 stream = 0);
+
+		/// Returns the four values of the block
+		GLM_FUNC_DECL vec<4, uint32, defaultp> operator()(uint64 block) const;
+
+		uint32 key[2];
+		/// The two high words of the counters
+		uint32 stream[2];
+	};
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @param Min Minimum value included in the sampling
+	/// @param Max Maximum value included in the sampling
+	/// @param Generator Source of uniformly distributed 32-bit values.
+	/// @tparam genType Value type. Currently supported: integer, float or double scalars.
+	/// @see gtc_random
+	template<typename genType, typename genRNG>
+	GLM_FUNC_DECL genType linearRand(genType Min, genType Max, genRNG& Generator);
+
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @param Min Minimum value included in the sampling
+	/// @param Max Maximum value included in the sampling
+	/// @param Generator Source of uniformly distributed 32-bit values.
+	/// @tparam T Value type. Currently supported: integer, float or double.
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, genRNG& Generator);
+
+	/// Generate random numbers according a gaussian distribution of the given mean and standard deviation
+	///
+	/// @see gtc_random
+	template<typename genType, typename genRNG>
+	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation, genRNG& Generator);
+
+	/// Generate random numbers according a gaussian distribution of the given mean and standard deviation
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_DECL vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, genRNG& Generator);
+
+	/// Generate a random 2D vector which coordinates are regularly distributed on a circle of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename genRNG>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius, genRNG& Generator);
+
+	/// Generate a random 3D vector which coordinates are regularly distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename genRNG>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius, genRNG& Generator);
+
+	/// Generate a random 2D vector which coordinates are regularly distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename genRNG>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius, genRNG& Generator);
+
+	/// Generate a random 3D vector which coordinates are regularly distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename genRNG>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius, genRNG& Generator);
+
+	/// Returns the value of index Index in the interval [Min, Max), according a linear distribution.
+	///
+	/// Index i draws the 24 high bits of value i % 4 of block i / 4.
+	///
+	/// @tparam genType float or double.
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType linearRand(genType Min, genType Max, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the vector of index Index, component c drawing value c of block Index.
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the value of index Index according a gaussian distribution.
+	///
+	/// Index i applies the Box-Muller transform to values 2 * (i % 2) and
+	/// 2 * (i % 2) + 1 of block i / 2.
+	///
+	/// @see gtc_random
+	template<typename genType>
+	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the point of index Index on a circle, drawn from block Index.
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the point of index Index on a sphere, drawn from block Index.
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the point of index Index within a disk, drawn from block Index.
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius, philox4x32 const& Generator, uint64 Index);
+
+	/// Returns the point of index Index within a ball, drawn from block Index.
+	///
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius, philox4x32 const& Generator, uint64 Index);
+
+	/// @}
+
+namespace batch
+{
+	/// @addtogroup gtc_random
+	/// @{
+
+	/// Fills out with count values of linearRand(Min, Max, Generator).
+	///
+	/// With a xoshiro128x8 generator, float values are drawn with its SIMD
+	/// generate(float*, count).
+	///
+	/// @tparam T float or double.
+	template<typename T, typename genRNG>
+	GLM_FUNC_DISCARD_DECL void linearRand(T* out, std::size_t count, T Min, T Max, genRNG& Generator);
+
+	/// Fills out with count vectors of linearRand(Min, Max, Generator).
+	///
+	/// @tparam T float or double.
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_DISCARD_DECL void linearRand(vec<L, T, Q>* out, std::size_t count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, genRNG& Generator);
+
+	/// Fills out with count values of a gaussian distribution, drawn with the
+	/// Box-Muller transform over the batch log and sincos kernels.
+	template<typename genRNG>
+	GLM_FUNC_DISCARD_DECL void gaussRand(float* out, std::size_t count, float Mean, float Deviation, genRNG& Generator);
+
+	/// Fills out with the values of the indices [first, first + count) of
+	/// linearRand(Min, Max, Generator, Index).
+	///
+	/// The counter-based batch functions evaluate whole chunks of blocks with
+	/// the batch transcendental kernels: the value of an index does not depend
+	/// on the range it is part of, and agrees with the scalar function up to
+	/// their precision.
+	GLM_FUNC_DISCARD_DECL void linearRand(float* out, std::size_t count, float Min, float Max, philox4x32 const& Generator, uint64 first);
+
+	/// Fills out with the values of the indices [first, first + count) of
+	/// gaussRand(Mean, Deviation, Generator, Index).
+	GLM_FUNC_DISCARD_DECL void gaussRand(float* out, std::size_t count, float Mean, float Deviation, philox4x32 const& Generator, uint64 first);
+
+	/// Fills out with the points of the indices [first, first + count) of
+	/// circularRand(Radius, Generator, Index).
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRand(vec<2, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first);
+
+	/// Fills out with the points of the indices [first, first + count) of
+	/// sphericalRand(Radius, Generator, Index).
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRand(vec<3, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first);
+
+	/// Fills out with the points of the indices [first, first + count) of
+	/// diskRand(Radius, Generator, Index).
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRand(vec<2, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first);
+
+	/// Fills out with the points of the indices [first, first + count) of
+	/// ballRand(Radius, Generator, Index).
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void ballRand(vec<3, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first);
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_DISCARD_DECL void linearRand(std::span<float> out, float Min, float Max, philox4x32 const& Generator, uint64 first);
+	GLM_FUNC_DISCARD_DECL void gaussRand(std::span<float> out, float Mean, float Deviation, philox4x32 const& Generator, uint64 first);
+
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRand(std::span<vec<2, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first);
+
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRand(std::span<vec<3, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first);
+
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRand(std::span<vec<2, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first);
+
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void ballRand(std::span<vec<3, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first);
+
+	template<typename T, typename genRNG>
+	GLM_FUNC_DISCARD_DECL void linearRand(std::span<T> out, std::type_identity_t<T> Min, std::type_identity_t<T> Max, genRNG& Generator);
+
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_DISCARD_DECL void linearRand(std::span<vec<L, T, Q> > out, std::type_identity_t<vec<L, T, Q> > const& Min, std::type_identity_t<vec<L, T, Q> > const& Max, genRNG& Generator);
+
+	template<typename genRNG>
+	GLM_FUNC_DISCARD_DECL void gaussRand(std::span<float> out, float Mean, float Deviation, genRNG& Generator);
+#	endif//GLM_HAS_SPAN
+
 	/// @}
+}//namespace batch
 }//namespace glm
 
 #include "random.inl"
@@ -2,10 +2,13 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
+#include "../ext/scalar_transcendental_batch.hpp"
 #include <cstdlib>
 #include <ctime>
 #include <cassert>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace glm{
 namespace detail
@@ -226,9 +229,9 @@ namespace detail
 			x2 = linearRand(genType(-1), genType(1));
 
 			w = x1 * x1 + x2 * x2;
-		} while(w > genType(1));
+		} while(w > genType(1) || w <= genType(0));
 
-		return static_cast<genType>(x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
+		return static_cast<genType>(x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
 	}
 
 	template<length_t L, typename T, qualifier Q>
@@ -301,3 +304,730 @@ namespace detail
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint32 rotl_xoshiro(uint32 x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	// Steps the 8 xoshiro128++ streams Steps times, writing 8 values per step
+	template<bool UseSimd>
+	struct compute_xoshiro128x8
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], uint32* Out, std::size_t Steps)
+		{
+			for(std::size_t i = 0; i < Steps; ++i, Out += 8)
+			for(length_t l = 0; l < 8; ++l)
+			{
+				Out[l] = rotl_xoshiro(State[0][l] + State[3][l], 7) + State[0][l];
+				uint32 const t = State[1][l] << 9;
+				State[2][l] ^= State[0][l];
+				State[3][l] ^= State[1][l];
+				State[1][l] ^= State[2][l];
+				State[0][l] ^= State[3][l];
+				State[2][l] ^= t;
+				State[3][l] = rotl_xoshiro(State[3][l], 11);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], float* Out, std::size_t Steps)
+		{
+			uint32 Bits[8];
+			for(std::size_t i = 0; i < Steps; ++i, Out += 8)
+			{
+				call(State, Bits, 1);
+				for(length_t l = 0; l < 8; ++l)
+					Out[l] = static_cast<float>(Bits[l] >> 8) * (1.0f / 16777216.0f);
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
+	{
+		uint64 z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	// Generators must produce the full range of 32-bit values
+	template<typename genRNG>
+	GLM_FUNC_QUALIFIER uint32 rand_bits32(genRNG& Generator)
+	{
+		static_assert(genRNG::min() == 0 && genRNG::max() == 0xFFFFFFFFu, "'Generator' must produce uniformly distributed 32-bit values");
+		return static_cast<uint32>(Generator());
+	}
+
+	template<typename genRNG>
+	GLM_FUNC_QUALIFIER uint64 rand_bits64(genRNG& Generator)
+	{
+		uint64 const High = rand_bits32(Generator);
+		return (High << 32) | rand_bits32(Generator);
+	}
+
+	template<typename T, bool IsInteger = std::numeric_limits<T>::is_integer>
+	struct compute_linearRand_generator
+	{
+		// [0, 1) from the 24 high bits of one value
+		template<typename genRNG>
+		GLM_FUNC_QUALIFIER static float unit(genRNG& Generator, float)
+		{
+			return static_cast<float>(rand_bits32(Generator) >> 8) * (1.0f / 16777216.0f);
+		}
+
+		// [0, 1) from 53 bits of two values
+		template<typename genRNG, typename U>
+		GLM_FUNC_QUALIFIER static U unit(genRNG& Generator, U)
+		{
+			uint32 const High = rand_bits32(Generator) >> 5;
+			uint32 const Low = rand_bits32(Generator) >> 6;
+			return static_cast<U>((static_cast<double>(High) * 67108864.0 + static_cast<double>(Low)) * (1.0 / 9007199254740992.0));
+		}
+
+		template<typename genRNG>
+		GLM_FUNC_QUALIFIER static T call(T Min, T Max, genRNG& Generator)
+		{
+			return Min + (Max - Min) * unit(Generator, T(0));
+		}
+	};
+
+	// Unbiased integers in [Min, Max]: multiply-shift with rejection up to 32
+	// bits, modulo with rejection beyond
+	template<typename T>
+	struct compute_linearRand_generator<T, true>
+	{
+		typedef typename std::make_unsigned<T>::type U;
+
+		template<typename genRNG>
+		GLM_FUNC_QUALIFIER static T call(T Min, T Max, genRNG& Generator)
+		{
+			assert(Min <= Max);
+
+			if(sizeof(T) <= sizeof(uint32))
+			{
+				uint32 const Range = static_cast<uint32>(static_cast<U>(static_cast<U>(Max) - static_cast<U>(Min))) + 1u;
+				if(Range == 0)
+					return static_cast<T>(rand_bits32(Generator));
+
+				uint32 const Threshold = static_cast<uint32>(0u - Range) % Range;
+				uint64 Product;
+				do
+					Product = static_cast<uint64>(rand_bits32(Generator)) * Range;
+				while(static_cast<uint32>(Product) < Threshold);
+				return static_cast<T>(static_cast<U>(static_cast<U>(Min) + static_cast<U>(Product >> 32)));
+			}
+			else
+			{
+				uint64 const Range = static_cast<uint64>(static_cast<U>(Max) - static_cast<U>(Min)) + 1u;
+				if(Range == 0)
+					return static_cast<T>(rand_bits64(Generator));
+
+				uint64 const Threshold = (0u - Range) % Range;
+				uint64 Bits;
+				do
+					Bits = rand_bits64(Generator);
+				while(Bits < Threshold);
+				return static_cast<T>(static_cast<U>(static_cast<U>(Min) + static_cast<U>(Bits % Range)));
+			}
+		}
+	};
+
+	// Unit uniforms in [0, 1), drawn as linearRand(T(0), T(1), Generator) would
+	template<typename T, typename genRNG>
+	struct compute_rand_unit
+	{
+		GLM_FUNC_QUALIFIER static void call(genRNG& Generator, T* Out, std::size_t Count)
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = compute_linearRand_generator<T>::unit(Generator, T(0));
+		}
+	};
+
+	template<>
+	struct compute_rand_unit<float, xoshiro128x8>
+	{
+		GLM_FUNC_QUALIFIER static void call(xoshiro128x8& Generator, float* Out, std::size_t Count)
+		{
+			Generator.generate(Out, Count);
+		}
+	};
+
+	// Philox4x32-10 of one counter
+	GLM_FUNC_QUALIFIER void philox4x32_block(uint32 const (&Key)[2], uint32 c0, uint32 c1, uint32 c2, uint32 c3, uint32* Out)
+	{
+		uint32 k0 = Key[0], k1 = Key[1];
+		for(int Round = 0; Round < 10; ++Round)
+		{
+			uint64 const p0 = static_cast<uint64>(0xD2511F53u) * c0;
+			uint64 const p1 = static_cast<uint64>(0xCD9E8D57u) * c2;
+			uint32 const n0 = static_cast<uint32>(p1 >> 32) ^ c1 ^ k0;
+			uint32 const n2 = static_cast<uint32>(p0 >> 32) ^ c3 ^ k1;
+			c1 = static_cast<uint32>(p1);
+			c3 = static_cast<uint32>(p0);
+			c0 = n0;
+			c2 = n2;
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		Out[0] = c0;
+		Out[1] = c1;
+		Out[2] = c2;
+		Out[3] = c3;
+	}
+
+	// The number of blocks the counter-based batch functions encrypt at once
+	static constexpr std::size_t philox_chunk = 64;
+
+	// Encrypts the blocks [First, First + philox_chunk), Words[w][b] being
+	// value w of block First + b
+	template<bool UseSimd>
+	struct compute_philox4x32
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const (&Key)[2], uint32 const (&Stream)[2], uint64 First, uint32 (&Words)[4][philox_chunk])
+		{
+			for(std::size_t b = 0; b < philox_chunk; ++b)
+			{
+				uint64 const Block = First + b;
+				uint32 Out[4];
+				philox4x32_block(Key, static_cast<uint32>(Block), static_cast<uint32>(Block >> 32), Stream[0], Stream[1], Out);
+				for(length_t w = 0; w < 4; ++w)
+					Words[w][b] = Out[w];
+			}
+		}
+	};
+
+	GLM_FUNC_QUALIFIER float philox_unit(uint32 x)
+	{
+		return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+	}
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER xoshiro128x8::xoshiro128x8(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128x8::seed(uint64 Seed, uint64 Stream)
+	{
+		uint64 Mix = Stream;
+		uint64 x = Seed ^ detail::splitmix64(Mix);
+		for(length_t l = 0; l < 8; ++l)
+		{
+			for(length_t w = 0; w < 4; w += 2)
+			{
+				uint64 const Bits = detail::splitmix64(x);
+				this->state[w][l] = static_cast<uint32>(Bits);
+				this->state[w + 1][l] = static_cast<uint32>(Bits >> 32);
+			}
+
+			// The all-zero state is the one fixed point of the stream
+			if((this->state[0][l] | this->state[1][l] | this->state[2][l] | this->state[3][l]) == 0)
+				this->state[0][l] = 1;
+		}
+		for(length_t l = 0; l < 8; ++l)
+			this->buffer[l] = 0;
+		this->index = 8;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128x8::result_type xoshiro128x8::operator()()
+	{
+		if(this->index == 8)
+		{
+			detail::compute_xoshiro128x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(this->state, this->buffer, 1);
+			this->index = 0;
+		}
+		return this->buffer[this->index++];
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128x8::generate(uint32* out, std::size_t count)
+	{
+		for(; count > 0 && this->index < 8; --count)
+			*out++ = this->buffer[this->index++];
+
+		std::size_t const Steps = count / 8;
+		detail::compute_xoshiro128x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(this->state, out, Steps);
+		out += Steps * 8;
+		count -= Steps * 8;
+
+		for(; count > 0; --count)
+			*out++ = (*this)();
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128x8::generate(float* out, std::size_t count)
+	{
+		for(; count > 0 && this->index < 8; --count)
+			*out++ = static_cast<float>(this->buffer[this->index++] >> 8) * (1.0f / 16777216.0f);
+
+		std::size_t const Steps = count / 8;
+		detail::compute_xoshiro128x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(this->state, out, Steps);
+		out += Steps * 8;
+		count -= Steps * 8;
+
+		for(; count > 0; --count)
+			*out++ = static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	GLM_FUNC_QUALIFIER philox4x32::philox4x32(uint64 Seed, uint64 Stream)
+	{
+		this->key[0] = static_cast<uint32>(Seed);
+		this->key[1] = static_cast<uint32>(Seed >> 32);
+		this->stream[0] = static_cast<uint32>(Stream);
+		this->stream[1] = static_cast<uint32>(Stream >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER vec<4, uint32, defaultp> philox4x32::operator()(uint64 Block) const
+	{
+		uint32 Out[4];
+		detail::philox4x32_block(this->key, static_cast<uint32>(Block), static_cast<uint32>(Block >> 32), this->stream[0], this->stream[1], Out);
+		return vec<4, uint32, defaultp>(Out[0], Out[1], Out[2], Out[3]);
+	}
+
+	template<typename genType, typename genRNG>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, genRNG& Generator)
+	{
+		return detail::compute_linearRand_generator<genType>::call(Min, Max, Generator);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, genRNG& Generator)
+	{
+		vec<L, T, Q> Result(static_cast<T>(0));
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = linearRand(Min[i], Max[i], Generator);
+		return Result;
+	}
+
+	template<typename genType, typename genRNG>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, genRNG& Generator)
+	{
+		genType w, x1, x2;
+
+		do
+		{
+			x1 = linearRand(genType(-1), genType(1), Generator);
+			x2 = linearRand(genType(-1), genType(1), Generator);
+
+			w = x1 * x1 + x2 * x2;
+		} while(w > genType(1) || w <= genType(0));
+
+		return static_cast<genType>(x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, genRNG& Generator)
+	{
+		vec<L, T, Q> Result(static_cast<T>(0));
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = gaussRand(Mean[i], Deviation[i], Generator);
+		return Result;
+	}
+
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius, genRNG& Generator)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<2, T, defaultp> Result;
+		do
+		{
+			Result = linearRand(vec<2, T, defaultp>(-Radius), vec<2, T, defaultp>(Radius), Generator);
+		}
+		while(dot(Result, Result) > Radius * Radius);
+
+		return Result;
+	}
+
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius, genRNG& Generator)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<3, T, defaultp> Result;
+		do
+		{
+			Result = linearRand(vec<3, T, defaultp>(-Radius), vec<3, T, defaultp>(Radius), Generator);
+		}
+		while(dot(Result, Result) > Radius * Radius);
+
+		return Result;
+	}
+
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius, genRNG& Generator)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		T const a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Generator);
+		return vec<2, T, defaultp>(glm::cos(a), glm::sin(a)) * Radius;
+	}
+
+	// Archimedes: z is uniform over [-1, 1] on the unit sphere
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius, genRNG& Generator)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		T const z = linearRand(T(-1), T(1), Generator);
+		T const a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Generator);
+		T const r = std::sqrt(glm::max(T(1) - z * z, T(0)));
+
+		return vec<3, T, defaultp>(r * glm::cos(a), r * glm::sin(a), z) * Radius;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, philox4x32 const& Generator, uint64 Index)
+	{
+		static_assert(std::numeric_limits<genType>::is_iec559, "'linearRand' only accepts floating-point inputs with a counter-based generator");
+
+		vec<4, uint32, defaultp> const Block = Generator(Index >> 2);
+		return Min + (Max - Min) * static_cast<genType>(detail::philox_unit(Block[static_cast<length_t>(Index & 3)]));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, philox4x32 const& Generator, uint64 Index)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559, "'linearRand' only accepts floating-point inputs with a counter-based generator");
+
+		vec<4, uint32, defaultp> const Block = Generator(Index);
+		vec<L, T, Q> Result(static_cast<T>(0));
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = Min[i] + (Max[i] - Min[i]) * static_cast<T>(detail::philox_unit(Block[i]));
+		return Result;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, philox4x32 const& Generator, uint64 Index)
+	{
+		static_assert(std::numeric_limits<genType>::is_iec559, "'gaussRand' only accepts floating-point inputs");
+
+		vec<4, uint32, defaultp> const Block = Generator(Index >> 1);
+		length_t const Pair = static_cast<length_t>(Index & 1) * 2;
+		genType const Radius = static_cast<genType>(1) - static_cast<genType>(detail::philox_unit(Block[Pair]));
+		genType const Angle = static_cast<genType>(detail::philox_unit(Block[Pair + 1])) * static_cast<genType>(6.283185307179586476925286766559);
+		return Mean + Deviation * std::sqrt(static_cast<genType>(-2) * std::log(Radius)) * std::cos(Angle);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius, philox4x32 const& Generator, uint64 Index)
+	{
+		vec<4, uint32, defaultp> const Block = Generator(Index);
+		T const a = static_cast<T>(detail::philox_unit(Block.x)) * static_cast<T>(6.283185307179586476925286766559);
+		return vec<2, T, defaultp>(std::cos(a), std::sin(a)) * Radius;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius, philox4x32 const& Generator, uint64 Index)
+	{
+		vec<4, uint32, defaultp> const Block = Generator(Index);
+		T const z = static_cast<T>(detail::philox_unit(Block.x)) * static_cast<T>(2) - static_cast<T>(1);
+		T const a = static_cast<T>(detail::philox_unit(Block.y)) * static_cast<T>(6.283185307179586476925286766559);
+		T const r = std::sqrt(glm::max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+		return vec<3, T, defaultp>(r * std::cos(a), r * std::sin(a), z) * Radius;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius, philox4x32 const& Generator, uint64 Index)
+	{
+		vec<4, uint32, defaultp> const Block = Generator(Index);
+		T const r = std::sqrt(static_cast<T>(detail::philox_unit(Block.x))) * Radius;
+		T const a = static_cast<T>(detail::philox_unit(Block.y)) * static_cast<T>(6.283185307179586476925286766559);
+		return vec<2, T, defaultp>(std::cos(a), std::sin(a)) * r;
+	}
+
+	// The direction of sphericalRand, at the cube root of a uniform radius
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius, philox4x32 const& Generator, uint64 Index)
+	{
+		vec<4, uint32, defaultp> const Block = Generator(Index);
+		T const z = static_cast<T>(detail::philox_unit(Block.x)) * static_cast<T>(2) - static_cast<T>(1);
+		T const a = static_cast<T>(detail::philox_unit(Block.y)) * static_cast<T>(6.283185307179586476925286766559);
+		T const r = std::sqrt(glm::max(static_cast<T>(1) - z * z, static_cast<T>(0)));
+		T const Length = std::cbrt(static_cast<T>(1) - static_cast<T>(detail::philox_unit(Block.z))) * Radius;
+		return vec<3, T, defaultp>(r * std::cos(a), r * std::sin(a), z) * Length;
+	}
+
+namespace detail
+{
+	// Runs Kernel(Words, Offset, Count) over the blocks [First, First + Blocks)
+	// in whole chunks: every block goes through the same operations wherever
+	// it lies in the range
+	template<typename kernel>
+	GLM_FUNC_QUALIFIER void philox_chunks(philox4x32 const& Generator, uint64 First, std::size_t Blocks, kernel Kernel)
+	{
+		uint32 Words[4][philox_chunk];
+		for(std::size_t i = 0; i < Blocks; i += philox_chunk)
+		{
+			compute_philox4x32<GLM_CONFIG_SIMD == GLM_ENABLE>::call(Generator.key, Generator.stream, First + i, Words);
+			Kernel(Words, i, glm::min(philox_chunk, Blocks - i));
+		}
+	}
+
+	// The points of sphericalRand, scaled by Length
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void philox_spheres(uint32 const (&Words)[4][philox_chunk], float const* Length, vec<3, float, Q>* out, std::size_t Count)
+	{
+		float z[philox_chunk], Angle[philox_chunk], Sin[philox_chunk], Cos[philox_chunk];
+		for(std::size_t b = 0; b < philox_chunk; ++b)
+		{
+			z[b] = philox_unit(Words[0][b]) * 2.0f - 1.0f;
+			Angle[b] = philox_unit(Words[1][b]) * 6.283185307179586476925286766559f;
+		}
+		glm::batch::sincos(Angle, Sin, Cos, philox_chunk);
+		for(std::size_t b = 0; b < philox_chunk; ++b)
+		{
+			float const r = std::sqrt(glm::max(1.0f - z[b] * z[b], 0.0f));
+			Cos[b] *= r;
+			Sin[b] *= r;
+		}
+
+		for(std::size_t b = 0; b < Count; ++b)
+			out[b] = vec<3, float, Q>(Cos[b], Sin[b], z[b]) * Length[b];
+	}
+}//namespace detail
+
+namespace batch
+{
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER void linearRand(T* out, std::size_t count, T Min, T Max, genRNG& Generator)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559, "'linearRand' only accepts floating-point arrays");
+
+		detail::compute_rand_unit<T, genRNG>::call(Generator, out, count);
+
+		T const Range = Max - Min;
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = Min + Range * out[i];
+	}
+
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_QUALIFIER void linearRand(vec<L, T, Q>* out, std::size_t count, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, genRNG& Generator)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559, "'linearRand' only accepts floating-point arrays");
+
+		// Padded vectors, such as aligned vec3, are not a contiguous array of T
+		if(sizeof(vec<L, T, Q>) != sizeof(T) * L)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::linearRand(Min, Max, Generator);
+			return;
+		}
+
+		detail::compute_rand_unit<T, genRNG>::call(Generator, reinterpret_cast<T*>(out), count * L);
+
+		vec<L, T, Q> const Range = Max - Min;
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = Min + Range * out[i];
+	}
+
+	template<typename genRNG>
+	GLM_FUNC_QUALIFIER void gaussRand(float* out, std::size_t count, float Mean, float Deviation, genRNG& Generator)
+	{
+		// Box-Muller over chunks of uniforms: each pair (u, v) gives the two
+		// values sqrt(-2 ln(1 - u)) * (cos, sin)(2 pi v)
+		std::size_t const Chunk = 128;
+		float Unit[Chunk * 2], Radius[Chunk], Angle[Chunk], Sin[Chunk], Cos[Chunk];
+
+		while(count > 0)
+		{
+			std::size_t const Pairs = glm::min(Chunk, (count + 1) / 2);
+			detail::compute_rand_unit<float, genRNG>::call(Generator, Unit, Pairs * 2);
+			for(std::size_t i = 0; i < Pairs; ++i)
+			{
+				Radius[i] = 1.0f - Unit[i * 2];
+				Angle[i] = Unit[i * 2 + 1] * 6.283185307179586476925286766559f;
+			}
+
+			glm::batch::log(Radius, Radius, Pairs);
+			glm::batch::sincos(Angle, Sin, Cos, Pairs);
+
+			for(std::size_t i = 0; i < Pairs; ++i)
+			{
+				float const Scale = Deviation * std::sqrt(-2.0f * Radius[i]);
+				out[i * 2] = Mean + Scale * Cos[i];
+				if(i * 2 + 1 < count)
+					out[i * 2 + 1] = Mean + Scale * Sin[i];
+			}
+
+			std::size_t const Written = glm::min(count, Pairs * 2);
+			out += Written;
+			count -= Written;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void linearRand(float* out, std::size_t count, float Min, float Max, philox4x32 const& Generator, uint64 first)
+	{
+		// Four values per block, the range starting at value Skip of the first one
+		std::size_t const Skip = static_cast<std::size_t>(first & 3);
+		float const Range = Max - Min;
+
+		detail::philox_chunks(Generator, first >> 2, (Skip + count + 3) / 4, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			float Values[detail::philox_chunk * 4];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+			for(std::size_t w = 0; w < 4; ++w)
+				Values[b * 4 + w] = Min + Range * detail::philox_unit(Words[w][b]);
+
+			std::size_t const Begin = Offset == 0 ? Skip : 0;
+			std::size_t const End = glm::min(Blocks * 4, Skip + count - Offset * 4);
+			for(std::size_t v = Begin; v < End; ++v)
+				out[Offset * 4 + v - Skip] = Values[v];
+		});
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRand(float* out, std::size_t count, float Mean, float Deviation, philox4x32 const& Generator, uint64 first)
+	{
+		// Two values per block, the range starting at value Skip of the first one
+		std::size_t const Skip = static_cast<std::size_t>(first & 1);
+
+		detail::philox_chunks(Generator, first >> 1, (Skip + count + 1) / 2, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			std::size_t const Size = detail::philox_chunk * 2;
+			float Radius[Size], Angle[Size], Sin[Size], Cos[Size];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+			for(std::size_t k = 0; k < 2; ++k)
+			{
+				Radius[b * 2 + k] = 1.0f - detail::philox_unit(Words[k * 2][b]);
+				Angle[b * 2 + k] = detail::philox_unit(Words[k * 2 + 1][b]) * 6.283185307179586476925286766559f;
+			}
+			glm::batch::log(Radius, Radius, Size);
+			glm::batch::sincos(Angle, Sin, Cos, Size);
+			for(std::size_t v = 0; v < Size; ++v)
+				Radius[v] = Mean + Deviation * std::sqrt(-2.0f * Radius[v]) * Cos[v];
+
+			std::size_t const Begin = Offset == 0 ? Skip : 0;
+			std::size_t const End = glm::min(Blocks * 2, Skip + count - Offset * 2);
+			for(std::size_t v = Begin; v < End; ++v)
+				out[Offset * 2 + v - Skip] = Radius[v];
+		});
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRand(vec<2, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		detail::philox_chunks(Generator, first, count, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			float Angle[detail::philox_chunk], Sin[detail::philox_chunk], Cos[detail::philox_chunk];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+				Angle[b] = detail::philox_unit(Words[0][b]) * 6.283185307179586476925286766559f;
+			glm::batch::sincos(Angle, Sin, Cos, detail::philox_chunk);
+
+			for(std::size_t b = 0; b < Blocks; ++b)
+				out[Offset + b] = vec<2, float, Q>(Cos[b] * Radius, Sin[b] * Radius);
+		});
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(vec<3, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		detail::philox_chunks(Generator, first, count, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			float Length[detail::philox_chunk];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+				Length[b] = Radius;
+			detail::philox_spheres(Words, Length, out + Offset, Blocks);
+		});
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(vec<2, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		detail::philox_chunks(Generator, first, count, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			float Length[detail::philox_chunk], Angle[detail::philox_chunk], Sin[detail::philox_chunk], Cos[detail::philox_chunk];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+			{
+				Length[b] = std::sqrt(detail::philox_unit(Words[0][b])) * Radius;
+				Angle[b] = detail::philox_unit(Words[1][b]) * 6.283185307179586476925286766559f;
+			}
+			glm::batch::sincos(Angle, Sin, Cos, detail::philox_chunk);
+
+			for(std::size_t b = 0; b < Blocks; ++b)
+				out[Offset + b] = vec<2, float, Q>(Cos[b] * Length[b], Sin[b] * Length[b]);
+		});
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRand(vec<3, float, Q>* out, std::size_t count, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		detail::philox_chunks(Generator, first, count, [=](uint32 const (&Words)[4][detail::philox_chunk], std::size_t Offset, std::size_t Blocks)
+		{
+			// cbrt(x) as exp(log(x) / 3)
+			float Length[detail::philox_chunk];
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+				Length[b] = 1.0f - detail::philox_unit(Words[2][b]);
+			glm::batch::log(Length, Length, detail::philox_chunk);
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+				Length[b] *= 1.0f / 3.0f;
+			glm::batch::exp(Length, Length, detail::philox_chunk);
+			for(std::size_t b = 0; b < detail::philox_chunk; ++b)
+				Length[b] *= Radius;
+
+			detail::philox_spheres(Words, Length, out + Offset, Blocks);
+		});
+	}
+
+#	if GLM_HAS_SPAN
+	template<typename T, typename genRNG>
+	GLM_FUNC_QUALIFIER void linearRand(std::span<T> out, std::type_identity_t<T> Min, std::type_identity_t<T> Max, genRNG& Generator)
+	{
+		glm::batch::linearRand(out.data(), out.size(), Min, Max, Generator);
+	}
+
+	template<length_t L, typename T, qualifier Q, typename genRNG>
+	GLM_FUNC_QUALIFIER void linearRand(std::span<vec<L, T, Q> > out, std::type_identity_t<vec<L, T, Q> > const& Min, std::type_identity_t<vec<L, T, Q> > const& Max, genRNG& Generator)
+	{
+		glm::batch::linearRand(out.data(), out.size(), Min, Max, Generator);
+	}
+
+	template<typename genRNG>
+	GLM_FUNC_QUALIFIER void gaussRand(std::span<float> out, float Mean, float Deviation, genRNG& Generator)
+	{
+		glm::batch::gaussRand(out.data(), out.size(), Mean, Deviation, Generator);
+	}
+
+	GLM_FUNC_QUALIFIER void linearRand(std::span<float> out, float Min, float Max, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::linearRand(out.data(), out.size(), Min, Max, Generator, first);
+	}
+
+	GLM_FUNC_QUALIFIER void gaussRand(std::span<float> out, float Mean, float Deviation, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::gaussRand(out.data(), out.size(), Mean, Deviation, Generator, first);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRand(std::span<vec<2, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::circularRand(out.data(), out.size(), Radius, Generator, first);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(std::span<vec<3, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::sphericalRand(out.data(), out.size(), Radius, Generator, first);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(std::span<vec<2, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::diskRand(out.data(), out.size(), Radius, Generator, first);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRand(std::span<vec<3, float, Q> > out, float Radius, philox4x32 const& Generator, uint64 first)
+	{
+		glm::batch::ballRand(out.data(), out.size(), Radius, Generator, first);
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
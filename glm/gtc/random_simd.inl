@@ -0,0 +1,276 @@
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	// The 8 streams in one __m256i
+	template<int k>
+	GLM_FUNC_QUALIFIER __m256i rotl_xoshiro_avx2(__m256i x)
+	{
+		return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+	}
+
+	template<>
+	struct compute_xoshiro128x8<true>
+	{
+		template<typename store>
+		GLM_FUNC_QUALIFIER static void steps(uint32 (&State)[4][8], std::size_t Steps, store Store)
+		{
+			__m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[0]));
+			__m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[1]));
+			__m256i s2 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[2]));
+			__m256i s3 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(State[3]));
+
+			for(std::size_t i = 0; i < Steps; ++i)
+			{
+				Store(i, _mm256_add_epi32(rotl_xoshiro_avx2<7>(_mm256_add_epi32(s0, s3)), s0));
+				__m256i const t = _mm256_slli_epi32(s1, 9);
+				s2 = _mm256_xor_si256(s2, s0);
+				s3 = _mm256_xor_si256(s3, s1);
+				s1 = _mm256_xor_si256(s1, s2);
+				s0 = _mm256_xor_si256(s0, s3);
+				s2 = _mm256_xor_si256(s2, t);
+				s3 = rotl_xoshiro_avx2<11>(s3);
+			}
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[0]), s0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[1]), s1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[2]), s2);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(State[3]), s3);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], uint32* Out, std::size_t Steps)
+		{
+			steps(State, Steps, [Out](std::size_t i, __m256i r)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + i * 8), r);
+			});
+		}
+
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], float* Out, std::size_t Steps)
+		{
+			__m256 const Scale = _mm256_set1_ps(1.0f / 16777216.0f);
+			steps(State, Steps, [Out, Scale](std::size_t i, __m256i r)
+			{
+				_mm256_storeu_ps(Out + i * 8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(r, 8)), Scale));
+			});
+		}
+	};
+
+	// High and low halves of the 32-bit products a * m of the 8 lanes
+	GLM_FUNC_QUALIFIER void philox_mulhilo_avx2(__m256i a, __m256i m, __m256i& hi, __m256i& lo)
+	{
+		__m256i const Even = _mm256_mul_epu32(a, m);
+		__m256i const Odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+		__m256i const LowMask = _mm256_set1_epi64x(0xFFFFFFFFll);
+		lo = _mm256_or_si256(_mm256_and_si256(Even, LowMask), _mm256_slli_epi64(Odd, 32));
+		hi = _mm256_or_si256(_mm256_srli_epi64(Even, 32), _mm256_andnot_si256(LowMask, Odd));
+	}
+
+	// One round of Philox on the counters (c0, c1, c2, c3)
+	GLM_FUNC_QUALIFIER void philox_round_avx2(__m256i& c0, __m256i& c1, __m256i& c2, __m256i& c3, __m256i k0, __m256i k1)
+	{
+		__m256i hi0, lo0, hi1, lo1;
+		philox_mulhilo_avx2(c0, _mm256_set1_epi32(static_cast<int>(0xD2511F53u)), hi0, lo0);
+		philox_mulhilo_avx2(c2, _mm256_set1_epi32(static_cast<int>(0xCD9E8D57u)), hi1, lo1);
+		c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+		c1 = lo1;
+		c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+		c3 = lo0;
+	}
+
+	// 16 blocks per iteration, in two independent groups to hide the
+	// latency of the multiplications
+	template<>
+	struct compute_philox4x32<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const (&Key)[2], uint32 const (&Stream)[2], uint64 First, uint32 (&Words)[4][philox_chunk])
+		{
+			std::size_t const Lanes = 8;
+			for(std::size_t b = 0; b < philox_chunk; b += Lanes * 2)
+			{
+				uint32 Low[Lanes * 2], High[Lanes * 2];
+				for(std::size_t l = 0; l < Lanes * 2; ++l)
+				{
+					Low[l] = static_cast<uint32>(First + b + l);
+					High[l] = static_cast<uint32>((First + b + l) >> 32);
+				}
+
+				__m256i a0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Low));
+				__m256i a1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(High));
+				__m256i a2 = _mm256_set1_epi32(static_cast<int>(Stream[0]));
+				__m256i a3 = _mm256_set1_epi32(static_cast<int>(Stream[1]));
+				__m256i b0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Low + Lanes));
+				__m256i b1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(High + Lanes));
+				__m256i b2 = a2;
+				__m256i b3 = a3;
+
+				uint32 k0 = Key[0], k1 = Key[1];
+				for(int Round = 0; Round < 10; ++Round)
+				{
+					__m256i const K0 = _mm256_set1_epi32(static_cast<int>(k0));
+					__m256i const K1 = _mm256_set1_epi32(static_cast<int>(k1));
+					philox_round_avx2(a0, a1, a2, a3, K0, K1);
+					philox_round_avx2(b0, b1, b2, b3, K0, K1);
+					k0 += 0x9E3779B9u;
+					k1 += 0xBB67AE85u;
+				}
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[0] + b), a0);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[1] + b), a1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[2] + b), a2);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[3] + b), a3);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[0] + b + Lanes), b0);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[1] + b + Lanes), b1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[2] + b + Lanes), b2);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Words[3] + b + Lanes), b3);
+			}
+		}
+	};
+#	else
+	// The 8 streams in two __m128i
+	template<int k>
+	GLM_FUNC_QUALIFIER __m128i rotl_xoshiro_sse2(__m128i x)
+	{
+		return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+	}
+
+	// One step of 4 streams
+	GLM_FUNC_QUALIFIER __m128i step_xoshiro_sse2(__m128i& s0, __m128i& s1, __m128i& s2, __m128i& s3)
+	{
+		__m128i const Result = _mm_add_epi32(rotl_xoshiro_sse2<7>(_mm_add_epi32(s0, s3)), s0);
+		__m128i const t = _mm_slli_epi32(s1, 9);
+		s2 = _mm_xor_si128(s2, s0);
+		s3 = _mm_xor_si128(s3, s1);
+		s1 = _mm_xor_si128(s1, s2);
+		s0 = _mm_xor_si128(s0, s3);
+		s2 = _mm_xor_si128(s2, t);
+		s3 = rotl_xoshiro_sse2<11>(s3);
+		return Result;
+	}
+
+	template<>
+	struct compute_xoshiro128x8<true>
+	{
+		template<typename store>
+		GLM_FUNC_QUALIFIER static void steps(uint32 (&State)[4][8], std::size_t Steps, store Store)
+		{
+			__m128i a0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[0]));
+			__m128i a1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[1]));
+			__m128i a2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[2]));
+			__m128i a3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[3]));
+			__m128i b0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[0] + 4));
+			__m128i b1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[1] + 4));
+			__m128i b2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[2] + 4));
+			__m128i b3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(State[3] + 4));
+
+			for(std::size_t i = 0; i < Steps; ++i)
+			{
+				Store(i * 2 + 0, step_xoshiro_sse2(a0, a1, a2, a3));
+				Store(i * 2 + 1, step_xoshiro_sse2(b0, b1, b2, b3));
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[0]), a0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[1]), a1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[2]), a2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[3]), a3);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[0] + 4), b0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[1] + 4), b1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[2] + 4), b2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(State[3] + 4), b3);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], uint32* Out, std::size_t Steps)
+		{
+			steps(State, Steps, [Out](std::size_t i, __m128i r)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + i * 4), r);
+			});
+		}
+
+		GLM_FUNC_QUALIFIER static void call(uint32 (&State)[4][8], float* Out, std::size_t Steps)
+		{
+			__m128 const Scale = _mm_set1_ps(1.0f / 16777216.0f);
+			steps(State, Steps, [Out, Scale](std::size_t i, __m128i r)
+			{
+				_mm_storeu_ps(Out + i * 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(r, 8)), Scale));
+			});
+		}
+	};
+
+	// High and low halves of the 32-bit products a * m of the 4 lanes
+	GLM_FUNC_QUALIFIER void philox_mulhilo_sse2(__m128i a, __m128i m, __m128i& hi, __m128i& lo)
+	{
+		__m128i const Even = _mm_mul_epu32(a, m);
+		__m128i const Odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+		__m128i const LowMask = _mm_set_epi32(0, -1, 0, -1);
+		lo = _mm_or_si128(_mm_and_si128(Even, LowMask), _mm_slli_epi64(Odd, 32));
+		hi = _mm_or_si128(_mm_srli_epi64(Even, 32), _mm_andnot_si128(LowMask, Odd));
+	}
+
+	// One round of Philox on the counters (c0, c1, c2, c3)
+	GLM_FUNC_QUALIFIER void philox_round_sse2(__m128i& c0, __m128i& c1, __m128i& c2, __m128i& c3, __m128i k0, __m128i k1)
+	{
+		__m128i hi0, lo0, hi1, lo1;
+		philox_mulhilo_sse2(c0, _mm_set1_epi32(static_cast<int>(0xD2511F53u)), hi0, lo0);
+		philox_mulhilo_sse2(c2, _mm_set1_epi32(static_cast<int>(0xCD9E8D57u)), hi1, lo1);
+		c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), k0);
+		c1 = lo1;
+		c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), k1);
+		c3 = lo0;
+	}
+
+	// 8 blocks per iteration, in two independent groups to hide the
+	// latency of the multiplications
+	template<>
+	struct compute_philox4x32<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const (&Key)[2], uint32 const (&Stream)[2], uint64 First, uint32 (&Words)[4][philox_chunk])
+		{
+			std::size_t const Lanes = 4;
+			for(std::size_t b = 0; b < philox_chunk; b += Lanes * 2)
+			{
+				uint32 Low[Lanes * 2], High[Lanes * 2];
+				for(std::size_t l = 0; l < Lanes * 2; ++l)
+				{
+					Low[l] = static_cast<uint32>(First + b + l);
+					High[l] = static_cast<uint32>((First + b + l) >> 32);
+				}
+
+				__m128i a0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Low));
+				__m128i a1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(High));
+				__m128i a2 = _mm_set1_epi32(static_cast<int>(Stream[0]));
+				__m128i a3 = _mm_set1_epi32(static_cast<int>(Stream[1]));
+				__m128i b0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Low + Lanes));
+				__m128i b1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(High + Lanes));
+				__m128i b2 = a2;
+				__m128i b3 = a3;
+
+				uint32 k0 = Key[0], k1 = Key[1];
+				for(int Round = 0; Round < 10; ++Round)
+				{
+					__m128i const K0 = _mm_set1_epi32(static_cast<int>(k0));
+					__m128i const K1 = _mm_set1_epi32(static_cast<int>(k1));
+					philox_round_sse2(a0, a1, a2, a3, K0, K1);
+					philox_round_sse2(b0, b1, b2, b3, K0, K1);
+					k0 += 0x9E3779B9u;
+					k1 += 0xBB67AE85u;
+				}
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[0] + b), a0);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[1] + b), a1);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[2] + b), a2);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[3] + b), a3);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[0] + b + Lanes), b0);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[1] + b + Lanes), b1);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[2] + b + Lanes), b2);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Words[3] + b + Lanes), b3);
+			}
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,81 @@
+/// @ref gtx_dual_quaternion_batch
+/// @file glm/gtx/dual_quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see gtc_quaternion_batch (dependence)
+///
+/// @defgroup gtx_dual_quaternion_batch GLM_GTX_dual_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/dual_quaternion_batch.hpp> to use the features of this extension.
+///
+/// Dual quaternion linear blend skinning of whole vertex streams.
+///
+/// Each vertex blends the dual quaternions of up to 8 bones, flipping the
+/// bones on the other hemisphere of its first bone, normalizes the blend and
+/// transforms its position and normal with it. With SIMD enabled, vertices
+/// are processed 8 at a time with AVX and 4 at a time with SSE2, the bones of
+/// each influence being gathered and transposed to one register per
+/// component. The remainder of a stream is padded into a single SIMD block.
+/// Other builds fall back to the tdualquat operators.
+
+#pragma once
+
+// Dependencies
+#include "../gtx/dual_quaternion.hpp"
+#include "../gtc/quaternion_batch.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../vec3.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_dual_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_dual_quaternion_batch extension included")
+#endif
+
+namespace glm{
+namespace batch
+{
+	/// @addtogroup gtx_dual_quaternion_batch
+	/// @{
+
+	/// Skins count vertices with dual quaternion linear blending.
+	///
+	/// Vertex i is influenced by the bones indices[i * influences + k] with the
+	/// weights weights[i * influences + k], for k < influences. Its blend
+	/// b = sum(+-weight * bone) takes each bone with the sign of
+	/// dot(bone.real, first_bone.real), so that bones on opposite hemispheres do
+	/// not cancel out, and is normalized by length(b.real). Then
+	/// out_positions[i] = b * positions[i] and out_normals[i] = b.real * normals[i].
+	///
+	/// @param bones The bone transforms, as unit dual quaternions.
+	/// @param indices The bone indices, influences per vertex.
+	/// @param weights The bone weights, influences per vertex; the blend of a vertex must not vanish.
+	/// @param influences The number of bones per vertex, from 1 to 8.
+	/// @param normals May be null, in which case out_normals is not written.
+	///
+	/// The outputs may alias the inputs of the same stream.
+	///
+	/// @see glm::lerp(tdualquat<T, Q> const& x, tdualquat<T, Q> const& y, T const& a)
+	GLM_FUNC_DISCARD_DECL void dualquat_skin(
+		dualquat const* bones, uint16 const* indices, float const* weights, length_t influences,
+		vec3 const* positions, vec3 const* normals, vec3* out_positions, vec3* out_normals, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overload; indices and weights hold influences elements per vertex
+	/// and normals is either empty or as long as positions.
+	GLM_FUNC_DISCARD_DECL void dualquat_skin(
+		std::span<dualquat const> bones, std::span<uint16 const> indices, std::span<float const> weights, length_t influences,
+		std::span<vec3 const> positions, std::span<vec3 const> normals, std::span<vec3> out_positions, std::span<vec3> out_normals);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "dual_quaternion_batch.inl"
@@ -0,0 +1,69 @@
+/// @ref gtx_dual_quaternion_batch
+
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	template<bool UseSimd>
+	struct compute_dualquat_skin
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			dualquat const* bones, uint16 const* indices, float const* weights, length_t influences,
+			vec3 const* positions, vec3 const* normals, vec3* out_positions, vec3* out_normals, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				uint16 const* Index = indices + i * static_cast<std::size_t>(influences);
+				float const* Weight = weights + i * static_cast<std::size_t>(influences);
+
+				quat const Pivot = bones[Index[0]].real;
+				dualquat Blend(quat::wxyz(0.f, 0.f, 0.f, 0.f), quat::wxyz(0.f, 0.f, 0.f, 0.f));
+				for(length_t k = 0; k < influences; ++k)
+				{
+					dualquat const& Bone = bones[Index[k]];
+					Blend = Blend + Bone * (dot(Bone.real, Pivot) < 0.f ? -Weight[k] : Weight[k]);
+				}
+				Blend = normalize(Blend);
+
+				out_positions[i] = Blend * vec3(positions[i]);
+				if(normals)
+					out_normals[i] = Blend.real * vec3(normals[i]);
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "dual_quaternion_batch_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void dualquat_skin(
+		dualquat const* bones, uint16 const* indices, float const* weights, length_t influences,
+		vec3 const* positions, vec3 const* normals, vec3* out_positions, vec3* out_normals, std::size_t count)
+	{
+		assert(influences >= 1 && influences <= 8);
+		detail::compute_dualquat_skin<GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			bones, indices, weights, influences, positions, normals, out_positions, out_normals, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void dualquat_skin(
+		std::span<dualquat const> bones, std::span<uint16 const> indices, std::span<float const> weights, length_t influences,
+		std::span<vec3 const> positions, std::span<vec3 const> normals, std::span<vec3> out_positions, std::span<vec3> out_normals)
+	{
+		std::size_t const Count = positions.size();
+		assert(indices.size() == Count * static_cast<std::size_t>(influences) && weights.size() == indices.size());
+		assert(out_positions.size() == Count);
+		assert(normals.empty() || (normals.size() == Count && out_normals.size() == Count));
+		dualquat_skin(
+			bones.data(), indices.data(), weights.data(), influences,
+			positions.data(), normals.empty() ? nullptr : normals.data(), out_positions.data(), out_normals.data(), Count);
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
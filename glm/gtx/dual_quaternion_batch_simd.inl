@@ -0,0 +1,201 @@
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_cross(typename simd::fvec const* a, typename simd::fvec const* b, typename simd::fvec* Result)
+	{
+		Result[0] = simd::sub(simd::mul(a[1], b[2]), simd::mul(b[1], a[2]));
+		Result[1] = simd::sub(simd::mul(a[2], b[0]), simd::mul(b[2], a[0]));
+		Result[2] = simd::sub(simd::mul(a[0], b[1]), simd::mul(b[0], a[1]));
+	}
+
+	// r must hold 4 registers, the last one being left undefined
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_load_vec3(vec3 const* v, typename simd::fvec* r)
+	{
+		if constexpr(sizeof(vec3) == 3 * sizeof(float))
+			simd::load3(reinterpret_cast<float const*>(v), 3, r);
+		else
+			simd::load(reinterpret_cast<float const*>(v), sizeof(vec3) / sizeof(float), r);
+	}
+
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_store_vec3(vec3* v, typename simd::fvec const* c)
+	{
+		if constexpr(sizeof(vec3) == 3 * sizeof(float))
+			simd::store3(reinterpret_cast<float*>(v), 3, c);
+		else
+		{
+			typename simd::fvec const Padded[4] = {c[0], c[1], c[2], simd::set(0.0f)};
+			simd::store(reinterpret_cast<float*>(v), sizeof(vec3) / sizeof(float), Padded);
+		}
+	}
+
+	// Loads the real and dual parts of bones[index[j * influences]] for each
+	// lane j, in x, y, z, w order
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_gather_dualquat(dualquat const* bones, uint16 const* index, length_t influences, typename simd::fvec* Real, typename simd::fvec* Dual)
+	{
+		typedef typename simd::fvec fvec;
+
+		float const* RealAddress[simd::size];
+		float const* DualAddress[simd::size];
+		for(std::size_t j = 0; j < simd::size; ++j)
+		{
+			dualquat const& Bone = bones[index[j * static_cast<std::size_t>(influences)]];
+			RealAddress[j] = &Bone.real[0];
+			DualAddress[j] = &Bone.dual[0];
+		}
+
+		fvec v[4];
+		simd::gather(RealAddress, v);
+		Real[0] = v[batch_quat_lane::x];
+		Real[1] = v[batch_quat_lane::y];
+		Real[2] = v[batch_quat_lane::z];
+		Real[3] = v[batch_quat_lane::w];
+		simd::gather(DualAddress, v);
+		Dual[0] = v[batch_quat_lane::x];
+		Dual[1] = v[batch_quat_lane::y];
+		Dual[2] = v[batch_quat_lane::z];
+		Dual[3] = v[batch_quat_lane::w];
+	}
+
+	// The blend, normalization and transforms of compute_dualquat_skin, one
+	// vertex per lane
+	template<typename simd>
+	GLM_FUNC_QUALIFIER void batch_dualquat_skin_block(
+		dualquat const* bones, uint16 const* indices, float const* weights, length_t influences,
+		vec3 const* positions, vec3 const* normals, vec3* out_positions, vec3* out_normals)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec Real[4], Dual[4], BoneReal[4], BoneDual[4];
+		batch_gather_dualquat<simd>(bones, indices, influences, Real, Dual);
+		fvec const Pivot[4] = {Real[0], Real[1], Real[2], Real[3]};
+		fvec const Weight = simd::load1(weights, static_cast<std::size_t>(influences));
+		Real[0] = simd::mul(Real[0], Weight);
+		Real[1] = simd::mul(Real[1], Weight);
+		Real[2] = simd::mul(Real[2], Weight);
+		Real[3] = simd::mul(Real[3], Weight);
+		Dual[0] = simd::mul(Dual[0], Weight);
+		Dual[1] = simd::mul(Dual[1], Weight);
+		Dual[2] = simd::mul(Dual[2], Weight);
+		Dual[3] = simd::mul(Dual[3], Weight);
+
+		// Bones on the other hemisphere of the first one are blended negated
+		fvec const Zero = simd::set(0.0f);
+		fvec const SignBit = simd::set(-0.0f);
+		for(length_t k = 1; k < influences; ++k)
+		{
+			batch_gather_dualquat<simd>(bones, indices + k, influences, BoneReal, BoneDual);
+			fvec const Dot = simd::add(
+				simd::add(simd::mul(BoneReal[0], Pivot[0]), simd::mul(BoneReal[1], Pivot[1])),
+				simd::add(simd::mul(BoneReal[2], Pivot[2]), simd::mul(BoneReal[3], Pivot[3])));
+			fvec const Signed = simd::xorf(simd::load1(weights + k, static_cast<std::size_t>(influences)), simd::andf(simd::cmpgt(Zero, Dot), SignBit));
+			Real[0] = simd::add(Real[0], simd::mul(BoneReal[0], Signed));
+			Real[1] = simd::add(Real[1], simd::mul(BoneReal[1], Signed));
+			Real[2] = simd::add(Real[2], simd::mul(BoneReal[2], Signed));
+			Real[3] = simd::add(Real[3], simd::mul(BoneReal[3], Signed));
+			Dual[0] = simd::add(Dual[0], simd::mul(BoneDual[0], Signed));
+			Dual[1] = simd::add(Dual[1], simd::mul(BoneDual[1], Signed));
+			Dual[2] = simd::add(Dual[2], simd::mul(BoneDual[2], Signed));
+			Dual[3] = simd::add(Dual[3], simd::mul(BoneDual[3], Signed));
+		}
+
+		fvec const Length = simd::sqrt(simd::add(
+			simd::add(simd::mul(Real[0], Real[0]), simd::mul(Real[1], Real[1])),
+			simd::add(simd::mul(Real[2], Real[2]), simd::mul(Real[3], Real[3]))));
+		Real[0] = simd::div(Real[0], Length);
+		Real[1] = simd::div(Real[1], Length);
+		Real[2] = simd::div(Real[2], Length);
+		Real[3] = simd::div(Real[3], Length);
+		Dual[0] = simd::div(Dual[0], Length);
+		Dual[1] = simd::div(Dual[1], Length);
+		Dual[2] = simd::div(Dual[2], Length);
+		Dual[3] = simd::div(Dual[3], Length);
+
+		// tdualquat * vec3:
+		// (cross(r, cross(r, p) + p * r.w + d) + d * r.w - r * d.w) * 2 + p
+		fvec const Two = simd::set(2.0f);
+		fvec p[4], Inner[3], Outer[3], Result[3];
+		batch_load_vec3<simd>(positions, p);
+		batch_cross<simd>(Real, p, Inner);
+		Inner[0] = simd::add(simd::add(Inner[0], simd::mul(p[0], Real[3])), Dual[0]);
+		Inner[1] = simd::add(simd::add(Inner[1], simd::mul(p[1], Real[3])), Dual[1]);
+		Inner[2] = simd::add(simd::add(Inner[2], simd::mul(p[2], Real[3])), Dual[2]);
+		batch_cross<simd>(Real, Inner, Outer);
+		Result[0] = simd::add(simd::mul(simd::sub(simd::add(Outer[0], simd::mul(Dual[0], Real[3])), simd::mul(Real[0], Dual[3])), Two), p[0]);
+		Result[1] = simd::add(simd::mul(simd::sub(simd::add(Outer[1], simd::mul(Dual[1], Real[3])), simd::mul(Real[1], Dual[3])), Two), p[1]);
+		Result[2] = simd::add(simd::mul(simd::sub(simd::add(Outer[2], simd::mul(Dual[2], Real[3])), simd::mul(Real[2], Dual[3])), Two), p[2]);
+		batch_store_vec3<simd>(out_positions, Result);
+
+		if(!normals)
+			return;
+
+		// qua * vec3: n + (cross(r, n) * r.w + cross(r, cross(r, n))) * 2
+		fvec n[4];
+		batch_load_vec3<simd>(normals, n);
+		batch_cross<simd>(Real, n, Inner);
+		batch_cross<simd>(Real, Inner, Outer);
+		Result[0] = simd::add(n[0], simd::mul(simd::add(simd::mul(Inner[0], Real[3]), Outer[0]), Two));
+		Result[1] = simd::add(n[1], simd::mul(simd::add(simd::mul(Inner[1], Real[3]), Outer[1]), Two));
+		Result[2] = simd::add(n[2], simd::mul(simd::add(simd::mul(Inner[2], Real[3]), Outer[2]), Two));
+		batch_store_vec3<simd>(out_normals, Result);
+	}
+
+	template<>
+	struct compute_dualquat_skin<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			dualquat const* bones, uint16 const* indices, float const* weights, length_t influences,
+			vec3 const* positions, vec3 const* normals, vec3* out_positions, vec3* out_normals, std::size_t count)
+		{
+			std::size_t const Influences = static_cast<std::size_t>(influences);
+
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= count; i += 8)
+				batch_dualquat_skin_block<batch_quat_cast_avx>(
+					bones, indices + i * Influences, weights + i * Influences, influences,
+					positions + i, normals ? normals + i : normals, out_positions + i, normals ? out_normals + i : out_normals);
+#			endif
+			for(; i + 4 <= count; i += 4)
+				batch_dualquat_skin_block<batch_quat_cast_sse>(
+					bones, indices + i * Influences, weights + i * Influences, influences,
+					positions + i, normals ? normals + i : normals, out_positions + i, normals ? out_normals + i : out_normals);
+
+			// Pad the remainder with vertices fully weighted to the first bone
+			if(i < count)
+			{
+				std::size_t const n = count - i;
+				uint16 Index[4 * 8];
+				float Weight[4 * 8];
+				vec3 Position[4], Normal[4];
+				for(std::size_t j = 0; j < 4; ++j)
+				{
+					for(std::size_t k = 0; k < Influences; ++k)
+					{
+						bool const Valid = j < n;
+						Index[j * Influences + k] = Valid ? indices[(i + j) * Influences + k] : uint16(0);
+						Weight[j * Influences + k] = Valid ? weights[(i + j) * Influences + k] : (k == 0 ? 1.f : 0.f);
+					}
+					Position[j] = j < n ? positions[i + j] : vec3(0.f);
+					Normal[j] = j < n && normals ? normals[i + j] : vec3(0.f);
+				}
+				batch_dualquat_skin_block<batch_quat_cast_sse>(
+					bones, Index, Weight, influences, Position, normals ? Normal : nullptr, Position, Normal);
+				for(std::size_t j = 0; j < n; ++j)
+				{
+					out_positions[i + j] = Position[j];
+					if(normals)
+						out_normals[i + j] = Normal[j];
+				}
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
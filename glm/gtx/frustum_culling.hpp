@@ -0,0 +1,155 @@
+/// @ref gtx_frustum_culling
+/// @file glm/gtx/frustum_culling.hpp
+///
+/// @see core (dependence)
+/// @see ext_matrix_clip_space
+///
+/// @defgroup gtx_frustum_culling GLM_GTX_frustum_culling
+/// @ingroup gtx
+///
+/// Include <glm/gtx/frustum_culling.hpp> to use the features of this extension.
+///
+/// View frustum planes and bounding volume visibility tests.
+///
+/// frustumPlanes extracts the six planes of the frustum of a view-projection
+/// matrix, in the order left, right, bottom, top, near, far. Each plane p is
+/// normalized and faces the inside of the frustum: dot(vec3(p), x) + p.w is
+/// the signed distance of the point x, positive inside.
+///
+/// A volume is reported visible unless it lies entirely on the outer side of
+/// one of the planes. The test is conservative: a volume near a corner of the
+/// frustum may be reported visible although it is outside.
+///
+/// The batch functions test structure-of-arrays streams of spheres or boxes
+/// and write one visibility bit per volume. With SIMD enabled, volumes are
+/// tested 8 at a time with AVX and 4 at a time with SSE2.
+
+#pragma once
+
+// Dependencies
+#include "../ext/scalar_uint_sized.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
+#if GLM_HAS_SPAN
+#	include <span>
+#endif
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_frustum_culling is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_frustum_culling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum_culling
+	/// @{
+
+	/// Extracts the six frustum planes of a view-projection matrix whose clip
+	/// space depth ranges from 0 to 1 (Direct3D, Vulkan).
+	///
+	/// @param m The view-projection matrix, or the model-view-projection matrix to get the planes in model space.
+	/// @param planes Receives the left, right, bottom, top, near and far planes.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes);
+
+	/// Extracts the six frustum planes of a view-projection matrix whose clip
+	/// space depth ranges from -1 to 1 (OpenGL).
+	///
+	/// @param m The view-projection matrix, or the model-view-projection matrix to get the planes in model space.
+	/// @param planes Receives the left, right, bottom, top, near and far planes.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes);
+
+	/// Extracts the six frustum planes of a view-projection matrix, with the
+	/// clip space depth range of GLM_FORCE_DEPTH_ZERO_TO_ONE.
+	///
+	/// @param m The view-projection matrix, or the model-view-projection matrix to get the planes in model space.
+	/// @param planes Receives the left, right, bottom, top, near and far planes.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes);
+
+	/// Returns false if the sphere lies entirely outside one of the six planes.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumSphere(vec<4, T, Q> const* planes, vec<3, T, Q> const& center, T radius);
+
+	/// Returns false if the axis-aligned box [minimum, maximum] lies entirely
+	/// outside one of the six planes.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumAABB(vec<4, T, Q> const* planes, vec<3, T, Q> const& minimum, vec<3, T, Q> const& maximum);
+
+	/// @}
+
+namespace batch
+{
+	/// @addtogroup gtx_frustum_culling
+	/// @{
+
+	/// Tests count spheres against six frustum planes.
+	///
+	/// Bit i % 32 of visible[i / 32] is set when intersectFrustumSphere would
+	/// return true for sphere i. visible holds (count + 31) / 32 words, the
+	/// bits past count in the last word being cleared.
+	///
+	/// @param planes The six planes, as returned by frustumPlanes.
+	/// @param x, y, z The sphere centers.
+	/// @param radius The sphere radii.
+	GLM_FUNC_DISCARD_DECL void cullSpheres(
+		vec4 const* planes, float const* x, float const* y, float const* z, float const* radius,
+		uint32* visible, std::size_t count);
+
+	/// Tests count axis-aligned boxes, given by their corners, against six
+	/// frustum planes.
+	///
+	/// Bit i % 32 of visible[i / 32] is set when intersectFrustumAABB would
+	/// return true for box i. visible holds (count + 31) / 32 words, the bits
+	/// past count in the last word being cleared.
+	GLM_FUNC_DISCARD_DECL void cullMinMaxAABBs(
+		vec4 const* planes,
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		uint32* visible, std::size_t count);
+
+	/// Tests count axis-aligned boxes, given by their centers and half
+	/// extents, against six frustum planes.
+	///
+	/// Bit i % 32 of visible[i / 32] is set unless box i lies entirely outside
+	/// one of the planes. visible holds (count + 31) / 32 words, the bits past
+	/// count in the last word being cleared.
+	GLM_FUNC_DISCARD_DECL void cullCenterExtentAABBs(
+		vec4 const* planes,
+		float const* centerX, float const* centerY, float const* centerZ,
+		float const* extentX, float const* extentY, float const* extentZ,
+		uint32* visible, std::size_t count);
+
+#	if GLM_HAS_SPAN
+	/// Span overload; all streams have the same length and visible holds at
+	/// least (x.size() + 31) / 32 words.
+	GLM_FUNC_DISCARD_DECL void cullSpheres(
+		std::span<vec4 const, 6> planes, std::span<float const> x, std::span<float const> y, std::span<float const> z, std::span<float const> radius,
+		std::span<uint32> visible);
+
+	/// Span overload; all streams have the same length and visible holds at
+	/// least (minX.size() + 31) / 32 words.
+	GLM_FUNC_DISCARD_DECL void cullMinMaxAABBs(
+		std::span<vec4 const, 6> planes,
+		std::span<float const> minX, std::span<float const> minY, std::span<float const> minZ,
+		std::span<float const> maxX, std::span<float const> maxY, std::span<float const> maxZ,
+		std::span<uint32> visible);
+
+	/// Span overload; all streams have the same length and visible holds at
+	/// least (centerX.size() + 31) / 32 words.
+	GLM_FUNC_DISCARD_DECL void cullCenterExtentAABBs(
+		std::span<vec4 const, 6> planes,
+		std::span<float const> centerX, std::span<float const> centerY, std::span<float const> centerZ,
+		std::span<float const> extentX, std::span<float const> extentY, std::span<float const> extentZ,
+		std::span<uint32> visible);
+#	endif//GLM_HAS_SPAN
+
+	/// @}
+}//namespace batch
+}//namespace glm
+
+#include "frustum_culling.inl"
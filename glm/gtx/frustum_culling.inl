@@ -0,0 +1,219 @@
+/// @ref gtx_frustum_culling
+
+#include "../geometric.hpp"
+#include "../common.hpp"
+#include <cassert>
+
+namespace glm
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes)
+	{
+		// Rows of the column-major matrix: a clip space point c is inside when
+		// -c.w <= c.x <= c.w, -c.w <= c.y <= c.w and 0 <= c.z <= c.w
+		vec<4, T, Q> const Row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		vec<4, T, Q> const Row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		vec<4, T, Q> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		vec<4, T, Q> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		planes[0] = Row3 + Row0;
+		planes[1] = Row3 - Row0;
+		planes[2] = Row3 + Row1;
+		planes[3] = Row3 - Row1;
+		planes[4] = Row2;
+		planes[5] = Row3 - Row2;
+		for(length_t i = 0; i < 6; ++i)
+			planes[i] /= length(vec<3, T, Q>(planes[i]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes)
+	{
+		frustumPlanesZO(m, planes);
+
+		// -c.w <= c.z instead of 0 <= c.z
+		vec<4, T, Q> const Near(
+			m[0][3] + m[0][2], m[1][3] + m[1][2], m[2][3] + m[2][2], m[3][3] + m[3][2]);
+		planes[4] = Near / length(vec<3, T, Q>(Near));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q>* planes)
+	{
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			frustumPlanesZO(m, planes);
+#		else
+			frustumPlanesNO(m, planes);
+#		endif
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumSphere(vec<4, T, Q> const* planes, vec<3, T, Q> const& center, T radius)
+	{
+		for(length_t i = 0; i < 6; ++i)
+			if(dot(vec<3, T, Q>(planes[i]), center) + planes[i].w < -radius)
+				return false;
+		return true;
+	}
+
+namespace detail
+{
+	// The box is outside a plane when its corner furthest along the normal is,
+	// at a distance of dot(abs(normal), extent) from its center
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersect_frustum_box(vec<4, T, Q> const* planes, vec<3, T, Q> const& center, vec<3, T, Q> const& extent)
+	{
+		for(length_t i = 0; i < 6; ++i)
+		{
+			vec<3, T, Q> const Normal(planes[i]);
+			if(dot(Normal, center) + planes[i].w + dot(abs(Normal), extent) < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumAABB(vec<4, T, Q> const* planes, vec<3, T, Q> const& minimum, vec<3, T, Q> const& maximum)
+	{
+		T const Half = static_cast<T>(0.5);
+		return detail::intersect_frustum_box(planes, (minimum + maximum) * Half, (maximum - minimum) * Half);
+	}
+
+namespace detail
+{
+	// Calls Visible(i) for each volume and packs the results 32 per word
+	template<typename visible_func>
+	GLM_FUNC_QUALIFIER void cull_bits(uint32* visible, std::size_t count, visible_func Visible)
+	{
+		for(std::size_t Base = 0; Base < count; Base += 32)
+		{
+			std::size_t const End = count - Base < 32 ? count - Base : 32;
+			uint32 Word = 0;
+			for(std::size_t i = 0; i < End; ++i)
+				Word |= static_cast<uint32>(Visible(Base + i)) << i;
+			visible[Base / 32] = Word;
+		}
+	}
+
+	template<bool UseSimd>
+	struct compute_cull_spheres
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes, float const* x, float const* y, float const* z, float const* radius,
+			uint32* visible, std::size_t count)
+		{
+			cull_bits(visible, count, [&](std::size_t i)
+			{
+				return intersectFrustumSphere(planes, vec3(x[i], y[i], z[i]), radius[i]);
+			});
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_cull_min_max_aabbs
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes,
+			float const* minX, float const* minY, float const* minZ,
+			float const* maxX, float const* maxY, float const* maxZ,
+			uint32* visible, std::size_t count)
+		{
+			cull_bits(visible, count, [&](std::size_t i)
+			{
+				return intersectFrustumAABB(planes, vec3(minX[i], minY[i], minZ[i]), vec3(maxX[i], maxY[i], maxZ[i]));
+			});
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_cull_center_extent_aabbs
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes,
+			float const* centerX, float const* centerY, float const* centerZ,
+			float const* extentX, float const* extentY, float const* extentZ,
+			uint32* visible, std::size_t count)
+		{
+			cull_bits(visible, count, [&](std::size_t i)
+			{
+				return intersect_frustum_box(planes, vec3(centerX[i], centerY[i], centerZ[i]), vec3(extentX[i], extentY[i], extentZ[i]));
+			});
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "frustum_culling_simd.inl"
+#endif
+
+namespace glm{
+namespace batch
+{
+	GLM_FUNC_QUALIFIER void cullSpheres(
+		vec4 const* planes, float const* x, float const* y, float const* z, float const* radius,
+		uint32* visible, std::size_t count)
+	{
+		detail::compute_cull_spheres<GLM_CONFIG_SIMD == GLM_ENABLE>::call(planes, x, y, z, radius, visible, count);
+	}
+
+	GLM_FUNC_QUALIFIER void cullMinMaxAABBs(
+		vec4 const* planes,
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		uint32* visible, std::size_t count)
+	{
+		detail::compute_cull_min_max_aabbs<GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			planes, minX, minY, minZ, maxX, maxY, maxZ, visible, count);
+	}
+
+	GLM_FUNC_QUALIFIER void cullCenterExtentAABBs(
+		vec4 const* planes,
+		float const* centerX, float const* centerY, float const* centerZ,
+		float const* extentX, float const* extentY, float const* extentZ,
+		uint32* visible, std::size_t count)
+	{
+		detail::compute_cull_center_extent_aabbs<GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			planes, centerX, centerY, centerZ, extentX, extentY, extentZ, visible, count);
+	}
+
+#	if GLM_HAS_SPAN
+	GLM_FUNC_QUALIFIER void cullSpheres(
+		std::span<vec4 const, 6> planes, std::span<float const> x, std::span<float const> y, std::span<float const> z, std::span<float const> radius,
+		std::span<uint32> visible)
+	{
+		std::size_t const Count = x.size();
+		assert(y.size() == Count && z.size() == Count && radius.size() == Count);
+		assert(visible.size() >= (Count + 31) / 32);
+		cullSpheres(planes.data(), x.data(), y.data(), z.data(), radius.data(), visible.data(), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void cullMinMaxAABBs(
+		std::span<vec4 const, 6> planes,
+		std::span<float const> minX, std::span<float const> minY, std::span<float const> minZ,
+		std::span<float const> maxX, std::span<float const> maxY, std::span<float const> maxZ,
+		std::span<uint32> visible)
+	{
+		std::size_t const Count = minX.size();
+		assert(minY.size() == Count && minZ.size() == Count);
+		assert(maxX.size() == Count && maxY.size() == Count && maxZ.size() == Count);
+		assert(visible.size() >= (Count + 31) / 32);
+		cullMinMaxAABBs(planes.data(), minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data(), visible.data(), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void cullCenterExtentAABBs(
+		std::span<vec4 const, 6> planes,
+		std::span<float const> centerX, std::span<float const> centerY, std::span<float const> centerZ,
+		std::span<float const> extentX, std::span<float const> extentY, std::span<float const> extentZ,
+		std::span<uint32> visible)
+	{
+		std::size_t const Count = centerX.size();
+		assert(centerY.size() == Count && centerZ.size() == Count);
+		assert(extentX.size() == Count && extentY.size() == Count && extentZ.size() == Count);
+		assert(visible.size() >= (Count + 31) / 32);
+		cullCenterExtentAABBs(planes.data(), centerX.data(), centerY.data(), centerZ.data(), extentX.data(), extentY.data(), extentZ.data(), visible.data(), Count);
+	}
+#	endif//GLM_HAS_SPAN
+}//namespace batch
+}//namespace glm
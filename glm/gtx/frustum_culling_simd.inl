@@ -0,0 +1,242 @@
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The register operations of the culling loops, 4 volumes per __m128
+	struct batch_cull_sse
+	{
+		typedef __m128 fvec;
+		static constexpr std::size_t size = 4;
+		static constexpr uint32 lanes = 0xF;
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec fma(fvec a, fvec b, fvec c) { return glm_vec4_fma(a, b, c); }
+		GLM_FUNC_QUALIFIER static fvec orf(fvec a, fvec b) { return _mm_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmplt(fvec a, fvec b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static uint32 movemask(fvec a) { return static_cast<uint32>(_mm_movemask_ps(a)); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// 8 volumes per __m256
+	struct batch_cull_avx
+	{
+		typedef __m256 fvec;
+		static constexpr std::size_t size = 8;
+		static constexpr uint32 lanes = 0xFF;
+
+		GLM_FUNC_QUALIFIER static fvec set(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static fvec load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static fvec add(fvec a, fvec b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec sub(fvec a, fvec b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec mul(fvec a, fvec b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec fma(fvec a, fvec b, fvec c) { return glm_vec8_fma(a, b, c); }
+		GLM_FUNC_QUALIFIER static fvec orf(fvec a, fvec b) { return _mm256_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static fvec cmplt(fvec a, fvec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static uint32 movemask(fvec a) { return static_cast<uint32>(_mm256_movemask_ps(a)); }
+	};
+
+	typedef batch_cull_avx batch_cull_simd;
+#	else
+	typedef batch_cull_sse batch_cull_simd;
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// The six planes broadcast to registers, with the absolute values of the
+	// normals for the box tests
+	template<typename simd>
+	struct batch_cull_planes
+	{
+		typename simd::fvec Normal[6][3];
+		typename simd::fvec AbsNormal[6][3];
+		typename simd::fvec Offset[6];
+
+		GLM_FUNC_QUALIFIER explicit batch_cull_planes(vec4 const* planes)
+		{
+			for(length_t i = 0; i < 6; ++i)
+			{
+				for(length_t j = 0; j < 3; ++j)
+				{
+					Normal[i][j] = simd::set(planes[i][j]);
+					AbsNormal[i][j] = simd::set(abs(planes[i][j]));
+				}
+				Offset[i] = simd::set(planes[i].w);
+			}
+		}
+
+		// Signed distances of the points (x, y, z) to plane i
+		GLM_FUNC_QUALIFIER typename simd::fvec distance(length_t i, typename simd::fvec x, typename simd::fvec y, typename simd::fvec z) const
+		{
+			return simd::fma(Normal[i][0], x, simd::fma(Normal[i][1], y, simd::fma(Normal[i][2], z, Offset[i])));
+		}
+
+		// Distances from the box centers to their corners furthest along the normal of plane i
+		GLM_FUNC_QUALIFIER typename simd::fvec radius(length_t i, typename simd::fvec x, typename simd::fvec y, typename simd::fvec z) const
+		{
+			return simd::fma(AbsNormal[i][0], x, simd::fma(AbsNormal[i][1], y, simd::mul(AbsNormal[i][2], z)));
+		}
+	};
+
+	// Visibility bits of simd::size spheres, streams being x, y, z and radius
+	template<typename simd>
+	GLM_FUNC_QUALIFIER uint32 batch_cull_spheres_block(batch_cull_planes<simd> const& Planes, float const* const* Streams)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const X = simd::load(Streams[0]);
+		fvec const Y = simd::load(Streams[1]);
+		fvec const Z = simd::load(Streams[2]);
+		fvec const NegRadius = simd::sub(simd::set(0.0f), simd::load(Streams[3]));
+
+		fvec Outside = simd::cmplt(Planes.distance(0, X, Y, Z), NegRadius);
+		Outside = simd::orf(Outside, simd::cmplt(Planes.distance(1, X, Y, Z), NegRadius));
+		Outside = simd::orf(Outside, simd::cmplt(Planes.distance(2, X, Y, Z), NegRadius));
+		Outside = simd::orf(Outside, simd::cmplt(Planes.distance(3, X, Y, Z), NegRadius));
+		Outside = simd::orf(Outside, simd::cmplt(Planes.distance(4, X, Y, Z), NegRadius));
+		Outside = simd::orf(Outside, simd::cmplt(Planes.distance(5, X, Y, Z), NegRadius));
+		return simd::movemask(Outside) ^ simd::lanes;
+	}
+
+	// Visibility bits of simd::size boxes given by their centers and half extents
+	template<typename simd>
+	GLM_FUNC_QUALIFIER uint32 batch_cull_boxes(
+		batch_cull_planes<simd> const& Planes,
+		typename simd::fvec CX, typename simd::fvec CY, typename simd::fvec CZ,
+		typename simd::fvec EX, typename simd::fvec EY, typename simd::fvec EZ)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const Zero = simd::set(0.0f);
+		fvec Outside = simd::cmplt(simd::add(Planes.distance(0, CX, CY, CZ), Planes.radius(0, EX, EY, EZ)), Zero);
+		Outside = simd::orf(Outside, simd::cmplt(simd::add(Planes.distance(1, CX, CY, CZ), Planes.radius(1, EX, EY, EZ)), Zero));
+		Outside = simd::orf(Outside, simd::cmplt(simd::add(Planes.distance(2, CX, CY, CZ), Planes.radius(2, EX, EY, EZ)), Zero));
+		Outside = simd::orf(Outside, simd::cmplt(simd::add(Planes.distance(3, CX, CY, CZ), Planes.radius(3, EX, EY, EZ)), Zero));
+		Outside = simd::orf(Outside, simd::cmplt(simd::add(Planes.distance(4, CX, CY, CZ), Planes.radius(4, EX, EY, EZ)), Zero));
+		Outside = simd::orf(Outside, simd::cmplt(simd::add(Planes.distance(5, CX, CY, CZ), Planes.radius(5, EX, EY, EZ)), Zero));
+		return simd::movemask(Outside) ^ simd::lanes;
+	}
+
+	// Streams being the minimum x, y, z then the maximum x, y, z
+	template<typename simd>
+	GLM_FUNC_QUALIFIER uint32 batch_cull_min_max_block(batch_cull_planes<simd> const& Planes, float const* const* Streams)
+	{
+		typedef typename simd::fvec fvec;
+
+		fvec const Half = simd::set(0.5f);
+		fvec const MinX = simd::load(Streams[0]);
+		fvec const MinY = simd::load(Streams[1]);
+		fvec const MinZ = simd::load(Streams[2]);
+		fvec const MaxX = simd::load(Streams[3]);
+		fvec const MaxY = simd::load(Streams[4]);
+		fvec const MaxZ = simd::load(Streams[5]);
+		return batch_cull_boxes<simd>(Planes,
+			simd::mul(simd::add(MinX, MaxX), Half), simd::mul(simd::add(MinY, MaxY), Half), simd::mul(simd::add(MinZ, MaxZ), Half),
+			simd::mul(simd::sub(MaxX, MinX), Half), simd::mul(simd::sub(MaxY, MinY), Half), simd::mul(simd::sub(MaxZ, MinZ), Half));
+	}
+
+	// Streams being the center x, y, z then the extent x, y, z
+	template<typename simd>
+	GLM_FUNC_QUALIFIER uint32 batch_cull_center_extent_block(batch_cull_planes<simd> const& Planes, float const* const* Streams)
+	{
+		return batch_cull_boxes<simd>(Planes,
+			simd::load(Streams[0]), simd::load(Streams[1]), simd::load(Streams[2]),
+			simd::load(Streams[3]), simd::load(Streams[4]), simd::load(Streams[5]));
+	}
+
+	// Runs Block over whole registers of volumes and packs its bits 32 per
+	// word. The remainder of the last word is copied to a zero padded block.
+	template<typename simd, std::size_t K, typename block_func>
+	GLM_FUNC_QUALIFIER void batch_cull(float const* const (&streams)[K], uint32* visible, std::size_t count, block_func Block)
+	{
+		for(std::size_t Base = 0; Base < count; Base += 32)
+		{
+			std::size_t const End = count - Base < 32 ? count - Base : 32;
+			float const* Streams[K];
+			uint32 Word = 0;
+			std::size_t i = 0;
+			for(; i + simd::size <= End; i += simd::size)
+			{
+				for(std::size_t k = 0; k < K; ++k)
+					Streams[k] = streams[k] + Base + i;
+				Word |= Block(Streams) << i;
+			}
+
+			if(i < End)
+			{
+				float Padded[K][simd::size] = {};
+				for(std::size_t k = 0; k < K; ++k)
+				{
+					for(std::size_t j = 0; j < End - i; ++j)
+						Padded[k][j] = streams[k][Base + i + j];
+					Streams[k] = Padded[k];
+				}
+				Word |= (Block(Streams) & ((1u << (End - i)) - 1u)) << i;
+			}
+
+			visible[Base / 32] = Word;
+		}
+	}
+
+	template<>
+	struct compute_cull_spheres<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes, float const* x, float const* y, float const* z, float const* radius,
+			uint32* visible, std::size_t count)
+		{
+			typedef batch_cull_simd simd;
+			batch_cull_planes<simd> const Planes(planes);
+			float const* const Streams[] = {x, y, z, radius};
+			batch_cull<simd>(Streams, visible, count, [&Planes](float const* const* s)
+			{
+				return batch_cull_spheres_block<simd>(Planes, s);
+			});
+		}
+	};
+
+	template<>
+	struct compute_cull_min_max_aabbs<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes,
+			float const* minX, float const* minY, float const* minZ,
+			float const* maxX, float const* maxY, float const* maxZ,
+			uint32* visible, std::size_t count)
+		{
+			typedef batch_cull_simd simd;
+			batch_cull_planes<simd> const Planes(planes);
+			float const* const Streams[] = {minX, minY, minZ, maxX, maxY, maxZ};
+			batch_cull<simd>(Streams, visible, count, [&Planes](float const* const* s)
+			{
+				return batch_cull_min_max_block<simd>(Planes, s);
+			});
+		}
+	};
+
+	template<>
+	struct compute_cull_center_extent_aabbs<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec4 const* planes,
+			float const* centerX, float const* centerY, float const* centerZ,
+			float const* extentX, float const* extentY, float const* extentZ,
+			uint32* visible, std::size_t count)
+		{
+			typedef batch_cull_simd simd;
+			batch_cull_planes<simd> const Planes(planes);
+			float const* const Streams[] = {centerX, centerY, centerZ, extentX, extentY, extentZ};
+			batch_cull<simd>(Streams, visible, count, [&Planes](float const* const* s)
+			{
+				return batch_cull_center_extent_block<simd>(Planes, s);
+			});
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -20,6 +20,7 @@
 #include "../geometric.hpp"
 #include "../gtx/closest_point.hpp"
 #include "../gtx/vector_query.hpp"
+#include "../ext/vector_wide.hpp"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_closest_point is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -84,6 +85,28 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersections of a ray and N triangles, one per lane.
+	//! Each lane takes the tests of intersectRayTriangle without branching
+	//! and the returned mask holds the lanes hit; baryPosition and distance
+	//! are only meaningful in those lanes.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, length_t N, qualifier Q>
+	GLM_FUNC_DECL wide::mask<T, N> intersectRayTriangle(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		wide::vec<3, T, N> const& vert0, wide::vec<3, T, N> const& vert1, wide::vec<3, T, N> const& vert2,
+		wide::vec<2, T, N>& baryPosition, wide::scalar<T, N>& distance);
+
+	//! Compute the intersections of N rays, one per lane, and a triangle.
+	//! Each lane takes the tests of intersectRayTriangle without branching
+	//! and the returned mask holds the lanes hit; baryPosition and distance
+	//! are only meaningful in those lanes.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, length_t N, qualifier Q>
+	GLM_FUNC_DECL wide::mask<T, N> intersectRayTriangle(
+		wide::vec<3, T, N> const& orig, wide::vec<3, T, N> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		wide::vec<2, T, N>& baryPosition, wide::scalar<T, N>& distance);
+
 	/// @}
 }//namespace glm
 
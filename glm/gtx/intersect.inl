@@ -100,6 +100,69 @@ namespace glm
 		return true;
 	}
 
+namespace detail
+{
+	// Möller-Trumbore as in intersectRayTriangle, with the bounds tests on
+	// u and v applied to their values taken with the sign of det so that
+	// both orientations share one set of comparisons
+	template<typename T, length_t N>
+	GLM_FUNC_QUALIFIER wide::mask<T, N> intersect_ray_triangle_wide(
+		wide::vec<3, T, N> const& orig, wide::vec<3, T, N> const& dir,
+		wide::vec<3, T, N> const& vert0, wide::vec<3, T, N> const& edge1, wide::vec<3, T, N> const& edge2,
+		wide::vec<2, T, N>& baryPosition, wide::scalar<T, N>& distance)
+	{
+		wide::vec<3, T, N> const p = wide::cross(dir, edge2);
+		wide::scalar<T, N> const det = wide::dot(edge1, p);
+
+		T const epsilon = static_cast<T>(1e-20);
+		wide::mask<T, N> const negative = det < static_cast<T>(0);
+		wide::scalar<T, N> const absDet = wide::abs(det);
+		wide::scalar<T, N> const inv_det = static_cast<T>(1) / det;
+
+		wide::vec<3, T, N> const dist = orig - vert0;
+		wide::scalar<T, N> const u = wide::dot(dist, p);
+		wide::vec<3, T, N> const perpendicular = wide::cross(dist, edge1);
+		wide::scalar<T, N> const v = wide::dot(dir, perpendicular);
+
+		wide::scalar<T, N> const signedU = wide::select(negative, -u, u);
+		wide::scalar<T, N> const signedV = wide::select(negative, -v, v);
+
+		distance = wide::dot(edge2, perpendicular) * inv_det;
+		baryPosition = wide::vec<2, T, N>(u * inv_det, v * inv_det);
+
+		return absDet >= epsilon
+			&& signedU >= static_cast<T>(0) && signedU <= absDet
+			&& signedV >= static_cast<T>(0) && signedU + signedV <= absDet;
+	}
+}//namespace detail
+
+	template<typename T, length_t N, qualifier Q>
+	GLM_FUNC_QUALIFIER wide::mask<T, N> intersectRayTriangle
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		wide::vec<3, T, N> const& vert0, wide::vec<3, T, N> const& vert1, wide::vec<3, T, N> const& vert2,
+		wide::vec<2, T, N>& baryPosition, wide::scalar<T, N>& distance
+	)
+	{
+		return detail::intersect_ray_triangle_wide(
+			wide::vec<3, T, N>(orig), wide::vec<3, T, N>(dir),
+			vert0, vert1 - vert0, vert2 - vert0, baryPosition, distance);
+	}
+
+	template<typename T, length_t N, qualifier Q>
+	GLM_FUNC_QUALIFIER wide::mask<T, N> intersectRayTriangle
+	(
+		wide::vec<3, T, N> const& orig, wide::vec<3, T, N> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		wide::vec<2, T, N>& baryPosition, wide::scalar<T, N>& distance
+	)
+	{
+		// The edges are computed once for all the rays
+		return detail::intersect_ray_triangle_wide(
+			orig, dir, wide::vec<3, T, N>(vert0), wide::vec<3, T, N>(vert1 - vert0), wide::vec<3, T, N>(vert2 - vert0),
+			baryPosition, distance);
+	}
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER bool intersectLineTriangle
 	(
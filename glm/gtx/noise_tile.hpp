@@ -0,0 +1,201 @@
+/// @ref gtx_noise_tile
+/// @file glm/gtx/noise_tile.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise
+/// @see gtx_hash
+///
+/// @defgroup gtx_noise_tile GLM_GTX_noise_tile
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_tile.hpp> to use the features of this extension.
+///
+/// Tiled 2D and 3D fractal noise generated by a pool of threads, with a
+/// least recently used cache of the tiles.
+///
+/// The noise field is the fractal sum of noise_tile_params evaluated at
+/// frequency * x for the world position x. Tiles cut it into blocks of
+/// size^L samples spaced by spacing: sample i of the tile at coordinate c
+/// is at x = (c * size + i) * spacing, and neighbouring tiles continue
+/// each other without a seam. Samples are stored x fastest, as by
+/// glm::batch::perlinGrid.
+///
+/// Tiles are cached under their coordinate and their parameters. A tile
+/// requested again while it is being generated is not generated twice: both
+/// requests wait for the same std::shared_future. A tile dropped from the
+/// cache stays valid for as long as a caller holds it.
+///
+/// The workers are std::thread; link the threads library of the platform
+/// (Threads::Threads with CMake) when using this extension. For that reason
+/// it is not included by <glm/ext.hpp>.
+
+#pragma once
+
+// Dependencies
+#include "../gtc/noise.hpp"
+#include "hash.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_noise_tile is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_noise_tile extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_tile
+	/// @{
+
+	/// Octave sums of the tiles, as by fbm, ridged, billow and turbulence
+	enum noise_tile_fractal
+	{
+		noise_tile_fbm,
+		noise_tile_ridged,
+		noise_tile_billow,
+		noise_tile_turbulence
+	};
+
+	/// Parameters of the noise field of the tiles
+	template<typename T>
+	struct noise_tile_params
+	{
+		noise_basis basis = noise_simplex;
+		noise_tile_fractal fractal = noise_tile_fbm;
+		int octaves = 6;
+		T frequency = static_cast<T>(1);
+		T lacunarity = static_cast<T>(2);
+		T gain = static_cast<T>(0.5);
+	};
+
+	template<typename T>
+	GLM_FUNC_DECL bool operator==(noise_tile_params<T> const& a, noise_tile_params<T> const& b);
+
+	template<typename T>
+	GLM_FUNC_DECL bool operator!=(noise_tile_params<T> const& a, noise_tile_params<T> const& b);
+
+	/// Generates tiles of noise on worker threads and keeps the most recently
+	/// used ones. All member functions may be called from any thread.
+	///
+	/// @tparam L 2 or 3
+	/// @tparam T float or double
+	template<length_t L, typename T>
+	class noise_tile_cache
+	{
+		static_assert(L == 2 || L == 3, "'noise_tile_cache' only supports 2D and 3D tiles");
+
+	public:
+		typedef vec<L, int, defaultp> coord_type;
+		typedef std::shared_ptr<std::vector<T> const> tile_type;
+
+		/// @param size Samples along each edge of a tile. std::length_error is
+		/// thrown when size^L samples do not fit in a std::size_t.
+		/// @param spacing Distance between neighbouring samples.
+		/// @param capacity Maximum number of tiles kept, at least one.
+		/// @param threads Worker threads, std::thread::hardware_concurrency() when zero.
+		GLM_FUNC_DISCARD_DECL noise_tile_cache(int size, T spacing, std::size_t capacity, unsigned threads = 0);
+
+		/// Finishes the queued tiles and joins the workers.
+		GLM_FUNC_DISCARD_DECL ~noise_tile_cache();
+
+		noise_tile_cache(noise_tile_cache const&) = delete;
+		noise_tile_cache& operator=(noise_tile_cache const&) = delete;
+
+		/// Returns the tile at coord, queuing its generation unless it is
+		/// cached or already queued.
+		GLM_FUNC_DECL std::shared_future<tile_type> request(coord_type const& coord, noise_tile_params<T> const& params);
+
+		/// Returns the tile at coord once it is generated. An exception thrown
+		/// while generating it, such as std::bad_alloc, is rethrown here; the
+		/// tile is then dropped from the cache and generated again by the next
+		/// request.
+		GLM_FUNC_DECL tile_type tile(coord_type const& coord, noise_tile_params<T> const& params);
+
+		/// Requests every tile from first to last inclusive, so that they are
+		/// generated in parallel, then waits for them. out receives
+		/// (last - first + 1) tiles, x fastest.
+		GLM_FUNC_DISCARD_DECL void region(coord_type const& first, coord_type const& last, noise_tile_params<T> const& params, tile_type* out);
+
+		/// Drops every cached tile.
+		GLM_FUNC_DISCARD_DECL void clear();
+
+		/// Number of cached tiles
+		GLM_FUNC_DECL std::size_t cached() const;
+		/// Requests served from the cache
+		GLM_FUNC_DECL std::size_t hits() const;
+		/// Requests that queued a tile
+		GLM_FUNC_DECL std::size_t misses() const;
+
+		GLM_FUNC_DECL int size() const;
+		GLM_FUNC_DECL T spacing() const;
+		GLM_FUNC_DECL unsigned threads() const;
+
+	private:
+		struct key
+		{
+			coord_type coord;
+			noise_tile_params<T> params;
+
+			GLM_FUNC_DECL bool operator==(key const& k) const;
+		};
+
+		struct key_hash
+		{
+			GLM_FUNC_DECL std::size_t operator()(key const& k) const;
+		};
+
+		struct job
+		{
+			key k;
+			std::shared_ptr<std::promise<tile_type> > promise;
+		};
+
+		// A cached tile, generated or queued. promise identifies the request
+		// that queued it.
+		struct entry
+		{
+			key k;
+			std::shared_future<tile_type> future;
+			std::promise<tile_type> const* promise;
+		};
+
+		typedef std::list<entry> list_type;
+
+		GLM_FUNC_DISCARD_DECL void work();
+		GLM_FUNC_DECL tile_type generate(key const& k) const;
+
+		int const Size;
+		std::size_t const Samples;
+		T const Spacing;
+		std::size_t const Capacity;
+
+		mutable std::mutex Mutex;
+		std::condition_variable Ready;
+		bool Stop;
+		std::deque<job> Jobs;
+
+		// Most recently used first
+		list_type Recent;
+		std::unordered_map<key, typename list_type::iterator, key_hash> Index;
+		std::size_t Hits;
+		std::size_t Misses;
+
+		std::vector<std::thread> Workers;
+	};
+
+	/// @}
+}//namespace glm
+
+#include "noise_tile.inl"
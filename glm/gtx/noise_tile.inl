@@ -0,0 +1,324 @@
+/// @ref gtx_noise_tile
+
+namespace glm{
+namespace detail
+{
+	// The octave sums of fbm, ridged, billow and turbulence with a run-time
+	// number of octaves, over the grid of a tile
+	template<noise_basis Basis, typename shape, length_t L, typename T>
+	GLM_FUNC_QUALIFIER void noise_tile_fill(vec<L, T, defaultp> const& origin, T step, int size, noise_tile_params<T> const& params, T* out)
+	{
+		shape const Shape = shape();
+		noise_grid(origin, vec<L, T, defaultp>(step), vec<L, int, defaultp>(size), out, [&](auto const& p)
+		{
+			decltype(Shape(noise_sample<Basis>(p))) Result(static_cast<T>(0));
+			T Frequency = static_cast<T>(1);
+			T Amplitude = static_cast<T>(1);
+			for(int o = 0; o < params.octaves; ++o)
+			{
+				Result += Amplitude * Shape(noise_sample<Basis>(p * Frequency));
+				Frequency *= params.lacunarity;
+				Amplitude *= params.gain;
+			}
+			return Result;
+		});
+	}
+
+	template<noise_basis Basis, length_t L, typename T>
+	GLM_FUNC_QUALIFIER void noise_tile_fill(vec<L, T, defaultp> const& origin, T step, int size, noise_tile_params<T> const& params, T* out)
+	{
+		switch(params.fractal)
+		{
+		case noise_tile_fbm:
+			noise_tile_fill<Basis, noise_fbm<T> >(origin, step, size, params, out);
+			break;
+		case noise_tile_ridged:
+			noise_tile_fill<Basis, noise_ridged<T> >(origin, step, size, params, out);
+			break;
+		case noise_tile_billow:
+			noise_tile_fill<Basis, noise_billow<T> >(origin, step, size, params, out);
+			break;
+		case noise_tile_turbulence:
+			noise_tile_fill<Basis, noise_turbulence<T> >(origin, step, size, params, out);
+			break;
+		}
+	}
+
+	// Samples in a tile of size^L
+	template<length_t L>
+	GLM_FUNC_QUALIFIER std::size_t noise_tile_count(int size)
+	{
+		assert(size > 0);
+
+		std::size_t const Edge = static_cast<std::size_t>(size);
+		std::size_t Count = 1;
+		for(length_t c = 0; c < L; ++c)
+		{
+			if(Count > std::numeric_limits<std::size_t>::max() / Edge)
+				throw std::length_error("glm::noise_tile_cache: size^L samples overflow std::size_t");
+			Count *= Edge;
+		}
+		return Count;
+	}
+}//namespace detail
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER bool operator==(noise_tile_params<T> const& a, noise_tile_params<T> const& b)
+	{
+		return
+			a.basis == b.basis && a.fractal == b.fractal && a.octaves == b.octaves &&
+			a.frequency == b.frequency && a.lacunarity == b.lacunarity && a.gain == b.gain;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER bool operator!=(noise_tile_params<T> const& a, noise_tile_params<T> const& b)
+	{
+		return !(a == b);
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER bool noise_tile_cache<L, T>::key::operator==(key const& k) const
+	{
+		return coord == k.coord && params == k.params;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t noise_tile_cache<L, T>::key_hash::operator()(key const& k) const
+	{
+		std::size_t Seed = std::hash<coord_type>()(k.coord);
+		detail::hash_combine(Seed, std::hash<int>()(static_cast<int>(k.params.basis)));
+		detail::hash_combine(Seed, std::hash<int>()(static_cast<int>(k.params.fractal)));
+		detail::hash_combine(Seed, std::hash<int>()(k.params.octaves));
+		detail::hash_combine(Seed, std::hash<T>()(k.params.frequency));
+		detail::hash_combine(Seed, std::hash<T>()(k.params.lacunarity));
+		detail::hash_combine(Seed, std::hash<T>()(k.params.gain));
+		return Seed;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER noise_tile_cache<L, T>::noise_tile_cache(int size, T spacing, std::size_t capacity, unsigned threads)
+		: Size(size)
+		, Samples(detail::noise_tile_count<L>(size))
+		, Spacing(spacing)
+		, Capacity(capacity)
+		, Stop(false)
+		, Hits(0)
+		, Misses(0)
+	{
+		assert(capacity > 0);
+
+		if(threads == 0)
+			threads = std::thread::hardware_concurrency();
+		if(threads == 0)
+			threads = 1;
+
+		Workers.reserve(threads);
+		try
+		{
+			for(unsigned i = 0; i < threads; ++i)
+				Workers.emplace_back([this]{ this->work(); });
+		}
+		catch(...)
+		{
+			// The workers already started must be joined before unwinding
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				Stop = true;
+			}
+			Ready.notify_all();
+			for(std::size_t i = 0; i < Workers.size(); ++i)
+				Workers[i].join();
+			throw;
+		}
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER noise_tile_cache<L, T>::~noise_tile_cache()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Stop = true;
+		}
+		Ready.notify_all();
+
+		for(std::size_t i = 0; i < Workers.size(); ++i)
+			Workers[i].join();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::shared_future<typename noise_tile_cache<L, T>::tile_type> noise_tile_cache<L, T>::request(coord_type const& coord, noise_tile_params<T> const& params)
+	{
+		assert(params.octaves > 0);
+
+		key const Key = {coord, params};
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		typename std::unordered_map<key, typename list_type::iterator, key_hash>::iterator const Found = Index.find(Key);
+		if(Found != Index.end())
+		{
+			++Hits;
+			Recent.splice(Recent.begin(), Recent, Found->second);
+			return Found->second->future;
+		}
+
+		++Misses;
+		std::shared_ptr<std::promise<tile_type> > Promise(new std::promise<tile_type>());
+		std::shared_future<tile_type> const Future = Promise->get_future().share();
+
+		Recent.push_front(entry{Key, Future, Promise.get()});
+		Index.emplace(Key, Recent.begin());
+		while(Recent.size() > Capacity)
+		{
+			Index.erase(Recent.back().k);
+			Recent.pop_back();
+		}
+
+		Jobs.push_back(job{Key, Promise});
+		Ready.notify_one();
+
+		return Future;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER typename noise_tile_cache<L, T>::tile_type noise_tile_cache<L, T>::tile(coord_type const& coord, noise_tile_params<T> const& params)
+	{
+		return this->request(coord, params).get();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void noise_tile_cache<L, T>::region(coord_type const& first, coord_type const& last, noise_tile_params<T> const& params, tile_type* out)
+	{
+		std::size_t Count = 1;
+		for(length_t c = 0; c < L; ++c)
+		{
+			assert(first[c] <= last[c]);
+			Count *= static_cast<std::size_t>(last[c] - first[c] + 1);
+		}
+
+		// Queue everything before waiting for anything
+		std::vector<std::shared_future<tile_type> > Futures;
+		Futures.reserve(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			coord_type Coord;
+			std::size_t Rest = i;
+			for(length_t c = 0; c < L; ++c)
+			{
+				std::size_t const Extent = static_cast<std::size_t>(last[c] - first[c] + 1);
+				Coord[c] = first[c] + static_cast<int>(Rest % Extent);
+				Rest /= Extent;
+			}
+			Futures.push_back(this->request(Coord, params));
+		}
+
+		for(std::size_t i = 0; i < Count; ++i)
+			out[i] = Futures[i].get();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void noise_tile_cache<L, T>::clear()
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		Index.clear();
+		Recent.clear();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t noise_tile_cache<L, T>::cached() const
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		return Recent.size();
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t noise_tile_cache<L, T>::hits() const
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		return Hits;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER std::size_t noise_tile_cache<L, T>::misses() const
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		return Misses;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER int noise_tile_cache<L, T>::size() const
+	{
+		return Size;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER T noise_tile_cache<L, T>::spacing() const
+	{
+		return Spacing;
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER unsigned noise_tile_cache<L, T>::threads() const
+	{
+		return static_cast<unsigned>(Workers.size());
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER void noise_tile_cache<L, T>::work()
+	{
+		for(;;)
+		{
+			job Job;
+			{
+				std::unique_lock<std::mutex> Lock(Mutex);
+				Ready.wait(Lock, [this]{ return Stop || !Jobs.empty(); });
+
+				// Stopping, once the queue is drained
+				if(Jobs.empty())
+					return;
+
+				Job = Jobs.front();
+				Jobs.pop_front();
+			}
+
+			// Errors reach the callers waiting on the tile
+			try
+			{
+				Job.promise->set_value(this->generate(Job.k));
+			}
+			catch(...)
+			{
+				// Dropped from the cache so that the next request tries again,
+				// unless it was evicted and queued anew meanwhile
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					typename std::unordered_map<key, typename list_type::iterator, key_hash>::iterator const Found = Index.find(Job.k);
+					if(Found != Index.end() && Found->second->promise == Job.promise.get())
+					{
+						Recent.erase(Found->second);
+						Index.erase(Found);
+					}
+				}
+				Job.promise->set_exception(std::current_exception());
+			}
+		}
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER typename noise_tile_cache<L, T>::tile_type noise_tile_cache<L, T>::generate(key const& k) const
+	{
+		// Sample i of the tile is at (coord * Size + i) * Spacing, scaled by
+		// the frequency
+		T const Step = Spacing * k.params.frequency;
+		vec<L, T, defaultp> Origin;
+		for(length_t c = 0; c < L; ++c)
+			Origin[c] = static_cast<T>(k.coord[c]) * static_cast<T>(Size) * Step;
+
+		std::shared_ptr<std::vector<T> > Tile(new std::vector<T>(Samples));
+		if(k.params.basis == noise_perlin)
+			detail::noise_tile_fill<noise_perlin>(Origin, Step, Size, k.params, Tile->data());
+		else
+			detail::noise_tile_fill<noise_simplex>(Origin, Step, Size, k.params, Tile->data());
+		return Tile;
+	}
+}//namespace glm
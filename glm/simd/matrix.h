@@ -1037,8 +1037,556 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// Deinterleave four packed vec3 (12 floats, 12-byte stride) into x, y and z registers.
+GLM_FUNC_QUALIFIER void glm_vec3x4_load_soa(float const* p, glm_vec4& x, glm_vec4& y, glm_vec4& z)
+{
+	__m128 const m0 = _mm_loadu_ps(p + 0); // x0 y0 z0 x1
+	__m128 const m1 = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+	__m128 const m2 = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+
+	__m128 const xy = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+	__m128 const yz = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+
+	x = _mm_shuffle_ps(m0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm_shuffle_ps(yz, m2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// Interleave x, y and z registers back into four packed vec3 (inverse of glm_vec3x4_load_soa).
+GLM_FUNC_QUALIFIER void glm_vec3x4_store_soa(float* p, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+{
+	__m128 const xy = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)); // x0 x2 y0 y2
+	__m128 const yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1)); // y1 y3 z1 z3
+	__m128 const zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0)); // z0 z2 x1 x3
+
+	_mm_storeu_ps(p + 0, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p + 4, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+	_mm_storeu_ps(p + 8, _mm_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+// Deinterleave four packed vec4 (16 floats) into x, y, z and w registers.
+GLM_FUNC_QUALIFIER void glm_vec4x4_load_soa(float const* p, glm_vec4& x, glm_vec4& y, glm_vec4& z, glm_vec4& w)
+{
+	x = _mm_loadu_ps(p + 0);
+	y = _mm_loadu_ps(p + 4);
+	z = _mm_loadu_ps(p + 8);
+	w = _mm_loadu_ps(p + 12);
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+}
+
+// Interleave x, y, z and w registers back into four packed vec4 (inverse of glm_vec4x4_load_soa).
+GLM_FUNC_QUALIFIER void glm_vec4x4_store_soa(float* p, glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 w)
+{
+	_MM_TRANSPOSE4_PS(x, y, z, w);
+	_mm_storeu_ps(p + 0, x);
+	_mm_storeu_ps(p + 4, y);
+	_mm_storeu_ps(p + 8, z);
+	_mm_storeu_ps(p + 12, w);
+}
+
+// Affine transforms held as the 3 rows (m0, m1, m2, t) of a row-major 3x4
+// matrix, the implicit last row being (0, 0, 0, 1).
+
+// Row of in1 times in2: x * in2[0] + y * in2[1] + z * in2[2] + (0, 0, 0, w)
+GLM_FUNC_QUALIFIER glm_vec4 glm_affine_row_mul(glm_vec4 r, glm_vec4 const in2[3])
+{
+	glm_vec4 const x = _mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const y = _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const z = _mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 2, 2, 2));
+	glm_vec4 const w = _mm_and_ps(r, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+
+	glm_vec4 const a0 = glm_vec4_fma(x, in2[0], w);
+	glm_vec4 const a1 = glm_vec4_fma(y, in2[1], a0);
+	return glm_vec4_fma(z, in2[2], a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_affine_mul(glm_vec4 const in1[3], glm_vec4 const in2[3], glm_vec4 out[3])
+{
+	glm_vec4 const r0 = glm_affine_row_mul(in1[0], in2);
+	glm_vec4 const r1 = glm_affine_row_mul(in1[1], in2);
+	glm_vec4 const r2 = glm_affine_row_mul(in1[2], in2);
+	out[0] = r0;
+	out[1] = r1;
+	out[2] = r2;
+}
+
+// (dot(m[0], v), dot(m[1], v), dot(m[2], v), v.w)
+GLM_FUNC_QUALIFIER glm_vec4 glm_affine_mul_vec4(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 const m0 = _mm_mul_ps(m[0], v);
+	glm_vec4 const m1 = _mm_mul_ps(m[1], v);
+	glm_vec4 const m2 = _mm_mul_ps(m[2], v);
+	glm_vec4 const m3 = _mm_and_ps(v, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+
+	glm_vec4 const u0 = _mm_unpacklo_ps(m0, m1);
+	glm_vec4 const u1 = _mm_unpackhi_ps(m0, m1);
+	glm_vec4 const a0 = _mm_add_ps(u0, u1);
+
+	glm_vec4 const u2 = _mm_unpacklo_ps(m2, m3);
+	glm_vec4 const u3 = _mm_unpackhi_ps(m2, m3);
+	glm_vec4 const a1 = _mm_add_ps(u2, u3);
+
+	return _mm_add_ps(_mm_movelh_ps(a0, a1), _mm_movehl_ps(a1, a0));
+}
+
+// Transposing the rows (R', t') of the inverse back from their columns:
+// the columns of R' are c[0], c[1], c[2] and t' = -(R' * t)
+GLM_FUNC_QUALIFIER void glm_affine_inverse_rows(glm_vec4 c0, glm_vec4 c1, glm_vec4 c2, glm_vec4 t, glm_vec4 out[3])
+{
+	glm_vec4 const x = _mm_mul_ps(c0, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const y = _mm_mul_ps(c1, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+	glm_vec4 const z = _mm_mul_ps(c2, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)));
+	glm_vec4 Translation = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(x, y), z));
+
+	_MM_TRANSPOSE4_PS(c0, c1, c2, Translation);
+	out[0] = c0;
+	out[1] = c1;
+	out[2] = c2;
+}
+
+// Inverse of a rotation and translation: (transpose(R), -transpose(R) * t)
+GLM_FUNC_QUALIFIER void glm_affine_inverse_rigid(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 r0 = in[0], r1 = in[1], r2 = in[2], t = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(r0, r1, r2, t);
+	glm_affine_inverse_rows(in[0], in[1], in[2], t, out);
+}
+
+// The inverse of R has the columns cross(r1, r2), cross(r2, r0) and
+// cross(r0, r1) divided by det(R) = dot(r0, cross(r1, r2)), r0, r1 and r2
+// being the rows of R. The w lanes of the rows hold t and cancel out in the
+// cross products.
+GLM_FUNC_QUALIFIER void glm_affine_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const c0 = glm_vec4_cross(in[1], in[2]);
+	glm_vec4 const c1 = glm_vec4_cross(in[2], in[0]);
+	glm_vec4 const c2 = glm_vec4_cross(in[0], in[1]);
+	glm_vec4 const Det = glm_vec3_dot(in[0], c0);
+	glm_vec4 const InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+	glm_vec4 r0 = in[0], r1 = in[1], r2 = in[2], t = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(r0, r1, r2, t);
+	glm_affine_inverse_rows(_mm_mul_ps(c0, InvDet), _mm_mul_ps(c1, InvDet), _mm_mul_ps(c2, InvDet), t, out);
+}
+
+// affineInverse of a column-major mat4: the rows of the inverse of the upper
+// 3x3 block are the cross products of its columns
+GLM_FUNC_QUALIFIER void glm_mat4_affineInverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 const Mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+	glm_vec4 const a0 = _mm_and_ps(in[0], Mask);
+	glm_vec4 const a1 = _mm_and_ps(in[1], Mask);
+	glm_vec4 const a2 = _mm_and_ps(in[2], Mask);
+	glm_vec4 const Det = glm_vec3_dot(a0, glm_vec4_cross(a1, a2));
+	glm_vec4 const InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+	glm_vec4 r0 = _mm_mul_ps(glm_vec4_cross(a1, a2), InvDet);
+	glm_vec4 r1 = _mm_mul_ps(glm_vec4_cross(a2, a0), InvDet);
+	glm_vec4 r2 = _mm_mul_ps(glm_vec4_cross(a0, a1), InvDet);
+	glm_vec4 r3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	glm_vec4 const t = in[3];
+	glm_vec4 const x = _mm_mul_ps(r0, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+	glm_vec4 const y = _mm_mul_ps(r1, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+	glm_vec4 const z = _mm_mul_ps(r2, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)));
+	glm_vec4 const Translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), _mm_add_ps(_mm_add_ps(x, y), z));
+
+	out[0] = r0;
+	out[1] = r1;
+	out[2] = r2;
+	out[3] = Translation;
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+// Two mat4 * vec4 products at once: each 128-bit half of v holds one vec4 and
+// each m[i] holds column i broadcast to both halves (_mm256_broadcast_ps).
+GLM_FUNC_QUALIFIER __m256 glm_mat4_mul_vec4x2(__m256 const m[4], __m256 v)
+{
+	__m256 const v0 = _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 const v1 = _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 const v2 = _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 const v3 = _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 const a0 = glm_vec8_fma(m[1], v1, _mm256_mul_ps(m[0], v0));
+	__m256 const a1 = glm_vec8_fma(m[3], v3, _mm256_mul_ps(m[2], v2));
+
+	return _mm256_add_ps(a0, a1);
+}
+
+// Deinterleave eight packed vec3 (24 floats, 12-byte stride) into x, y and z registers.
+GLM_FUNC_QUALIFIER void glm_vec3x8_load_soa(float const* p, __m256& x, __m256& y, __m256& z)
+{
+	__m256 const m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+	__m256 const m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+	__m256 const m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+	__m256 const xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+	__m256 const yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+	x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// Interleave x, y and z registers back into eight packed vec3 (inverse of glm_vec3x8_load_soa).
+GLM_FUNC_QUALIFIER void glm_vec3x8_store_soa(float* p, __m256 x, __m256 y, __m256 z)
+{
+	__m256 const xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+	__m256 const yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+	__m256 const zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+	__m256 const r03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+	__m256 const r14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	__m256 const r25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+	_mm_storeu_ps(p + 0, _mm256_castps256_ps128(r03));
+	_mm_storeu_ps(p + 4, _mm256_castps256_ps128(r14));
+	_mm_storeu_ps(p + 8, _mm256_castps256_ps128(r25));
+	_mm_storeu_ps(p + 12, _mm256_extractf128_ps(r03, 1));
+	_mm_storeu_ps(p + 16, _mm256_extractf128_ps(r14, 1));
+	_mm_storeu_ps(p + 20, _mm256_extractf128_ps(r25, 1));
+}
+
+// Transpose the 4x4 block held in each 128-bit half of r0..r3.
+GLM_FUNC_QUALIFIER void glm_vec4x8_transpose(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+{
+	__m256 const t0 = _mm256_unpacklo_ps(r0, r1); // x0 x1 y0 y1
+	__m256 const t1 = _mm256_unpacklo_ps(r2, r3); // x2 x3 y2 y3
+	__m256 const t2 = _mm256_unpackhi_ps(r0, r1); // z0 z1 w0 w1
+	__m256 const t3 = _mm256_unpackhi_ps(r2, r3); // z2 z3 w2 w3
+
+	r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Deinterleave eight packed vec4 (32 floats) into x, y, z and w registers.
+GLM_FUNC_QUALIFIER void glm_vec4x8_load_soa(float const* p, __m256& x, __m256& y, __m256& z, __m256& w)
+{
+	x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 16), 1);
+	y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 20), 1);
+	z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 24), 1);
+	w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 12)), _mm_loadu_ps(p + 28), 1);
+	glm_vec4x8_transpose(x, y, z, w);
+}
+
+// Interleave x, y, z and w registers back into eight packed vec4 (inverse of glm_vec4x8_load_soa).
+GLM_FUNC_QUALIFIER void glm_vec4x8_store_soa(float* p, __m256 x, __m256 y, __m256 z, __m256 w)
+{
+	glm_vec4x8_transpose(x, y, z, w);
+	_mm_storeu_ps(p + 0, _mm256_castps256_ps128(x));
+	_mm_storeu_ps(p + 4, _mm256_castps256_ps128(y));
+	_mm_storeu_ps(p + 8, _mm256_castps256_ps128(z));
+	_mm_storeu_ps(p + 12, _mm256_castps256_ps128(w));
+	_mm_storeu_ps(p + 16, _mm256_extractf128_ps(x, 1));
+	_mm_storeu_ps(p + 20, _mm256_extractf128_ps(y, 1));
+	_mm_storeu_ps(p + 24, _mm256_extractf128_ps(z, 1));
+	_mm_storeu_ps(p + 28, _mm256_extractf128_ps(w, 1));
+}
+
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_fma(__m256d a, __m256d b, __m256d c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+
+// Arbitrary lane permutation: result[j] = v[Ij]
+template<int I0, int I1, int I2, int I3>
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_swizzle(__m256d v)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(v, I0 | (I1 << 2) | (I2 << 4) | (I3 << 6));
+#	else
+		__m256d const lo = _mm256_permute2f128_pd(v, v, 0x00);
+		__m256d const hi = _mm256_permute2f128_pd(v, v, 0x11);
+		int const Sel = (I0 & 1) | ((I1 & 1) << 1) | ((I2 & 1) << 2) | ((I3 & 1) << 3);
+		return _mm256_blend_pd(_mm256_permute_pd(lo, Sel), _mm256_permute_pd(hi, Sel),
+			(I0 >> 1) | ((I1 >> 1) << 1) | ((I2 >> 1) << 2) | ((I3 >> 1) << 3));
+#	endif
+}
+
+template<int I>
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_splat(__m256d v)
+{
+	return glm_dvec4_swizzle<I, I, I, I>(v);
+}
+
+// Dot product broadcast to every lane
+GLM_FUNC_QUALIFIER __m256d glm_dvec4_dot(__m256d a, __m256d b)
+{
+	__m256d const mul0 = _mm256_mul_pd(a, b);
+	__m256d const add0 = _mm256_add_pd(mul0, _mm256_permute_pd(mul0, 0x5));
+	return _mm256_add_pd(add0, _mm256_permute2f128_pd(add0, add0, 0x01));
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_f64vec4 const in1[4], glm_f64vec4 const in2[4], glm_f64vec4 out[4])
+{
+	for(int i = 0; i < 4; ++i)
+	{
+		__m256d const e0 = glm_dvec4_splat<0>(in2[i]);
+		__m256d const e1 = glm_dvec4_splat<1>(in2[i]);
+		__m256d const e2 = glm_dvec4_splat<2>(in2[i]);
+		__m256d const e3 = glm_dvec4_splat<3>(in2[i]);
+
+		__m256d const a0 = glm_dvec4_fma(in1[1], e1, _mm256_mul_pd(in1[0], e0));
+		__m256d const a1 = glm_dvec4_fma(in1[3], e3, _mm256_mul_pd(in1[2], e2));
+
+		out[i] = _mm256_add_pd(a0, a1);
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dmat4_determinant(glm_f64vec4 const m[4])
+{
+	//T SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//T SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	//T SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	//T SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	//T SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	//T SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+	// SubFactor00, SubFactor00, SubFactor01, SubFactor02
+	__m256d const SubX = _mm256_sub_pd(
+		_mm256_mul_pd(glm_dvec4_swizzle<2, 2, 1, 1>(m[2]), glm_dvec4_swizzle<3, 3, 3, 2>(m[3])),
+		_mm256_mul_pd(glm_dvec4_swizzle<2, 2, 1, 1>(m[3]), glm_dvec4_swizzle<3, 3, 3, 2>(m[2])));
+	// SubFactor01, SubFactor03, SubFactor03, SubFactor04
+	__m256d const SubY = _mm256_sub_pd(
+		_mm256_mul_pd(glm_dvec4_swizzle<1, 0, 0, 0>(m[2]), glm_dvec4_swizzle<3, 3, 3, 2>(m[3])),
+		_mm256_mul_pd(glm_dvec4_swizzle<1, 0, 0, 0>(m[3]), glm_dvec4_swizzle<3, 3, 3, 2>(m[2])));
+	// SubFactor02, SubFactor04, SubFactor05, SubFactor05
+	__m256d const SubZ = _mm256_sub_pd(
+		_mm256_mul_pd(glm_dvec4_swizzle<1, 0, 0, 0>(m[2]), glm_dvec4_swizzle<2, 2, 1, 1>(m[3])),
+		_mm256_mul_pd(glm_dvec4_swizzle<1, 0, 0, 0>(m[3]), glm_dvec4_swizzle<2, 2, 1, 1>(m[2])));
+
+	//vec<4, T, Q> DetCof(
+	//	+ (m[1][1] * SubFactor00 - m[1][2] * SubFactor01 + m[1][3] * SubFactor02),
+	//	- (m[1][0] * SubFactor00 - m[1][2] * SubFactor03 + m[1][3] * SubFactor04),
+	//	+ (m[1][0] * SubFactor01 - m[1][1] * SubFactor03 + m[1][3] * SubFactor05),
+	//	- (m[1][0] * SubFactor02 - m[1][1] * SubFactor04 + m[1][2] * SubFactor05));
+	__m256d const MulX = _mm256_mul_pd(glm_dvec4_swizzle<1, 0, 0, 0>(m[1]), SubX);
+	__m256d const MulY = _mm256_mul_pd(glm_dvec4_swizzle<2, 2, 1, 1>(m[1]), SubY);
+	__m256d const MulZ = _mm256_mul_pd(glm_dvec4_swizzle<3, 3, 3, 2>(m[1]), SubZ);
+	__m256d const DetCof = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(MulX, MulY), MulZ), _mm256_setr_pd(1.0, -1.0, 1.0, -1.0));
+
+	//return m[0][0] * DetCof[0]
+	//	 + m[0][1] * DetCof[1]
+	//	 + m[0][2] * DetCof[2]
+	//	 + m[0][3] * DetCof[3];
+	return glm_dvec4_dot(m[0], DetCof);
+}
+
+// 2x2 blocks of a dmat4, one block per register: (b00, b01, b10, b11).
+// A * B
+GLM_FUNC_QUALIFIER __m256d glm_dmat2_mul(__m256d a, __m256d b)
+{
+	return _mm256_add_pd(
+		_mm256_mul_pd(a, glm_dvec4_swizzle<0, 3, 0, 3>(b)),
+		_mm256_mul_pd(_mm256_permute_pd(a, 0x5), glm_dvec4_swizzle<2, 1, 2, 1>(b)));
+}
+
+// adjugate(A) * B
+GLM_FUNC_QUALIFIER __m256d glm_dmat2_adj_mul(__m256d a, __m256d b)
+{
+	return _mm256_sub_pd(
+		_mm256_mul_pd(glm_dvec4_swizzle<3, 3, 0, 0>(a), b),
+		_mm256_mul_pd(glm_dvec4_swizzle<1, 1, 2, 2>(a), _mm256_permute2f128_pd(b, b, 0x01)));
+}
+
+// A * adjugate(B)
+GLM_FUNC_QUALIFIER __m256d glm_dmat2_mul_adj(__m256d a, __m256d b)
+{
+	return _mm256_sub_pd(
+		_mm256_mul_pd(a, glm_dvec4_swizzle<3, 0, 3, 0>(b)),
+		_mm256_mul_pd(_mm256_permute_pd(a, 0x5), glm_dvec4_swizzle<2, 1, 2, 1>(b)));
+}
+
+// Blockwise inversion: the 4x4 matrix is split into 2x2 blocks A, B, C, D and
+// the inverse blocks are built from 2x2 adjugates and the Schur complements,
+// which maps better onto 4 doubles per register than the cofactor shuffles of
+// glm_mat4_inverse. Operates on the transpose, which is fine as
+// inverse(transpose(M)) == transpose(inverse(M)).
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_f64vec4 const in[4], glm_f64vec4 out[4])
+{
+	__m256d const A = _mm256_permute2f128_pd(in[0], in[1], 0x20);
+	__m256d const B = _mm256_permute2f128_pd(in[0], in[1], 0x31);
+	__m256d const C = _mm256_permute2f128_pd(in[2], in[3], 0x20);
+	__m256d const D = _mm256_permute2f128_pd(in[2], in[3], 0x31);
+
+	// (det(A), det(C), det(B), det(D))
+	__m256d const DetSub = _mm256_sub_pd(
+		_mm256_mul_pd(_mm256_unpacklo_pd(in[0], in[2]), _mm256_unpackhi_pd(in[1], in[3])),
+		_mm256_mul_pd(_mm256_unpackhi_pd(in[0], in[2]), _mm256_unpacklo_pd(in[1], in[3])));
+	__m256d const DetA = glm_dvec4_splat<0>(DetSub);
+	__m256d const DetC = glm_dvec4_splat<1>(DetSub);
+	__m256d const DetB = glm_dvec4_splat<2>(DetSub);
+	__m256d const DetD = glm_dvec4_splat<3>(DetSub);
+
+	__m256d const D_C = glm_dmat2_adj_mul(D, C);
+	__m256d const A_B = glm_dmat2_adj_mul(A, B);
+	__m256d const X = _mm256_sub_pd(_mm256_mul_pd(DetD, A), glm_dmat2_mul(B, D_C));
+	__m256d const W = _mm256_sub_pd(_mm256_mul_pd(DetA, D), glm_dmat2_mul(C, A_B));
+	__m256d const Y = _mm256_sub_pd(_mm256_mul_pd(DetB, C), glm_dmat2_mul_adj(D, A_B));
+	__m256d const Z = _mm256_sub_pd(_mm256_mul_pd(DetC, B), glm_dmat2_mul_adj(A, D_C));
+
+	// det(M) = det(A) * det(D) + det(B) * det(C) - trace(A_B * D_C)
+	__m256d const Trace = glm_dvec4_dot(A_B, glm_dvec4_swizzle<0, 2, 1, 3>(D_C));
+	__m256d const DetM = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(DetA, DetD), _mm256_mul_pd(DetB, DetC)), Trace);
+	__m256d const RcpDetM = _mm256_div_pd(_mm256_setr_pd(1.0, -1.0, -1.0, 1.0), DetM);
+
+	__m256d const RX = _mm256_mul_pd(X, RcpDetM);
+	__m256d const RY = _mm256_mul_pd(Y, RcpDetM);
+	__m256d const RZ = _mm256_mul_pd(Z, RcpDetM);
+	__m256d const RW = _mm256_mul_pd(W, RcpDetM);
+
+	// Adjugate of each block, scattered back into columns
+	__m256d const XY01 = _mm256_permute2f128_pd(RX, RY, 0x20);
+	__m256d const XY23 = _mm256_permute2f128_pd(RX, RY, 0x31);
+	__m256d const ZW01 = _mm256_permute2f128_pd(RZ, RW, 0x20);
+	__m256d const ZW23 = _mm256_permute2f128_pd(RZ, RW, 0x31);
+
+	out[0] = _mm256_unpackhi_pd(XY23, XY01);
+	out[1] = _mm256_unpacklo_pd(XY23, XY01);
+	out[2] = _mm256_unpackhi_pd(ZW23, ZW01);
+	out[3] = _mm256_unpacklo_pd(ZW23, ZW01);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_fma(glm_f32vec16 a, glm_f32vec16 b, glm_f32vec16 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm512_fmadd_ps(a, b, c);
+#	else
+		return _mm512_add_ps(_mm512_mul_ps(a, b), c);
+#	endif
+}
+
+// A whole mat4 in one register: column i in 128-bit lane i.
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_load_x16(glm_vec4 const m[4])
+{
+	return _mm512_loadu_ps(reinterpret_cast<float const*>(m));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_store_x16(glm_vec4 m[4], glm_f32vec16 v)
+{
+	_mm512_storeu_ps(reinterpret_cast<float*>(m), v);
+}
+
+// Column I of m broadcast to every lane
+template<int I>
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_col_x16(glm_f32vec16 m)
+{
+	return _mm512_shuffle_f32x4(m, m, I * 0x55);
+}
+
+// Row I of m splat inside each lane: lane j holds m[j][I] four times
+template<int I>
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_elem_x16(glm_f32vec16 m)
+{
+	return _mm512_permute_ps(m, I * 0x55);
+}
+
+// Same multiply-add chain as detail::mul4x4<T, Q, true>, for all four columns at once
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_mul_x16(glm_f32vec16 a, glm_f32vec16 b)
+{
+	glm_f32vec16 r = _mm512_mul_ps(glm_mat4_col_x16<0>(a), glm_mat4_elem_x16<0>(b));
+	r = glm_vec16_fma(glm_mat4_col_x16<1>(a), glm_mat4_elem_x16<1>(b), r);
+	r = glm_vec16_fma(glm_mat4_col_x16<2>(a), glm_mat4_elem_x16<2>(b), r);
+	return glm_vec16_fma(glm_mat4_col_x16<3>(a), glm_mat4_elem_x16<3>(b), r);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4_x16(glm_f32vec16 m, glm_vec4 v)
+{
+	// Lane i = m[i] * v[i], then sum the four lanes
+	__m512i const Splat = _mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+	glm_f32vec16 const Mul = _mm512_mul_ps(m, _mm512_permutexvar_ps(Splat, _mm512_castps128_ps512(v)));
+	glm_f32vec16 const Add0 = _mm512_add_ps(Mul, _mm512_shuffle_f32x4(Mul, Mul, _MM_SHUFFLE(1, 0, 3, 2)));
+	glm_f32vec16 const Add1 = _mm512_add_ps(Add0, _mm512_shuffle_f32x4(Add0, Add0, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm512_castps512_ps128(Add1);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_transpose_x16(glm_f32vec16 m)
+{
+	return _mm512_permutexvar_ps(_mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15), m);
+}
+
+// Blockwise inversion as glm_dmat4_inverse, with the four 2x2 blocks side by
+// side in one register so every block operation is a single instruction.
+// Each 128-bit lane holds one block as (b00, b01, b10, b11).
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_inverse_x16(glm_f32vec16 m)
+{
+	// (A, B, C, D)
+	glm_f32vec16 const Blocks = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15), m);
+
+	// Determinant of each block, splat inside its lane
+	glm_f32vec16 const DetMul = _mm512_mul_ps(Blocks, _mm512_permute_ps(Blocks, _MM_SHUFFLE(0, 1, 2, 3)));
+	glm_f32vec16 const Det = _mm512_permute_ps(_mm512_sub_ps(DetMul, _mm512_permute_ps(DetMul, _MM_SHUFFLE(2, 3, 0, 1))), 0x00);
+
+	// (A#B, D#C, A#B, D#C) where X# is the adjugate of X
+	glm_f32vec16 const AD = _mm512_shuffle_f32x4(Blocks, Blocks, _MM_SHUFFLE(3, 0, 3, 0));
+	glm_f32vec16 const BC = _mm512_shuffle_f32x4(Blocks, Blocks, _MM_SHUFFLE(2, 1, 2, 1));
+	glm_f32vec16 const Adj = _mm512_sub_ps(
+		_mm512_mul_ps(_mm512_permute_ps(AD, _MM_SHUFFLE(0, 0, 3, 3)), BC),
+		_mm512_mul_ps(_mm512_permute_ps(AD, _MM_SHUFFLE(2, 2, 1, 1)), _mm512_permute_ps(BC, _MM_SHUFFLE(1, 0, 3, 2))));
+
+	// X = det(D) * A - B * D#C
+	// Y = det(B) * C - D * (A#B)#
+	// Z = det(C) * B - A * (D#C)#
+	// W = det(A) * D - C * A#B
+	glm_f32vec16 const Lhs = _mm512_shuffle_f32x4(Blocks, Blocks, _MM_SHUFFLE(2, 0, 3, 1));  // (B, D, A, C)
+	glm_f32vec16 const Rhs = _mm512_shuffle_f32x4(Adj, Adj, _MM_SHUFFLE(0, 1, 0, 1));        // (D#C, A#B, D#C, A#B)
+	// Lanes 0 and 3 multiply, lanes 1 and 2 multiply by the adjugate
+	__mmask16 const AdjLanes = 0x0FF0;
+	glm_f32vec16 const Rhs0 = _mm512_mask_permute_ps(_mm512_permute_ps(Rhs, _MM_SHUFFLE(3, 0, 3, 0)), AdjLanes, Rhs, _MM_SHUFFLE(0, 3, 0, 3));
+	glm_f32vec16 const Rhs1 = _mm512_mask_sub_ps(
+		_mm512_permute_ps(Rhs, _MM_SHUFFLE(1, 2, 1, 2)), AdjLanes, _mm512_setzero_ps(), _mm512_permute_ps(Rhs, _MM_SHUFFLE(1, 2, 1, 2)));
+	glm_f32vec16 const Prod = glm_vec16_fma(_mm512_permute_ps(Lhs, _MM_SHUFFLE(2, 3, 0, 1)), Rhs1, _mm512_mul_ps(Lhs, Rhs0));
+	glm_f32vec16 const Scaled = _mm512_mul_ps(
+		_mm512_shuffle_f32x4(Det, Det, _MM_SHUFFLE(0, 2, 1, 3)),        // (det(D), det(B), det(C), det(A))
+		_mm512_shuffle_f32x4(Blocks, Blocks, _MM_SHUFFLE(3, 1, 2, 0))); // (A, C, B, D)
+	glm_f32vec16 const XYZW = _mm512_sub_ps(Scaled, Prod);
+
+	// det(M) = det(A) * det(D) + det(B) * det(C) - trace(A#B * D#C)
+	__m128 const DetA = _mm512_castps512_ps128(Det);
+	__m128 const DetB = _mm512_extractf32x4_ps(Det, 1);
+	__m128 const DetC = _mm512_extractf32x4_ps(Det, 2);
+	__m128 const DetD = _mm512_extractf32x4_ps(Det, 3);
+	__m128 const AB = _mm512_castps512_ps128(Adj);
+	__m128 const DC = _mm512_extractf32x4_ps(Adj, 1);
+	__m128 const TraceMul = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+	__m128 const TraceAdd = _mm_add_ps(TraceMul, _mm_movehl_ps(TraceMul, TraceMul));
+	__m128 const Trace = _mm_add_ss(TraceAdd, _mm_shuffle_ps(TraceAdd, TraceAdd, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m128 const DetM = _mm_sub_ss(_mm_add_ss(_mm_mul_ss(DetA, DetD), _mm_mul_ss(DetB, DetC)), Trace);
+	glm_f32vec16 const RcpDetM = _mm512_div_ps(
+		_mm512_setr_ps(1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1),
+		_mm512_broadcastss_ps(DetM));
+
+	// Adjugate of each block, scattered back into columns
+	return _mm512_permutexvar_ps(
+		_mm512_setr_epi32(3, 1, 7, 5, 2, 0, 6, 4, 11, 9, 15, 13, 10, 8, 14, 12),
+		_mm512_mul_ps(XYZW, RcpDetM));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
 #if GLM_ARCH & GLM_ARCH_CLANG_BIT
 
 GLM_FUNC_QUALIFIER void glm_mat4_inverse(glm_f32vec4 const in[4], glm_f32vec4 out[4])
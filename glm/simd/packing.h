@@ -5,4 +5,90 @@
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// F16C has its own CPUID bit; MSVC does not report it but implies it with /arch:AVX2
+#if defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#	define GLM_SIMD_F16C GLM_ENABLE
+#else
+#	define GLM_SIMD_F16C GLM_DISABLE
+#endif
+
+// Four floats to binary16, rounded to nearest even, in the low 64 bits of the result.
+// Without F16C: sign/exponent rebias with the float adder doing the subnormal
+// rounding; NaN becomes the canonical quiet NaN 0x7E00 (sign kept).
+GLM_FUNC_QUALIFIER glm_i32vec4 glm_vec4_to_half(glm_f32vec4 v)
+{
+#	if GLM_SIMD_F16C == GLM_ENABLE
+		return _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+#	else
+		glm_f32vec4 const Sign = _mm_and_ps(v, _mm_set1_ps(-0.0f));
+		glm_f32vec4 const Abs = _mm_xor_ps(v, Sign);
+		glm_i32vec4 const AbsBits = _mm_castps_si128(Abs);
+
+		// 2^16 and up, infinities and NaN take the special path; NaN keeps the quiet bit
+		glm_i32vec4 const IsRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), AbsBits);
+		glm_i32vec4 const IsNan = _mm_castps_si128(_mm_cmpunord_ps(Abs, Abs));
+		glm_i32vec4 const InfOrNan = _mm_or_si128(_mm_and_si128(IsNan, _mm_set1_epi32(0x0200)), _mm_set1_epi32(0x7C00));
+
+		// Subnormal results: the ULP of 0.5f is the half subnormal ULP (2^-24), so
+		// adding 0.5f rounds to nearest even and its bits subtract back out
+		glm_i32vec4 const IsSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), AbsBits);
+		glm_i32vec4 const SubnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		glm_i32vec4 const Subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(SubnormalMagic))), SubnormalMagic);
+
+		// Normal results: rebias the exponent, add 0xFFF plus the odd bit to round to nearest even
+		glm_i32vec4 const Odd = _mm_srai_epi32(_mm_slli_epi32(AbsBits, 31 - 13), 31);
+		glm_i32vec4 const Rounded = _mm_sub_epi32(_mm_add_epi32(AbsBits, _mm_set1_epi32(0xFFF - ((127 - 15) << 23))), Odd);
+		glm_i32vec4 const Normal = _mm_srli_epi32(Rounded, 13);
+
+		glm_i32vec4 const Finite = _mm_or_si128(_mm_and_si128(IsSubnormal, Subnormal), _mm_andnot_si128(IsSubnormal, Normal));
+		glm_i32vec4 const Magnitude = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, InfOrNan));
+
+		// Sign extended to 32 bits so the signed saturating pack keeps every bit pattern
+		glm_i32vec4 const Half = _mm_or_si128(Magnitude, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+		return _mm_packs_epi32(Half, Half);
+#	endif
+}
+
+// Four binary16 values in the low 64 bits to floats; exact, subnormals included.
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_from_half(glm_i32vec4 h)
+{
+#	if GLM_SIMD_F16C == GLM_ENABLE
+		return _mm_cvtph_ps(h);
+#	else
+		glm_i32vec4 const Half = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+		glm_i32vec4 const ExpMant = _mm_and_si128(Half, _mm_set1_epi32(0x7FFF));
+		glm_i32vec4 const Sign = _mm_slli_epi32(_mm_xor_si128(Half, ExpMant), 16);
+
+		// Shifting into float position and scaling by 2^(127-15) rebiases the
+		// exponent and normalizes subnormals in a single exact multiply
+		glm_f32vec4 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+
+		// Infinity and NaN: force the float exponent to all ones
+		glm_i32vec4 const IsInfNan = _mm_cmpgt_epi32(ExpMant, _mm_set1_epi32(0x7BFF));
+		glm_f32vec4 const InfNanExp = _mm_and_ps(_mm_castsi128_ps(IsInfNan), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+
+		return _mm_or_ps(Scaled, _mm_or_ps(_mm_castsi128_ps(Sign), InfNanExp));
+#	endif
+}
+
+#if GLM_SIMD_F16C == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+// Eight floats to binary16, rounded to nearest even
+GLM_FUNC_QUALIFIER glm_i32vec4 glm_vec8_to_half(__m256 v)
+{
+	return _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT);
+}
+
+// Eight binary16 values to floats
+GLM_FUNC_QUALIFIER __m256 glm_vec8_from_half(glm_i32vec4 h)
+{
+	return _mm256_cvtph_ps(h);
+}
+#endif//GLM_SIMD_F16C == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+namespace glm{
+namespace detail
+{
+
+}//namespace detail
+}//namespace glm
@@ -78,6 +78,13 @@ int test_qualifier(const char* q)
 int main()
 {
 	std::printf("=== SIMD aligned exp/log/exp2/log2 regression ===\n");
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE && defined(__FMA__)
+	std::printf("path: SIMD (FMA)\n");
+#elif GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+	std::printf("path: SIMD (SSE4.1, unfused)\n");
+#else
+	std::printf("path: libm\n");
+#endif
 	int Error = 0;
 #if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 	Error += test_qualifier<glm::aligned_highp>("highp");
@@ -9,6 +9,7 @@
 #include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
 #include <glm/ext/vector_double4.hpp>
+#include <cmath>
 #include <limits>
 
 namespace length
@@ -188,6 +189,26 @@ namespace refract
 			Error += glm::all(glm::equal(C, glm::vec4(0.0, -1.0, 0.0f, 0.0f), 0.0001f)) ? 0 : 1;
 		}
 
+		// Oblique incidence and total internal reflection on both storage paths
+		{
+			glm::vec4 const I = glm::normalize(glm::vec4(0.3f, -0.8f, 0.2f, 0.5f));
+			glm::vec4 const N = glm::normalize(glm::vec4(-0.1f, 0.9f, 0.4f, -0.3f));
+			float const Eta = 0.75f;
+			float const d = glm::dot(N, I);
+			float const k = 1.0f - Eta * Eta * (1.0f - d * d);
+			glm::vec4 const Expected = Eta * I - (Eta * d + std::sqrt(k)) * N;
+
+			Error += glm::all(glm::equal(glm::refract(I, N, Eta), Expected, 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::refract(I, N, 4.0f), glm::vec4(0.0f), 0.0001f)) ? 0 : 1;
+#			if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+				typedef glm::vec<4, float, glm::aligned_highp> aligned_vec4;
+				aligned_vec4 const C(glm::refract(aligned_vec4(I), aligned_vec4(N), Eta));
+				Error += glm::all(glm::equal(glm::vec4(C), Expected, 0.0001f)) ? 0 : 1;
+				aligned_vec4 const D(glm::refract(aligned_vec4(I), aligned_vec4(N), 4.0f));
+				Error += glm::all(glm::equal(glm::vec4(D), glm::vec4(0.0f), 0.0001f)) ? 0 : 1;
+#			endif
+		}
+
 		return Error;
 	}
 }//namespace refract
@@ -0,0 +1,250 @@
+// Accuracy test for the double precision SIMD sin/cos/tan/exp/log/pow/atan2 path
+// (aligned dvec2/dvec3/dvec4 -> simd_transcendental_double.h). Every result must
+// be within 2 ULP of libm, including huge trig arguments (libm fallback lanes),
+// subnormals and special values.
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES 1
+#ifndef GLM_FORCE_AVX2       // the _avx2 variant covers the __m256d kernels
+#define GLM_FORCE_SSE42 1   // enable the SIMD path (fork requires an explicit GLM_FORCE_*)
+#endif
+
+#include <glm/glm.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/exponential.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+namespace {
+
+int const MaxAllowedUlp = 2;
+
+// ULP distance between a result and the reference; NaN only matches NaN and
+// infinities only match themselves.
+long long ulp(double Result, double Ref)
+{
+	long long const Max = std::numeric_limits<long long>::max();
+	if (std::isnan(Ref) || std::isnan(Result))
+		return std::isnan(Ref) && std::isnan(Result) ? 0 : Max;
+	if (std::isinf(Ref) || std::isinf(Result))
+		return Ref == Result ? 0 : Max;
+	if (std::signbit(Ref) != std::signbit(Result))
+		return Ref == 0.0 && Result == 0.0 ? 1 : Max; // +0 vs -0
+	return static_cast<long long>(glm::floatDistance(Result, Ref));
+}
+
+enum func { SIN, COS, TAN, EXP, LOG, POW, ATAN2 };
+char const* const Names[] = { "sin", "cos", "tan", "exp", "log", "pow", "atan2" };
+
+template<glm::length_t L>
+glm::vec<L, double, glm::aligned_highp> call(func F, glm::vec<L, double, glm::aligned_highp> const& a, glm::vec<L, double, glm::aligned_highp> const& b)
+{
+	switch (F)
+	{
+	case SIN: return glm::sin(a);
+	case COS: return glm::cos(a);
+	case TAN: return glm::tan(a);
+	case EXP: return glm::exp(a);
+	case LOG: return glm::log(a);
+	case POW: return glm::pow(a, b);
+	default: return glm::atan(a, b);
+	}
+}
+
+double ref(func F, double a, double b)
+{
+	switch (F)
+	{
+	case SIN: return std::sin(a);
+	case COS: return std::cos(a);
+	case TAN: return std::tan(a);
+	case EXP: return std::exp(a);
+	case LOG: return std::log(a);
+	case POW: return std::pow(a, b);
+	default: return std::atan2(a, b);
+	}
+}
+
+// Runs Count samples through dvec2, dvec3 and dvec4; Sample(i, a, b) fills the inputs
+template<typename genSample>
+int check(func F, char const* Range, genSample Sample, int Count)
+{
+	long long MaxUlp = 0;
+	double WorstA = 0.0, WorstB = 0.0;
+	auto Run = [&](auto Tag)
+	{
+		constexpr glm::length_t L = decltype(Tag)::value;
+		typedef glm::vec<L, double, glm::aligned_highp> vecType;
+		for (int i = 0; i < Count; i += L)
+		{
+			vecType A, B;
+			for (glm::length_t j = 0; j < L; ++j)
+				Sample(i + j, A[j], B[j]);
+			vecType const Out = call<L>(F, A, B);
+			for (glm::length_t j = 0; j < L; ++j)
+			{
+				long long const Dist = ulp(Out[j], ref(F, A[j], B[j]));
+				if (Dist > MaxUlp)
+				{
+					MaxUlp = Dist;
+					WorstA = A[j];
+					WorstB = B[j];
+				}
+			}
+		}
+	};
+	Run(std::integral_constant<glm::length_t, 2>());
+	Run(std::integral_constant<glm::length_t, 3>());
+	Run(std::integral_constant<glm::length_t, 4>());
+
+	if (MaxUlp > MaxAllowedUlp)
+	{
+		std::printf("  [FAIL] %-5s %-24s max %lld ulp at (%.17g, %.17g)\n", Names[F], Range, MaxUlp, WorstA, WorstB);
+		return 1;
+	}
+	std::printf("  [ ok ] %-5s %-24s max %lld ulp\n", Names[F], Range, MaxUlp);
+	return 0;
+}
+
+int check_uniform(func F, char const* Range, double Min, double Max)
+{
+	std::mt19937_64 Rng(20261017u);
+	std::uniform_real_distribution<double> Dist(Min, Max);
+	return check(F, Range, [&](int, double& a, double& b) { a = Dist(Rng); b = 1.0; }, 60000);
+}
+
+// Random bit patterns of positive finite doubles (covers every exponent incl. denormals)
+int check_bits(func F)
+{
+	std::mt19937_64 Rng(7u);
+	std::uniform_int_distribution<unsigned long long> Bits(1u, 0x7FEFFFFFFFFFFFFFull);
+	return check(F, "all positive doubles", [&](int, double& a, double& b) {
+		unsigned long long const Value = Bits(Rng);
+		std::memcpy(&a, &Value, sizeof(a));
+		b = 1.0;
+	}, 60000);
+}
+
+// Huge arguments: every exponent from 2^19 up to DBL_MAX, both signs
+int check_huge(func F)
+{
+	std::mt19937_64 Rng(11u);
+	std::uniform_real_distribution<double> Mantissa(1.0, 2.0);
+	return check(F, "|x| in [2^19, DBL_MAX]", [&](int i, double& a, double& b) {
+		a = std::ldexp(Mantissa(Rng), 19 + (i % 1005));
+		a = (i & 1) ? -a : a;
+		b = 1.0;
+	}, 12000);
+}
+
+double const Inf = std::numeric_limits<double>::infinity();
+double const NaN = std::numeric_limits<double>::quiet_NaN();
+
+int check_special(func F)
+{
+	double const Values[] = {
+		0.0, -0.0, Inf, -Inf, NaN, DBL_MIN, -DBL_MIN, DBL_TRUE_MIN, -DBL_TRUE_MIN, DBL_MAX, -DBL_MAX,
+		1.0, -1.0, 1e10, -1e10, 1e300, 524288.0, 524287.99, 709.78, 709.79, -708.4, -745.1, -745.2, 1.5707963267948966 };
+	int const Count = sizeof(Values) / sizeof(Values[0]);
+	return check(F, "special values", [&](int i, double& a, double& b) { a = Values[i % Count]; b = 1.0; }, Count * 12);
+}
+
+int test_trig()
+{
+	int Error = 0;
+	for (func F : { SIN, COS, TAN })
+	{
+		Error += check_uniform(F, "|x| < pi", -3.14159265358979, 3.14159265358979);
+		Error += check_uniform(F, "|x| < 100", -100.0, 100.0);
+		Error += check_uniform(F, "|x| < 5e5", -5e5, 5e5);
+		Error += check_huge(F);
+		Error += check_special(F);
+	}
+	return Error;
+}
+
+int test_exp_log()
+{
+	int Error = 0;
+
+	Error += check_uniform(EXP, "[-1, 1]", -1.0, 1.0);
+	Error += check_uniform(EXP, "[-745, 710]", -745.0, 710.0);
+	Error += check_special(EXP);
+
+	Error += check_uniform(LOG, "[0.5, 2]", 0.5, 2.0);
+	Error += check_uniform(LOG, "[1 - 1e-6, 1 + 1e-6]", 1.0 - 1e-6, 1.0 + 1e-6);
+	Error += check_bits(LOG);
+	Error += check_uniform(LOG, "negative", -1e3, -1e-3);
+	Error += check_special(LOG);
+
+	return Error;
+}
+
+int test_pow()
+{
+	int Error = 0;
+
+	std::mt19937_64 Rng(3u);
+	std::uniform_real_distribution<double> Base(0.0, 100.0), Exponent(-150.0, 150.0), Near1(0.999, 1.001), Big(-1e6, 1e6);
+	Error += check(POW, "x in [0, 100], |y| < 150", [&](int, double& a, double& b) { a = Base(Rng); b = Exponent(Rng); }, 60000);
+	Error += check(POW, "x ~ 1, |y| < 1e6", [&](int, double& a, double& b) { a = Near1(Rng); b = Big(Rng); }, 60000);
+
+	// Special cases follow std::pow: negative bases with integral exponents, zeros, infinities, NaN
+	double const X[] = { -2.0, -2.0, 0.0, -0.0, 0.0, Inf, 1.0, 2.0, NaN, 1.0, 2.0, DBL_TRUE_MIN };
+	double const Y[] = { 3.0, 2.0, 2.0, 3.0, -1.0, -1.0, Inf, -Inf, 0.0, NaN, 1024.0, 0.5 };
+	int const Count = sizeof(X) / sizeof(X[0]);
+	Error += check(POW, "special values", [&](int i, double& a, double& b) { a = X[i % Count]; b = Y[i % Count]; }, Count * 12);
+
+	return Error;
+}
+
+int test_atan2()
+{
+	int Error = 0;
+
+	std::mt19937_64 Rng(5u);
+	std::uniform_real_distribution<double> Unit(-1.0, 1.0), Wide(-1e8, 1e8);
+	Error += check(ATAN2, "[-1, 1]^2", [&](int, double& a, double& b) { a = Unit(Rng); b = Unit(Rng); }, 60000);
+	Error += check(ATAN2, "[-1e8, 1e8]^2", [&](int, double& a, double& b) { a = Wide(Rng); b = Wide(Rng); }, 60000);
+	Error += check(ATAN2, "|y| << |x|", [&](int, double& a, double& b) { a = Unit(Rng) * 1e-300; b = Wide(Rng); }, 60000);
+
+	double const Y[] = { 0.0, -0.0, 0.0, -0.0, 1.0, -1.0, Inf, -Inf, Inf, 1.0, NaN, 1.0, 1.0, -1.0, DBL_MAX };
+	double const X[] = { 0.0, 0.0, -0.0, -0.0, 0.0, -0.0, 1.0, -Inf, Inf, -Inf, 1.0, NaN, -1.0, -1.0, DBL_TRUE_MIN };
+	int const Count = sizeof(X) / sizeof(X[0]);
+	Error += check(ATAN2, "special values", [&](int i, double& a, double& b) { a = Y[i % Count]; b = X[i % Count]; }, Count * 12);
+
+	return Error;
+}
+
+} // namespace
+
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+int main()
+{
+	std::printf("=== SIMD aligned dvec transcendental ULP test ===\n");
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX2_BIT)
+	std::printf("path: SIMD (__m256d)\n");
+#elif GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+	std::printf("path: SIMD (__m128d)\n");
+#else
+	std::printf("path: libm\n");
+#endif
+	int Error = 0;
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_trig();
+	Error += test_exp_log();
+	Error += test_pow();
+	Error += test_atan2();
+	std::printf(Error == 0 ? "ALL PASSED\n" : "FAILED (%d)\n", Error);
+#else
+	std::printf("SKIPPED (aligned gentypes not enabled)\n");
+#endif
+	return Error;
+}
@@ -0,0 +1,238 @@
+// Accuracy test for the highp SIMD sin/cos/tan/exp/exp2/log/log2/pow path
+// (aligned_highp vec4 -> simd_transcendental_highp.h). Every result must be
+// within 1 ULP of double-precision libm rounded to float, including huge trig
+// arguments (Payne-Hanek fallback) and special values.
+#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES 1
+#define GLM_FORCE_SSE42 1   // enable the SIMD path (fork requires an explicit GLM_FORCE_*)
+
+#include <glm/glm.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/exponential.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+namespace {
+
+typedef glm::vec<4, float, glm::aligned_highp> vec4h;
+
+// ULP distance between a result and the correctly signed reference; NaN only
+// matches NaN and infinities only match themselves.
+int ulp(float Result, float Ref)
+{
+	if (std::isnan(Ref) || std::isnan(Result))
+		return std::isnan(Ref) && std::isnan(Result) ? 0 : std::numeric_limits<int>::max();
+	if (std::isinf(Ref) || std::isinf(Result))
+		return Ref == Result ? 0 : std::numeric_limits<int>::max();
+	if (std::signbit(Ref) != std::signbit(Result))
+		return Ref == 0.0f && Result == 0.0f ? 1 : std::numeric_limits<int>::max(); // +0 vs -0
+	return glm::floatDistance(Result, Ref);
+}
+
+struct unary
+{
+	const char* Name;
+	vec4h (*Glm)(vec4h const&);
+	double (*Ref)(double);
+};
+
+vec4h glm_sin(vec4h const& v) { return glm::sin(v); }
+vec4h glm_cos(vec4h const& v) { return glm::cos(v); }
+vec4h glm_tan(vec4h const& v) { return glm::tan(v); }
+vec4h glm_exp(vec4h const& v) { return glm::exp(v); }
+vec4h glm_exp2(vec4h const& v) { return glm::exp2(v); }
+vec4h glm_log(vec4h const& v) { return glm::log(v); }
+vec4h glm_log2(vec4h const& v) { return glm::log2(v); }
+double ref_sin(double x) { return std::sin(x); }
+double ref_cos(double x) { return std::cos(x); }
+double ref_tan(double x) { return std::tan(x); }
+double ref_exp(double x) { return std::exp(x); }
+double ref_exp2(double x) { return std::exp2(x); }
+double ref_log(double x) { return std::log(x); }
+double ref_log2(double x) { return std::log2(x); }
+
+template<typename genSample>
+int check(unary const& F, const char* Range, genSample Sample, int Count)
+{
+	int MaxUlp = 0;
+	float Worst = 0.0f;
+	for (int i = 0; i < Count; ++i)
+	{
+		float In[4];
+		for (int j = 0; j < 4; ++j)
+			In[j] = Sample(i * 4 + j);
+		vec4h const Out = F.Glm(vec4h(In[0], In[1], In[2], In[3]));
+		for (int j = 0; j < 4; ++j)
+		{
+			int const Dist = ulp(Out[j], static_cast<float>(F.Ref(static_cast<double>(In[j]))));
+			if (Dist > MaxUlp)
+			{
+				MaxUlp = Dist;
+				Worst = In[j];
+			}
+		}
+	}
+
+	if (MaxUlp > 1)
+	{
+		std::printf("  [FAIL] %-4s %-22s max %d ulp at x=%.9g\n", F.Name, Range, MaxUlp, static_cast<double>(Worst));
+		return 1;
+	}
+	std::printf("  [ ok ] %-4s %-22s max %d ulp\n", F.Name, Range, MaxUlp);
+	return 0;
+}
+
+template<typename genDist>
+int check_uniform(unary const& F, const char* Range, genDist Dist)
+{
+	std::mt19937 Rng(20261017u);
+	return check(F, Range, [&](int) { return static_cast<float>(Dist(Rng)); }, 50000);
+}
+
+// Random bit patterns of positive finite floats (covers every exponent incl. denormals)
+int check_bits(unary const& F)
+{
+	std::mt19937 Rng(7u);
+	std::uniform_int_distribution<unsigned> Bits(1u, 0x7F7FFFFFu);
+	return check(F, "all positive floats", [&](int) {
+		unsigned const b = Bits(Rng);
+		float x;
+		std::memcpy(&x, &b, sizeof(x));
+		return x;
+	}, 50000);
+}
+
+// Huge arguments: every exponent from 2^20 up to FLT_MAX, both signs
+int check_huge(unary const& F)
+{
+	std::mt19937 Rng(11u);
+	std::uniform_real_distribution<float> Mantissa(1.0f, 2.0f);
+	return check(F, "|x| in [2^20, FLT_MAX]", [&](int i) {
+		float const x = std::ldexp(Mantissa(Rng), 20 + (i % 108));
+		return (i & 1) ? -x : x;
+	}, 50000);
+}
+
+int check_special(unary const& F)
+{
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	float const Values[] = {
+		0.0f, -0.0f, Inf, -Inf, NaN, FLT_MIN, -FLT_MIN, FLT_TRUE_MIN, -FLT_TRUE_MIN, FLT_MAX, -FLT_MAX,
+		1.0f, -1.0f, 1e10f, -1e10f, 1e30f, 1048576.0f, 1048575.9f, 88.72f, -103.9f, 128.0f, -150.0f };
+	int const Count = sizeof(Values) / sizeof(Values[0]);
+	return check(F, "special values", [&](int i) { return Values[i % Count]; }, Count);
+}
+
+int test_trig()
+{
+	unary const Fs[] = { {"sin", glm_sin, ref_sin}, {"cos", glm_cos, ref_cos}, {"tan", glm_tan, ref_tan} };
+	int Error = 0;
+	for (unary const& F : Fs)
+	{
+		Error += check_uniform(F, "|x| < pi", std::uniform_real_distribution<double>(-3.14159265, 3.14159265));
+		Error += check_uniform(F, "|x| < 100", std::uniform_real_distribution<double>(-100.0, 100.0));
+		Error += check_uniform(F, "|x| < 1e4", std::uniform_real_distribution<double>(-1e4, 1e4));
+		Error += check_uniform(F, "|x| < 4e6", std::uniform_real_distribution<double>(-4e6, 4e6));
+		Error += check_huge(F);
+		Error += check_special(F);
+	}
+	return Error;
+}
+
+int test_exp_log()
+{
+	int Error = 0;
+
+	unary const Exp = {"exp", glm_exp, ref_exp};
+	Error += check_uniform(Exp, "[-1, 1]", std::uniform_real_distribution<double>(-1.0, 1.0));
+	Error += check_uniform(Exp, "[-104, 89]", std::uniform_real_distribution<double>(-104.0, 89.0));
+	Error += check_special(Exp);
+
+	unary const Exp2 = {"exp2", glm_exp2, ref_exp2};
+	Error += check_uniform(Exp2, "[-1, 1]", std::uniform_real_distribution<double>(-1.0, 1.0));
+	Error += check_uniform(Exp2, "[-150, 128]", std::uniform_real_distribution<double>(-150.0, 128.0));
+	Error += check_special(Exp2);
+
+	unary const Logs[] = { {"log", glm_log, ref_log}, {"log2", glm_log2, ref_log2} };
+	for (unary const& F : Logs)
+	{
+		Error += check_uniform(F, "[0.5, 2]", std::uniform_real_distribution<double>(0.5, 2.0));
+		Error += check_bits(F);
+		Error += check_uniform(F, "negative", std::uniform_real_distribution<double>(-1e3, -1e-3));
+		Error += check_special(F);
+	}
+
+	return Error;
+}
+
+int test_pow()
+{
+	int Error = 0;
+	std::mt19937 Rng(3u);
+	std::uniform_real_distribution<float> Base(0.0f, 100.0f), Exponent(-25.0f, 25.0f);
+
+	int MaxUlp = 0;
+	for (int i = 0; i < 50000; ++i)
+	{
+		vec4h const x(Base(Rng), Base(Rng), Base(Rng), Base(Rng));
+		vec4h const y(Exponent(Rng), Exponent(Rng), Exponent(Rng), Exponent(Rng));
+		vec4h const Out = glm::pow(x, y);
+		for (int j = 0; j < 4; ++j)
+			MaxUlp = std::max(MaxUlp, ulp(Out[j], static_cast<float>(std::pow(static_cast<double>(x[j]), static_cast<double>(y[j])))));
+	}
+
+	// Special cases follow std::pow: negative bases with integral exponents, zeros, infinities
+	float const Inf = std::numeric_limits<float>::infinity();
+	float const X[] = { -2.0f, -2.0f, 0.0f, -0.0f, 0.0f, Inf, 1.0f, 2.0f };
+	float const Y[] = { 3.0f, 2.0f, 2.0f, 3.0f, -1.0f, -1.0f, Inf, -Inf };
+	for (int i = 0; i < 8; i += 4)
+	{
+		vec4h const Out = glm::pow(vec4h(X[i], X[i + 1], X[i + 2], X[i + 3]), vec4h(Y[i], Y[i + 1], Y[i + 2], Y[i + 3]));
+		for (int j = 0; j < 4; ++j)
+			MaxUlp = std::max(MaxUlp, ulp(Out[j], std::pow(X[i + j], Y[i + j])));
+	}
+
+	if (MaxUlp > 1)
+	{
+		std::printf("  [FAIL] pow  max %d ulp\n", MaxUlp);
+		++Error;
+	}
+	else
+	{
+		std::printf("  [ ok ] pow  max %d ulp\n", MaxUlp);
+	}
+	return Error;
+}
+
+} // namespace
+
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+int main()
+{
+	std::printf("=== SIMD aligned_highp transcendental ULP test ===\n");
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE && defined(__FMA__)
+	std::printf("path: SIMD (FMA)\n");
+#elif GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+	std::printf("path: SIMD (SSE4.1, unfused)\n");
+#else
+	std::printf("path: libm\n");
+#endif
+	int Error = 0;
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_trig();
+	Error += test_exp_log();
+	Error += test_pow();
+	std::printf(Error == 0 ? "ALL PASSED\n" : "FAILED (%d)\n", Error);
+#else
+	std::printf("SKIPPED (aligned gentypes not enabled)\n");
+#endif
+	return Error;
+}
@@ -111,6 +111,13 @@ int test_qualifier(const char* qname)
 int main()
 {
 	std::printf("=== SIMD aligned sin/cos/tan regression ===\n");
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE && defined(__FMA__)
+	std::printf("path: SIMD (FMA)\n");
+#elif GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+	std::printf("path: SIMD (SSE4.1, unfused)\n");
+#else
+	std::printf("path: libm\n");
+#endif
 	int Error = 0;
 #if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 	Error += test_qualifier<glm::aligned_highp>("aligned_highp");
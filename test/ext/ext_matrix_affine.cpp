@@ -0,0 +1,171 @@
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/quaternion.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cstddef>
+#include <random>
+
+static_assert(sizeof(glm::affine) == 48);
+static_assert(sizeof(glm::daffine) == 96);
+static_assert(std::is_trivially_copyable<glm::affine>::value);
+
+static glm::vec3 next_vec3(std::mt19937& Rng)
+{
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	return glm::vec3(Unit(Rng), Unit(Rng), Unit(Rng));
+}
+
+static glm::quat next_rotation(std::mt19937& Rng)
+{
+	std::uniform_real_distribution<float> Angle(-3.0f, 3.0f);
+	return glm::angleAxis(Angle(Rng), glm::normalize(next_vec3(Rng) + glm::vec3(0.f, 0.f, 1e-2f)));
+}
+
+// Rotation, non-uniform scale and shear, and translation
+static glm::mat4 next_mat4(std::mt19937& Rng)
+{
+	glm::mat4 m = glm::mat4_cast(next_rotation(Rng));
+	m = glm::scale(m, glm::vec3(1.5f) + next_vec3(Rng));
+	m[1] += glm::vec4(next_vec3(Rng) * 0.25f, 0.f);
+	m[3] = glm::vec4(next_vec3(Rng) * 10.f, 1.f);
+	return m;
+}
+
+static int test_conversions()
+{
+	int Error = 0;
+
+	std::mt19937 Rng(1);
+	for(int i = 0; i < 16; ++i)
+	{
+		glm::mat4 const m = next_mat4(Rng);
+		glm::affine const a(m);
+		Error += glm::mat4_cast(a) == m ? 0 : 1;
+		Error += glm::affine(glm::mat3(m), glm::vec3(m[3])) == a ? 0 : 1;
+		Error += glm::affine(glm::mat4x3(m)) == a ? 0 : 1;
+		// Widened to vec4: aligned vec3 comparisons would include the padding lane
+		Error += glm::mat4(glm::mat3_cast(a)) == glm::mat4(glm::mat3(m)) ? 0 : 1;
+		Error += glm::vec4(glm::translation(a), 0.f) == glm::vec4(glm::vec3(m[3]), 0.f) ? 0 : 1;
+		Error += glm::daffine(a) == glm::daffine(glm::dmat4(m)) ? 0 : 1;
+	}
+
+	Error += glm::mat4_cast(glm::affine(1.0f)) == glm::mat4(1.0f) ? 0 : 1;
+	Error += glm::mat4_cast(glm::affine(2.0f)) == glm::scale(glm::mat4(1.0f), glm::vec3(2.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename affine_type, typename mat4_type>
+static int test_operations(affine_type const& a, affine_type const& b, mat4_type const& ma, mat4_type const& mb)
+{
+	typedef typename affine_type::value_type T;
+	typedef typename mat4_type::col_type vec4_type;
+	typedef glm::vec<3, T, glm::defaultp> vec3_type;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-4);
+	Error += glm::all(glm::equal(glm::mat4_cast(a * b), ma * mb, Epsilon)) ? 0 : 1;
+
+	vec4_type const Point(1.f, -2.f, 3.f, 1.f);
+	vec4_type const Direction(-0.5f, 0.25f, 2.f, 0.f);
+	Error += glm::all(glm::equal(a * Point, ma * Point, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(a * Direction, ma * Direction, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::transformPoint(a, vec3_type(Point)), vec3_type(ma * Point), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::transformDirection(a, vec3_type(Direction)), vec3_type(ma * Direction), Epsilon)) ? 0 : 1;
+
+	Error += glm::all(glm::equal(glm::mat4_cast(glm::inverse(a)), glm::inverse(ma), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(a * glm::inverse(a)), mat4_type(1), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_float()
+{
+	int Error = 0;
+
+	std::mt19937 Rng(2);
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::mat4 const ma = next_mat4(Rng);
+		glm::mat4 const mb = next_mat4(Rng);
+		Error += test_operations(glm::affine(ma), glm::affine(mb), ma, mb);
+		Error += test_operations(glm::daffine(glm::dmat4(ma)), glm::daffine(glm::dmat4(mb)), glm::dmat4(ma), glm::dmat4(mb));
+	}
+
+	return Error;
+}
+
+static int test_rigid()
+{
+	int Error = 0;
+
+	// Translations up to 10 * sqrt(3)
+	float const Epsilon = 1e-4f;
+	std::mt19937 Rng(3);
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::affine const a(glm::mat3_cast(next_rotation(Rng)), next_vec3(Rng) * 10.f);
+		glm::affine const r = glm::rigidInverse(a);
+		Error += glm::all(glm::equal(glm::mat4_cast(r), glm::mat4_cast(glm::inverse(a)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(r), glm::affineInverse(glm::mat4_cast(a)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(r * a), glm::mat4(1.0f), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// Copied element by element, the aligned and packed matrices need not share a layout
+static glm::mat4 to_packed(glm::aligned_mat4 const& m)
+{
+	glm::mat4 Result;
+	for(glm::length_t c = 0; c < 4; ++c)
+	for(glm::length_t r = 0; r < 4; ++r)
+		Result[c][r] = m[c][r];
+	return Result;
+}
+
+static int test_aligned()
+{
+	typedef glm::taffine<float, glm::aligned_highp> aligned_affine;
+
+	int Error = 0;
+
+	std::mt19937 Rng(4);
+	for(int i = 0; i < 64; ++i)
+	{
+		glm::mat4 const ma = next_mat4(Rng);
+		glm::mat4 const mb = next_mat4(Rng);
+		aligned_affine const a{glm::affine(ma)}, b{glm::affine(mb)};
+		Error += glm::affine(a * b) == glm::affine(ma) * glm::affine(mb) ? 0 : 1;
+		Error += glm::affine(glm::inverse(a)) == glm::inverse(glm::affine(ma)) ? 0 : 1;
+
+		glm::aligned_mat4 am;
+		for(glm::length_t c = 0; c < 4; ++c)
+			am[c] = glm::aligned_vec4(ma[c].x, ma[c].y, ma[c].z, ma[c].w);
+		Error += glm::all(glm::equal(to_packed(glm::affineInverse(am)), glm::affineInverse(ma), 1e-4f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_conversions();
+	Error += test_float();
+	Error += test_rigid();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_aligned();
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,120 @@
+#include <glm/ext/matrix_transform_batch.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <vector>
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> make_transform()
+{
+	glm::mat<4, 4, T, glm::defaultp> const M =
+		glm::translate(glm::mat<4, 4, T, glm::defaultp>(1), glm::vec<3, T, glm::defaultp>(1, -2, 3)) *
+		glm::rotate(glm::mat<4, 4, T, glm::defaultp>(1), static_cast<T>(0.7), glm::vec<3, T, glm::defaultp>(0.3, 0.5, -0.8)) *
+		glm::scale(glm::mat<4, 4, T, glm::defaultp>(1), glm::vec<3, T, glm::defaultp>(2, 0.5, 1.5));
+	glm::mat<4, 4, T, Q> Result(M);
+	Result[0][3] = static_cast<T>(0.25); // Non-affine row so w matters for vec4
+	return Result;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_transform_vec4()
+{
+	int Error = 0;
+
+	glm::mat<4, 4, T, Q> const M = make_transform<T, Q>();
+
+	// Cover empty input and every SIMD tail length
+	for(std::size_t Count = 0; Count < 37; ++Count)
+	{
+		std::vector<glm::vec<4, T, Q> > In(Count), Out(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec<4, T, Q>(static_cast<T>(i), static_cast<T>(i) * T(-0.5), T(3) - static_cast<T>(i), static_cast<T>(i % 3));
+
+		glm::batch::transform(M, In.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], M * In[i], static_cast<T>(0.0001))) ? 0 : 1;
+
+		// In-place
+		std::vector<glm::vec<4, T, Q> > InOut(In);
+		glm::batch::transform(M, InOut.data(), InOut.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(InOut[i], M * In[i], static_cast<T>(0.0001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_transform_vec3()
+{
+	int Error = 0;
+
+	glm::mat<4, 4, T, Q> const M = make_transform<T, Q>();
+
+	for(std::size_t Count = 0; Count < 37; ++Count)
+	{
+		std::vector<glm::vec<3, T, Q> > In(Count), Points(Count), Directions(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec<3, T, Q>(static_cast<T>(i) * T(0.25), T(1) - static_cast<T>(i), static_cast<T>(i * i) * T(0.1));
+
+		glm::batch::transformPoints(M, In.data(), Points.data(), Count);
+		glm::batch::transformDirections(M, In.data(), Directions.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec<3, T, Q> const P(M * glm::vec<4, T, Q>(In[i], 1));
+			glm::vec<3, T, Q> const D(M * glm::vec<4, T, Q>(In[i], 0));
+			Error += glm::all(glm::equal(Points[i], P, static_cast<T>(0.0001))) ? 0 : 1;
+			Error += glm::all(glm::equal(Directions[i], D, static_cast<T>(0.0001))) ? 0 : 1;
+		}
+
+		std::vector<glm::vec<3, T, Q> > InOut(In);
+		glm::batch::transformPoints(M, InOut.data(), InOut.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(InOut[i], Points[i], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_transform<float, glm::defaultp>();
+	std::vector<glm::vec4> In(11, glm::vec4(1, 2, 3, 1)), Out(11);
+	glm::batch::transform(M, In, Out);
+	for(std::size_t i = 0; i < Out.size(); ++i)
+		Error += glm::all(glm::equal(Out[i], M * In[i], 0.0001f)) ? 0 : 1;
+
+	std::vector<glm::vec3> P(9, glm::vec3(1, 2, 3)), Q(9);
+	glm::batch::transformPoints(M, P, Q);
+	for(std::size_t i = 0; i < Q.size(); ++i)
+		Error += glm::all(glm::equal(Q[i], glm::vec3(M * glm::vec4(P[i], 1)), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transform_vec4<float, glm::defaultp>();
+	Error += test_transform_vec4<double, glm::defaultp>();
+	Error += test_transform_vec3<float, glm::defaultp>();
+	Error += test_transform_vec3<double, glm::defaultp>();
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_transform_vec4<float, glm::aligned_highp>();
+	Error += test_transform_vec3<float, glm::aligned_highp>();
+	Error += test_transform_vec4<double, glm::aligned_highp>();
+#	endif
+
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
@@ -155,6 +155,66 @@ static int test_mix()
     return Error;
 }
 
+static int test_nlerp()
+{
+    int Error = 0;
+
+    glm::quat const Q1 = glm::angleAxis(glm::radians(0.0f), glm::vec3(0, 0, 1));
+    glm::quat const Q2 = glm::angleAxis(glm::radians(90.0f), glm::vec3(0, 0, 1));
+
+    // Halfway the chord and the arc meet, elsewhere nlerp runs ahead of slerp
+    {
+        float const Angle = glm::degrees(glm::angle(glm::nlerp(Q1, Q2, 0.5f)));
+        if (!glm::equal(Angle, 45.0f, 0.001f)) {
+            std::cout << "Error: nlerp(Q1, Q2, 0.5) angle should be 45 degrees, got " << Angle << std::endl;
+            Error++;
+        }
+
+        glm::quat const Q3 = glm::nlerp(Q1, Q2, 0.25f);
+        if (!glm::equal(glm::length(Q3), 1.0f, 0.00001f) || glm::degrees(glm::angle(Q3)) >= 22.5f) {
+            std::cout << "Error: nlerp(Q1, Q2, 0.25) should be normalized and ahead of slerp" << std::endl;
+            print_quat("Result", Q3);
+            Error++;
+        }
+    }
+
+    // Short path: -Q2 is the same rotation
+    {
+        float const Angle = glm::degrees(glm::angle(glm::nlerp(Q1, -Q2, 0.5f)));
+        if (!glm::equal(Angle, 45.0f, 0.001f)) {
+            std::cout << "Error: nlerp(Q1, -Q2, 0.5) angle should be 45 degrees, got " << Angle << std::endl;
+            Error++;
+        }
+    }
+
+    return Error;
+}
+
+static int test_fastSlerp()
+{
+    int Error = 0;
+
+    glm::quat const Q1 = glm::angleAxis(glm::radians(0.0f), glm::vec3(0, 0, 1));
+    glm::vec3 const Axis = glm::normalize(glm::vec3(1, 2, 3));
+
+    // Within 1e-3 radians of slerp, also on the long path
+    for (int Degrees = 10; Degrees <= 350; Degrees += 20) {
+        glm::quat const Q2 = glm::angleAxis(glm::radians(static_cast<float>(Degrees)), Axis);
+        for (int i = 0; i <= 8; ++i) {
+            float const a = static_cast<float>(i) / 8.0f;
+            glm::quat const Slerp = glm::slerp(Q1, Q2, a);
+            glm::quat const Fast = glm::fastSlerp(Q1, Q2, a);
+            float const Diff = glm::angle(glm::inverse(Slerp) * Fast);
+            if (!(glm::min(Diff, 2.0f * glm::pi<float>() - Diff) < 0.001f) || !glm::equal(glm::length(Fast), 1.0f, 0.00001f)) {
+                std::cout << "Error: fastSlerp at " << Degrees << " degrees, a = " << a << " is " << Diff << " radians from slerp" << std::endl;
+                Error++;
+            }
+        }
+    }
+
+    return Error;
+}
+
 int main()
 {
     int Error = 0;
@@ -174,6 +234,10 @@ int main()
     std::cout << "\nTesting mix/slerp functions:" << std::endl;
     Error += test_mix();
 
+    std::cout << "\nTesting nlerp/fastSlerp functions:" << std::endl;
+    Error += test_nlerp();
+    Error += test_fastSlerp();
+
     if (Error == 0)
         std::cout << "\nAll tests passed!" << std::endl;
     else
@@ -0,0 +1,194 @@
+#include <glm/ext/quaternion_common_batch.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_double.hpp>
+#include <glm/ext/quaternion_geometric.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Random unit quaternions, with near-equal and opposite pairs mixed in
+// through the second array
+static std::vector<glm::quat> make_quats(std::size_t Count, glm::uint32 Seed)
+{
+	std::mt19937 Rng(Seed);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	std::vector<glm::quat> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec4 v(0.0f);
+		while(glm::dot(v, v) < 1e-3f)
+			v = glm::vec4(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng));
+		v = glm::normalize(v);
+		Result[i] = glm::quat::wxyz(v.w, v.x, v.y, v.z);
+	}
+	return Result;
+}
+
+static std::vector<glm::quat> make_targets(std::vector<glm::quat> const& From, glm::uint32 Seed)
+{
+	std::vector<glm::quat> Result = make_quats(From.size(), Seed);
+	for(std::size_t i = 0; i < From.size(); i += 7)
+		Result[i] = From[i];
+	for(std::size_t i = 3; i < From.size(); i += 7)
+		Result[i] = -From[i];
+	for(std::size_t i = 5; i < From.size(); i += 7)
+		Result[i] = glm::normalize(From[i] + glm::quat::wxyz(0.0f, 1e-4f, 0.0f, 0.0f));
+	return Result;
+}
+
+static std::vector<float> make_factors(std::size_t Count, glm::uint32 Seed)
+{
+	std::mt19937 Rng(Seed);
+	std::uniform_real_distribution<float> Factor(0.0f, 1.0f);
+	std::vector<float> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = Factor(Rng);
+	Result[0] = 0.0f;
+	Result[1] = 1.0f;
+	return Result;
+}
+
+static float max_difference(glm::quat const& a, glm::quat const& b)
+{
+	return std::max(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)), std::max(std::abs(a.z - b.z), std::abs(a.w - b.w)));
+}
+
+typedef void (*batch_array)(glm::quat const*, glm::quat const*, float const*, glm::quat*, std::size_t);
+typedef void (*batch_uniform)(glm::quat const*, glm::quat const*, float, glm::quat*, std::size_t);
+typedef glm::quat (*element_func)(glm::quat const&, glm::quat const&, float);
+
+// Batch against per-element results, with one factor per element and one for
+// the whole array, then in place
+static int test_blend(batch_array Array, batch_uniform Uniform, element_func Element, float Epsilon)
+{
+	int Error = 0;
+
+	// Odd count so both the wide loop and the padded remainder are exercised
+	std::size_t const Count = 4099;
+	std::vector<glm::quat> const x = make_quats(Count, 1);
+	std::vector<glm::quat> const y = make_targets(x, 2);
+	std::vector<float> const a = make_factors(Count, 3);
+
+	std::vector<glm::quat> Out(Count);
+	Array(x.data(), y.data(), a.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += max_difference(Out[i], Element(x[i], y[i], a[i])) <= Epsilon ? 0 : 1;
+
+	Uniform(x.data(), y.data(), 0.3f, Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += max_difference(Out[i], Element(x[i], y[i], 0.3f)) <= Epsilon ? 0 : 1;
+
+	std::vector<glm::quat> InPlace(x);
+	Array(InPlace.data(), y.data(), a.data(), InPlace.data(), Count);
+	Array(x.data(), y.data(), a.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += InPlace[i] == Out[i] ? 0 : 1;
+
+	// Fewer elements than one block
+	Array(x.data(), y.data(), a.data(), Out.data(), 3);
+	for(std::size_t i = 0; i < 3; ++i)
+		Error += max_difference(Out[i], Element(x[i], y[i], a[i])) <= Epsilon ? 0 : 1;
+
+	return Error;
+}
+
+static glm::quat element_slerp(glm::quat const& x, glm::quat const& y, float a) { return glm::slerp(x, y, a); }
+static glm::quat element_nlerp(glm::quat const& x, glm::quat const& y, float a) { return glm::nlerp(x, y, a); }
+static glm::quat element_fast_slerp(glm::quat const& x, glm::quat const& y, float a) { return glm::fastSlerp(x, y, a); }
+
+static int test_slerp_accuracy()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1027;
+	std::vector<glm::quat> const x = make_quats(Count, 4);
+	std::vector<glm::quat> const y = make_targets(x, 5);
+	std::vector<float> const a = make_factors(Count, 6);
+
+	std::vector<glm::quat> Out(Count);
+	glm::batch::slerp(x.data(), y.data(), a.data(), Out.data(), Count);
+
+	double Max = 0.0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::dquat const Expected = glm::slerp(glm::dquat(x[i]), glm::dquat(y[i]), static_cast<double>(a[i]));
+		for(glm::length_t c = 0; c < 4; ++c)
+			Max = std::max(Max, std::abs(static_cast<double>(Out[i][c]) - Expected[c]));
+	}
+	Error += Max < 6e-6 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_squad()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1031;
+	std::vector<glm::quat> const q1 = make_quats(Count, 7);
+	std::vector<glm::quat> const q2 = make_targets(q1, 8);
+	std::vector<glm::quat> const s1 = make_quats(Count, 9);
+	std::vector<glm::quat> const s2 = make_quats(Count, 10);
+	std::vector<float> const h = make_factors(Count, 11);
+
+	std::vector<glm::quat> Out(Count);
+	glm::batch::squad(q1.data(), q2.data(), s1.data(), s2.data(), h.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		// squad of GLM_GTX_quaternion; mix is oriented, so opposite pairs
+		// are ill-conditioned and skipped
+		if(glm::dot(q1[i], q2[i]) < -0.99f)
+			continue;
+		glm::quat const m1 = glm::mix(q1[i], q2[i], h[i]);
+		glm::quat const m2 = glm::mix(s1[i], s2[i], h[i]);
+		if(std::abs(glm::dot(m1, m2)) > 0.99f)
+			continue;
+		// The outer blend amplifies the kernel error by 1 / sin of its angle
+		float const Epsilon = 2e-5f / std::sqrt(1.0f - glm::dot(m1, m2) * glm::dot(m1, m2));
+		glm::quat const Expected = glm::mix(m1, m2, 2.0f * (1.0f - h[i]) * h[i]);
+		Error += max_difference(Out[i], Expected) <= Epsilon ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const x = make_quats(9, 12);
+	std::vector<glm::quat> const y = make_quats(9, 13);
+	std::vector<float> const a = make_factors(9, 14);
+	std::vector<glm::quat> Out(9);
+	std::vector<glm::quat> Expected(9);
+
+	glm::batch::nlerp(std::span<glm::quat const>(x), std::span<glm::quat const>(y), std::span<float const>(a), std::span<glm::quat>(Out));
+	glm::batch::nlerp(x.data(), y.data(), a.data(), Expected.data(), 9);
+	for(std::size_t i = 0; i < 9; ++i)
+		Error += Out[i] == Expected[i] ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	// slerp goes through the mediump sin kernel, accurate to about 4e-6
+	Error += test_blend(glm::batch::slerp, glm::batch::slerp, element_slerp, 5e-6f);
+	Error += test_blend(glm::batch::nlerp, glm::batch::nlerp, element_nlerp, 1e-6f);
+	Error += test_blend(glm::batch::fastSlerp, glm::batch::fastSlerp, element_fast_slerp, 1e-6f);
+	Error += test_slerp_accuracy();
+	Error += test_squad();
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,171 @@
+#include <glm/ext/scalar_transcendental_batch.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/exponential.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+typedef void (*batch_func)(float const*, float*, std::size_t);
+typedef double (*ref_func)(double);
+
+// Max error over an array, relative when |ref| > 1 and absolute otherwise
+static double max_error(batch_func Func, ref_func Ref, std::vector<float> const& In)
+{
+	std::vector<float> Out(In.size());
+	Func(In.data(), Out.data(), In.size());
+
+	double Max = 0.0;
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		double const Expected = Ref(static_cast<double>(In[i]));
+		double const Error = std::abs(static_cast<double>(Out[i]) - Expected) / std::max(1.0, std::abs(Expected));
+		Max = std::max(Max, Error);
+	}
+	return Max;
+}
+
+static std::vector<float> make_range(float Min, float Max, std::size_t Count)
+{
+	std::vector<float> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Count - 1);
+	return Result;
+}
+
+static double ref_sin(double x) { return std::sin(x); }
+static double ref_cos(double x) { return std::cos(x); }
+static double ref_asin(double x) { return std::asin(x); }
+static double ref_acos(double x) { return std::acos(x); }
+static double ref_atan(double x) { return std::atan(x); }
+static double ref_exp(double x) { return std::exp(x); }
+static double ref_log(double x) { return std::log(x); }
+
+static int test_accuracy()
+{
+	int Error = 0;
+
+	// Odd count so both the wide loop and the padded remainder are exercised
+	std::size_t const Count = 4099;
+
+	Error += max_error(glm::batch::sin, ref_sin, make_range(-100.f, 100.f, Count)) < 4e-6 ? 0 : 1;
+	Error += max_error(glm::batch::cos, ref_cos, make_range(-100.f, 100.f, Count)) < 4e-6 ? 0 : 1;
+	Error += max_error(glm::batch::asin, ref_asin, make_range(-1.f, 1.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::batch::acos, ref_acos, make_range(-1.f, 1.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::batch::atan, ref_atan, make_range(-50.f, 50.f, Count)) < 2e-6 ? 0 : 1;
+	Error += max_error(glm::batch::exp, ref_exp, make_range(-80.f, 80.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::batch::log, ref_log, make_range(1e-3f, 1e4f, Count)) < 1e-6 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_sincos_tan()
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count < 21; ++Count)
+	{
+		std::vector<float> In(Count), Sin(Count), Cos(Count), Sin2(Count), Cos2(Count), Tan(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = static_cast<float>(i) * 0.37f - 3.f;
+
+		glm::batch::sincos(In.data(), Sin.data(), Cos.data(), Count);
+		glm::batch::sin(In.data(), Sin2.data(), Count);
+		glm::batch::cos(In.data(), Cos2.data(), Count);
+		glm::batch::tan(In.data(), Tan.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += Sin[i] == Sin2[i] ? 0 : 1;
+			Error += Cos[i] == Cos2[i] ? 0 : 1;
+			Error += std::abs(Tan[i] - std::tan(In[i])) < 1e-4f * std::max(1.f, std::abs(std::tan(In[i]))) ? 0 : 1;
+		}
+
+		// In-place
+		std::vector<float> InOut(In);
+		glm::batch::sin(InOut.data(), InOut.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += InOut[i] == Sin[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Results do not depend on where an element sits in the array
+static int test_position_independence()
+{
+	int Error = 0;
+
+	std::vector<float> const In = make_range(-10.f, 10.f, 19);
+	std::vector<float> Full(In.size());
+	glm::batch::exp(In.data(), Full.data(), In.size());
+
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		float Single;
+		glm::batch::exp(&In[i], &Single, 1);
+		Error += Single == Full[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// The batch path shares its kernels with the aligned mediump vector functions
+static int test_match_vector()
+{
+	int Error = 0;
+
+	typedef glm::vec<4, float, glm::aligned_mediump> vec4;
+	std::vector<float> const In = make_range(0.1f, 20.f, 16);
+	std::vector<float> Sin(In.size()), Log(In.size());
+	glm::batch::sin(In.data(), Sin.data(), In.size());
+	glm::batch::log(In.data(), Log.data(), In.size());
+
+	for(std::size_t i = 0; i < In.size(); i += 4)
+	{
+		vec4 const v(In[i + 0], In[i + 1], In[i + 2], In[i + 3]);
+		vec4 const s = glm::sin(v);
+		vec4 const l = glm::log(v);
+		for(glm::length_t j = 0; j < 4; ++j)
+		{
+			Error += s[j] == Sin[i + static_cast<std::size_t>(j)] ? 0 : 1;
+			Error += l[j] == Log[i + static_cast<std::size_t>(j)] ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	std::vector<float> const In = make_range(-2.f, 2.f, 13);
+	std::vector<float> Out(In.size()), Ref(In.size());
+	glm::batch::atan(In, Out);
+	glm::batch::atan(In.data(), Ref.data(), In.size());
+	Error += Out == Ref ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_accuracy();
+	Error += test_sincos_tan();
+	Error += test_position_independence();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_match_vector();
+#	endif
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
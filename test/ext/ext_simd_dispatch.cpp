@@ -0,0 +1,221 @@
+#include <glm/ext/simd_dispatch.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/matrix.hpp>
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+typedef void (*batch_func)(float const*, float*, std::size_t);
+typedef double (*ref_func)(double);
+
+// Max error over an array, relative when |ref| > 1 and absolute otherwise
+static double max_error(batch_func Func, ref_func Ref, std::vector<float> const& In)
+{
+	std::vector<float> Out(In.size());
+	Func(In.data(), Out.data(), In.size());
+
+	double Max = 0.0;
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		double const Expected = Ref(static_cast<double>(In[i]));
+		double const Error = std::abs(static_cast<double>(Out[i]) - Expected) / std::max(1.0, std::abs(Expected));
+		Max = std::max(Max, Error);
+	}
+	return Max;
+}
+
+static std::vector<float> make_range(float Min, float Max, std::size_t Count)
+{
+	std::vector<float> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = Min + (Max - Min) * static_cast<float>(i) / static_cast<float>(Count - 1);
+	return Result;
+}
+
+static double ref_sin(double x) { return std::sin(x); }
+static double ref_cos(double x) { return std::cos(x); }
+static double ref_tan(double x) { return std::tan(x); }
+static double ref_asin(double x) { return std::asin(x); }
+static double ref_acos(double x) { return std::acos(x); }
+static double ref_atan(double x) { return std::atan(x); }
+static double ref_exp(double x) { return std::exp(x); }
+static double ref_log(double x) { return std::log(x); }
+
+static int test_transcendental()
+{
+	int Error = 0;
+
+	std::size_t const Count = 4099;
+
+	Error += max_error(glm::dispatch::sin, ref_sin, make_range(-100.f, 100.f, Count)) < 4e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::cos, ref_cos, make_range(-100.f, 100.f, Count)) < 4e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::tan, ref_tan, make_range(-1.f, 1.f, Count)) < 1e-5 ? 0 : 1;
+	Error += max_error(glm::dispatch::asin, ref_asin, make_range(-1.f, 1.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::acos, ref_acos, make_range(-1.f, 1.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::atan, ref_atan, make_range(-50.f, 50.f, Count)) < 2e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::exp, ref_exp, make_range(-80.f, 80.f, Count)) < 1e-6 ? 0 : 1;
+	Error += max_error(glm::dispatch::log, ref_log, make_range(1e-3f, 1e4f, Count)) < 1e-6 ? 0 : 1;
+
+	std::vector<float> const In = make_range(-10.f, 10.f, 37);
+	std::vector<float> Sin(In.size()), Cos(In.size()), RefSin(In.size()), RefCos(In.size());
+	glm::dispatch::sincos(In.data(), Sin.data(), Cos.data(), In.size());
+	glm::dispatch::sin(In.data(), RefSin.data(), In.size());
+	glm::dispatch::cos(In.data(), RefCos.data(), In.size());
+	Error += Sin == RefSin && Cos == RefCos ? 0 : 1;
+
+	return Error;
+}
+
+static std::vector<glm::mat4> make_matrices(std::size_t Count)
+{
+	std::vector<glm::mat4> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const t = static_cast<float>(i);
+		Result[i] =
+			glm::translate(glm::mat4(1), glm::vec3(0.1f * t, -2.0f, 3.0f)) *
+			glm::rotate(glm::mat4(1), 0.3f * t, glm::vec3(0.3f, 0.5f, -0.8f)) *
+			glm::scale(glm::mat4(1), glm::vec3(1.0f + 0.01f * t, 2.0f, 0.5f));
+	}
+	return Result;
+}
+
+static int test_matrix()
+{
+	int Error = 0;
+
+	std::size_t const Count = 19;
+	std::vector<glm::mat4> const A = make_matrices(Count);
+	std::vector<glm::mat4> B(A.rbegin(), A.rend());
+	std::vector<glm::mat4> Out(Count);
+
+	glm::dispatch::mul(A.data(), B.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], A[i] * B[i], 1e-4f)) ? 0 : 1;
+
+	glm::dispatch::inverse(A.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(A[i] * Out[i], glm::mat4(1), 1e-4f)) ? 0 : 1;
+
+	glm::dispatch::transpose(A.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == glm::transpose(A[i]) ? 0 : 1;
+
+	// In place
+	B = A;
+	glm::dispatch::transpose(B.data(), B.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += B[i] == glm::transpose(A[i]) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_transform()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_matrices(4)[3];
+
+	std::size_t const Count = 23;
+	std::vector<glm::vec4> In4(Count), Out4(Count);
+	std::vector<glm::vec3> In3(Count), Points(Count), Directions(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const t = static_cast<float>(i);
+		In4[i] = glm::vec4(t, -t * 0.5f, 2.0f, 1.0f - 0.1f * t);
+		In3[i] = glm::vec3(In4[i]);
+	}
+
+	glm::dispatch::transform(M, In4.data(), Out4.data(), Count);
+	glm::dispatch::transformPoints(M, In3.data(), Points.data(), Count);
+	glm::dispatch::transformDirections(M, In3.data(), Directions.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Out4[i], M * In4[i], 1e-4f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Points[i], glm::vec3(M * glm::vec4(In3[i], 1.0f)), 1e-4f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Directions[i], glm::vec3(M * glm::vec4(In3[i], 0.0f)), 1e-4f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Every variant rounds to nearest even, so all must match packHalf1x16
+static int test_half()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1031;
+	std::vector<float> In(Count), Back(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = (static_cast<float>(i) - 500.0f) * 137.03f / static_cast<float>(i + 1);
+	In[0] = 65520.0f;
+	In[1] = 1e-7f;
+
+	std::vector<glm::uint16> Half(Count);
+	glm::dispatch::packHalf(In.data(), Half.data(), Count);
+	glm::dispatch::unpackHalf(Half.data(), Back.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Half[i] == glm::packHalf1x16(In[i]) ? 0 : 1;
+		Error += Back[i] == glm::unpackHalf1x16(Half[i]) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_selection()
+{
+	int Error = 0;
+
+	glm::dispatch::simd_isa const Active = glm::dispatch::active_isa();
+	Error += glm::dispatch::is_supported(Active) ? 0 : 1;
+	Error += glm::dispatch::is_supported(glm::dispatch::isa_generic) ? 0 : 1;
+
+	// The default is the widest supported variant
+	glm::dispatch::simd_isa const Isas[] = {glm::dispatch::isa_avx512, glm::dispatch::isa_avx2, glm::dispatch::isa_sse4_1, glm::dispatch::isa_sse2};
+	for(glm::dispatch::simd_isa Isa : Isas)
+	{
+		if(!glm::dispatch::is_supported(Isa))
+			continue;
+		Error += Active == Isa ? 0 : 1;
+		break;
+	}
+
+	Error += std::strcmp(glm::dispatch::isa_name(glm::dispatch::isa_avx2), "avx2") == 0 ? 0 : 1;
+	Error += glm::dispatch::select_isa(static_cast<glm::dispatch::simd_isa>(42)) ? 1 : 0;
+	Error += glm::dispatch::active_isa() == Active ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_selection();
+
+	glm::dispatch::simd_isa const Active = glm::dispatch::active_isa();
+	std::printf("active: %s\n", glm::dispatch::isa_name(Active));
+
+	// Every variant this host can run must pass the same checks
+	glm::dispatch::simd_isa const Isas[] = {glm::dispatch::isa_generic, glm::dispatch::isa_sse2, glm::dispatch::isa_sse4_1, glm::dispatch::isa_avx2, glm::dispatch::isa_avx512};
+	for(glm::dispatch::simd_isa Isa : Isas)
+	{
+		if(!glm::dispatch::select_isa(Isa))
+			continue;
+
+		int const VariantError = test_transcendental() + test_matrix() + test_transform() + test_half();
+		std::printf("%s: %s\n", glm::dispatch::isa_name(Isa), VariantError == 0 ? "ok" : "FAILED");
+		Error += VariantError;
+	}
+	Error += glm::dispatch::select_isa(Active) ? 0 : 1;
+
+	return Error;
+}
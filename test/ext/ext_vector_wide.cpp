@@ -0,0 +1,199 @@
+#include <glm/ext/vector_wide.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/exponential.hpp>
+#include <glm/trigonometric.hpp>
+#include <cstddef>
+#include <vector>
+
+template<typename T>
+static std::vector<glm::vec<3, T, glm::defaultp> > make_vec3(std::size_t Count)
+{
+	std::vector<glm::vec<3, T, glm::defaultp> > Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const t = static_cast<T>(i);
+		Result[i] = glm::vec<3, T, glm::defaultp>(t * static_cast<T>(0.5) + static_cast<T>(1), static_cast<T>(2) - t, t * t * static_cast<T>(0.1) - static_cast<T>(3));
+	}
+	return Result;
+}
+
+// Gathering then scattering returns the input; missing lanes are zero
+template<typename T, glm::length_t N>
+static int test_gather_scatter()
+{
+	int Error = 0;
+
+	std::vector<glm::vec<3, T, glm::defaultp> > const In = make_vec3<T>(N);
+	glm::wide::vec3<T, N> const V = glm::wide::gather<N>(In.data());
+	for(glm::length_t i = 0; i < N; ++i)
+		Error += V.x[i] == In[i].x && V.y[i] == In[i].y && V.z[i] == In[i].z ? 0 : 1;
+
+	std::vector<glm::vec<3, T, glm::defaultp> > Out(N);
+	glm::wide::scatter(V, Out.data());
+	Error += Out == In ? 0 : 1;
+
+	glm::wide::vec3<T, N> const Partial = glm::wide::gather<N>(In.data(), N - 1);
+	Error += Partial.x[N - 1] == static_cast<T>(0) && Partial.y[N - 2] == In[N - 2].y ? 0 : 1;
+
+	std::vector<glm::vec<3, T, glm::defaultp> > Short(N, glm::vec<3, T, glm::defaultp>(7));
+	glm::wide::scatter(V, Short.data(), N - 1);
+	Error += Short[N - 2] == In[N - 2] && Short[N - 1] == glm::vec<3, T, glm::defaultp>(7) ? 0 : 1;
+
+	std::vector<glm::vec4> In4(N), Out4(N);
+	for(glm::length_t i = 0; i < N; ++i)
+		In4[i] = glm::vec4(static_cast<float>(i), -static_cast<float>(i), 1.0f, 0.25f * static_cast<float>(i));
+	glm::wide::vec4<float, N> const V4 = glm::wide::gather<N>(In4.data());
+	Error += V4.w[N - 1] == In4[N - 1].w && V4.y[1] == In4[1].y ? 0 : 1;
+	glm::wide::scatter(V4, Out4.data());
+	Error += Out4 == In4 ? 0 : 1;
+
+	return Error;
+}
+
+// Every lane matches the core function applied to the same input
+template<typename T, glm::length_t N>
+static int test_functions()
+{
+	int Error = 0;
+
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	T const Epsilon = static_cast<T>(1e-5);
+
+	std::vector<vec3> const A = make_vec3<T>(N);
+	std::vector<vec3> B(A.rbegin(), A.rend());
+	glm::wide::vec3<T, N> const WA = glm::wide::gather<N>(A.data());
+	glm::wide::vec3<T, N> const WB = glm::wide::gather<N>(B.data());
+
+	glm::wide::scalar<T, N> const Dot = glm::wide::dot(WA, WB);
+	glm::wide::scalar<T, N> const Length = glm::wide::length(WA);
+	glm::wide::scalar<T, N> const Distance = glm::wide::distance(WA, WB);
+	glm::wide::scalar<T, N> const Half(static_cast<T>(0.5));
+
+	std::vector<vec3> Cross(N), Normalize(N), Mix(N), Clamp(N), Sum(N), Scaled(N), Sin(N), Cos(N), Exp(N), Log(N), Min(N), Abs(N), Floor(N), Fract(N);
+	glm::wide::scatter(glm::wide::cross(WA, WB), Cross.data());
+	glm::wide::scatter(glm::wide::normalize(WA), Normalize.data());
+	glm::wide::scatter(glm::wide::mix(WA, WB, Half), Mix.data());
+	glm::wide::scatter(glm::wide::clamp(WA, glm::wide::scalar<T, N>(static_cast<T>(-1)), glm::wide::scalar<T, N>(static_cast<T>(1))), Clamp.data());
+	glm::wide::scatter(WA + WB * static_cast<T>(2) - -WA / Half, Sum.data());
+	glm::wide::scatter(Dot * WA, Scaled.data());
+	glm::wide::scatter(glm::wide::sin(WA), Sin.data());
+	glm::wide::scatter(glm::wide::cos(WA), Cos.data());
+	glm::wide::scatter(glm::wide::exp(WA * static_cast<T>(0.1)), Exp.data());
+	glm::wide::scatter(glm::wide::log(glm::wide::abs(WA) + static_cast<T>(1)), Log.data());
+	glm::wide::scatter(glm::wide::min(WA, WB), Min.data());
+	glm::wide::scatter(glm::wide::abs(WA), Abs.data());
+	glm::wide::scatter(glm::wide::floor(WA * static_cast<T>(0.7)), Floor.data());
+	glm::wide::scatter(glm::wide::fract(WA * static_cast<T>(0.7)), Fract.data());
+
+	for(glm::length_t i = 0; i < N; ++i)
+	{
+		vec3 const a = A[i];
+		vec3 const b = B[i];
+		T const d = glm::dot(a, b);
+
+		Error += glm::equal(Dot[i], d, Epsilon * glm::max(static_cast<T>(1), glm::abs(d))) ? 0 : 1;
+		Error += glm::equal(Length[i], glm::length(a), Epsilon) ? 0 : 1;
+		Error += glm::equal(Distance[i], glm::distance(a, b), Epsilon) ? 0 : 1;
+		Error += glm::all(glm::equal(Cross[i], glm::cross(a, b), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Normalize[i], glm::normalize(a), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Mix[i], glm::mix(a, b, static_cast<T>(0.5)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Clamp[i], glm::clamp(a, static_cast<T>(-1), static_cast<T>(1)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Sum[i], a + b * static_cast<T>(2) + a / static_cast<T>(0.5), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Scaled[i], d * a, Epsilon * glm::max(static_cast<T>(1), glm::abs(d * glm::length(a))))) ? 0 : 1;
+		Error += glm::all(glm::equal(Sin[i], glm::sin(a), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Cos[i], glm::cos(a), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Exp[i], glm::exp(a * static_cast<T>(0.1)), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Log[i], glm::log(glm::abs(a) + static_cast<T>(1)), Epsilon)) ? 0 : 1;
+		Error += Min[i] == glm::min(a, b) ? 0 : 1;
+		Error += Abs[i] == glm::abs(a) ? 0 : 1;
+		Error += Floor[i] == glm::floor(a * static_cast<T>(0.7)) ? 0 : 1;
+		Error += Fract[i] == glm::fract(a * static_cast<T>(0.7)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::length_t N>
+static int test_mask()
+{
+	int Error = 0;
+
+	T Values[N];
+	for(glm::length_t i = 0; i < N; ++i)
+		Values[i] = static_cast<T>(i) - static_cast<T>(N / 2);
+	glm::wide::scalar<T, N> const x = glm::wide::scalar<T, N>::load(Values);
+
+	glm::wide::mask<T, N> const Negative = x < static_cast<T>(0);
+	glm::wide::mask<T, N> const Zero = x == glm::wide::scalar<T, N>(static_cast<T>(0));
+	for(glm::length_t i = 0; i < N; ++i)
+	{
+		Error += Negative[i] == (Values[i] < static_cast<T>(0)) ? 0 : 1;
+		Error += (!Negative && !Zero)[i] == (Values[i] > static_cast<T>(0)) ? 0 : 1;
+		Error += (Negative || Zero)[i] == (x <= static_cast<T>(0))[i] ? 0 : 1;
+	}
+
+	Error += glm::wide::any(Negative) ? 0 : 1;
+	Error += glm::wide::all(Negative) ? 1 : 0;
+	Error += glm::wide::all(glm::wide::mask<T, N>(true)) ? 0 : 1;
+	Error += glm::wide::any(glm::wide::mask<T, N>(false)) ? 1 : 0;
+
+	// select: |x| without abs
+	glm::wide::scalar<T, N> const Abs = glm::wide::select(Negative, -x, x);
+	for(glm::length_t i = 0; i < N; ++i)
+		Error += Abs[i] == glm::abs(Values[i]) ? 0 : 1;
+
+	glm::wide::scalar<T, N> y(static_cast<T>(1));
+	y.set(N - 1, static_cast<T>(5));
+	Error += y[N - 1] == static_cast<T>(5) && y[0] == static_cast<T>(1) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_constructors()
+{
+	int Error = 0;
+
+	glm::wide::vec3<float, 8> const Splat(glm::vec3(1, 2, 3));
+	glm::wide::vec4<float, 8> const V4(Splat, glm::wide::scalar<float, 8>(4.0f));
+	for(glm::length_t i = 0; i < 8; ++i)
+		Error += V4.x[i] == 1.0f && V4.y[i] == 2.0f && V4.z[i] == 3.0f && V4.w[i] == 4.0f ? 0 : 1;
+
+	glm::wide::vec2<float, 4> V2(glm::wide::scalar<float, 4>(3.0f), glm::wide::scalar<float, 4>(4.0f));
+	V2 *= glm::wide::scalar<float, 4>(2.0f);
+	Error += glm::wide::length(V2)[3] == 10.0f ? 0 : 1;
+	Error += V2[1][0] == 8.0f ? 0 : 1;
+
+	Error += glm::wide::scalar<float, 8>::length() == 8 ? 0 : 1;
+	Error += glm::wide::vec3<float, 8>::length() == 3 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_constructors();
+
+	// Register mapped lane counts under SIMD
+	Error += test_gather_scatter<float, 4>();
+	Error += test_gather_scatter<float, 8>();
+	Error += test_functions<float, 4>();
+	Error += test_functions<float, 8>();
+	Error += test_mask<float, 4>();
+	Error += test_mask<float, 8>();
+
+	// Generic lane loops
+	Error += test_gather_scatter<float, 5>();
+	Error += test_functions<float, 5>();
+	Error += test_functions<double, 4>();
+	Error += test_mask<double, 4>();
+
+	return Error;
+}
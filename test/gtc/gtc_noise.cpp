@@ -2,6 +2,10 @@
 #include <glm/gtc/noise.hpp>
 #include <glm/gtc/type_precision.hpp>
 #include <glm/gtx/raw_data.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cstddef>
+#include <vector>
 
 static int test_simplex_float()
 {
@@ -69,6 +73,341 @@ static int test_perlin_pedioric_double()
 	return Error;
 }
 
+// Points around the origin, on both sides of the cell and period boundaries
+template<glm::length_t L, typename T>
+static glm::vec<L, T, glm::defaultp> test_point(int i)
+{
+	glm::vec<L, T, glm::defaultp> p;
+	for(glm::length_t c = 0; c < L; ++c)
+		p[c] = static_cast<T>(((i * (7 + 3 * c) + 11 * c) % 97) - 48) * static_cast<T>(0.173) + static_cast<T>(c) * static_cast<T>(0.25);
+	return p;
+}
+
+template<glm::length_t L, typename T, glm::length_t N>
+static int test_packet_dimension()
+{
+	int Error = 0;
+
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+	vec_type const Rep(glm::vec<4, T, glm::defaultp>(static_cast<T>(3), static_cast<T>(5), static_cast<T>(4), static_cast<T>(6)));
+
+	for(int i = 0; i < 256; i += N)
+	{
+		vec_type Points[N];
+		for(glm::length_t l = 0; l < N; ++l)
+			Points[l] = test_point<L, T>(i + l);
+
+		glm::wide::vec<L, T, N> const Packet = glm::wide::gather<N>(Points);
+		glm::wide::scalar<T, N> const Perlin = glm::perlin(Packet);
+		glm::wide::scalar<T, N> const Periodic = glm::perlin(Packet, glm::wide::vec<L, T, N>(Rep));
+		glm::wide::scalar<T, N> const Simplex = glm::simplex(Packet);
+
+		for(glm::length_t l = 0; l < N; ++l)
+		{
+			Error += glm::equal(Perlin[l], glm::perlin(Points[l]), static_cast<T>(1e-5)) ? 0 : 1;
+			Error += glm::equal(Periodic[l], glm::perlin(Points[l], Rep), static_cast<T>(1e-5)) ? 0 : 1;
+			Error += glm::equal(Simplex[l], glm::simplex(Points[l]), static_cast<T>(1e-5)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, typename T, glm::length_t N>
+static int test_fractal_packet_dimension()
+{
+	int Error = 0;
+
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+	T const Epsilon = static_cast<T>(1e-4);
+
+	for(int i = 0; i < 64; i += N)
+	{
+		vec_type Points[N];
+		for(glm::length_t l = 0; l < N; ++l)
+			Points[l] = test_point<L, T>(i + l) * static_cast<T>(0.5);
+
+		glm::wide::vec<L, T, N> const Packet = glm::wide::gather<N>(Points);
+		glm::wide::vec<L, T, N> SimplexGradient, PerlinGradient, FbmGradient, RidgedGradient;
+		glm::wide::scalar<T, N> const Simplex = glm::simplexDerivative(Packet, SimplexGradient);
+		glm::wide::scalar<T, N> const Perlin = glm::perlinDerivative(Packet, PerlinGradient);
+		glm::wide::scalar<T, N> const Fbm = glm::fbm<4>(Packet, static_cast<T>(2.1), static_cast<T>(0.45));
+		glm::wide::scalar<T, N> const FbmValue = glm::fbm<4>(Packet, FbmGradient, static_cast<T>(2.1), static_cast<T>(0.45));
+		glm::wide::scalar<T, N> const Ridged = glm::ridged<3, glm::noise_perlin>(Packet, RidgedGradient);
+		glm::wide::scalar<T, N> const Billow = glm::billow<3>(Packet);
+		glm::wide::scalar<T, N> const Turbulence = glm::turbulence<3, glm::noise_perlin>(Packet);
+		glm::wide::vec<L, T, N> const Warp = glm::warp<2>(Packet, static_cast<T>(0.5));
+
+		for(glm::length_t l = 0; l < N; ++l)
+		{
+			vec_type Gradient, Lane;
+
+			Error += glm::equal(Simplex[l], glm::simplexDerivative(Points[l], Gradient), Epsilon) ? 0 : 1;
+			for(glm::length_t c = 0; c < L; ++c)
+				Error += glm::equal(SimplexGradient[c][l], Gradient[c], Epsilon) ? 0 : 1;
+
+			Error += glm::equal(Perlin[l], glm::perlinDerivative(Points[l], Gradient), Epsilon) ? 0 : 1;
+			for(glm::length_t c = 0; c < L; ++c)
+				Error += glm::equal(PerlinGradient[c][l], Gradient[c], Epsilon) ? 0 : 1;
+
+			Error += glm::equal(Fbm[l], glm::fbm<4>(Points[l], static_cast<T>(2.1), static_cast<T>(0.45)), Epsilon) ? 0 : 1;
+			Error += glm::equal(FbmValue[l], glm::fbm<4>(Points[l], Gradient, static_cast<T>(2.1), static_cast<T>(0.45)), Epsilon) ? 0 : 1;
+			for(glm::length_t c = 0; c < L; ++c)
+				Error += glm::equal(FbmGradient[c][l], Gradient[c], Epsilon * static_cast<T>(10)) ? 0 : 1;
+
+			Error += glm::equal(Ridged[l], glm::ridged<3, glm::noise_perlin>(Points[l], Gradient), Epsilon) ? 0 : 1;
+			for(glm::length_t c = 0; c < L; ++c)
+				Error += glm::equal(RidgedGradient[c][l], Gradient[c], Epsilon * static_cast<T>(10)) ? 0 : 1;
+
+			Error += glm::equal(Billow[l], glm::billow<3>(Points[l]), Epsilon) ? 0 : 1;
+			Error += glm::equal(Turbulence[l], glm::turbulence<3, glm::noise_perlin>(Points[l]), Epsilon) ? 0 : 1;
+
+			vec_type const Warped = glm::warp<2>(Points[l], static_cast<T>(0.5));
+			for(glm::length_t c = 0; c < L; ++c)
+				Lane[c] = Warp[c][l];
+			Error += glm::all(glm::equal(Lane, Warped, Epsilon)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename T, glm::length_t N>
+static int test_packet()
+{
+	int Error = 0;
+
+	Error += test_packet_dimension<2, T, N>();
+	Error += test_packet_dimension<3, T, N>();
+	Error += test_packet_dimension<4, T, N>();
+
+	Error += test_fractal_packet_dimension<2, T, N>();
+	Error += test_fractal_packet_dimension<3, T, N>();
+	Error += test_fractal_packet_dimension<4, T, N>();
+
+	return Error;
+}
+
+// Central differences of a scalar function
+template<glm::length_t L, typename function>
+static glm::vec<L, double, glm::defaultp> test_difference(glm::vec<L, double, glm::defaultp> const& p, function Function)
+{
+	double const h = 1e-7;
+
+	glm::vec<L, double, glm::defaultp> Result;
+	for(glm::length_t c = 0; c < L; ++c)
+	{
+		glm::vec<L, double, glm::defaultp> Next(p), Prev(p);
+		Next[c] += h;
+		Prev[c] -= h;
+		Result[c] = (Function(Next) - Function(Prev)) / (2.0 * h);
+	}
+	return Result;
+}
+
+template<glm::length_t L>
+static int test_derivative_dimension()
+{
+	int Error = 0;
+
+	typedef glm::vec<L, double, glm::defaultp> vec_type;
+	double const Epsilon = 1e-4;
+
+	// One error per failing point keeps the count readable
+	for(int i = 0; i < 64; ++i)
+	{
+		int PointError = 0;
+
+		// Off the lattice: simplex noise jumps slightly across some faces of
+		// its simplices, where differences do not converge
+		vec_type const p = test_point<L, double>(i) * 0.5137;
+		vec_type Gradient;
+
+		PointError += glm::equal(glm::perlinDerivative(p, Gradient), glm::perlin(p), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::perlin(q); }), Epsilon)) ? 0 : 1;
+
+		PointError += glm::equal(glm::simplexDerivative(p, Gradient), glm::simplex(p), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::simplex(q); }), Epsilon)) ? 0 : 1;
+
+		// The octaves of fbm by hand
+		double Fbm = 0.0;
+		for(int o = 0; o < 5; ++o)
+			Fbm += glm::pow(0.5, static_cast<double>(o)) * glm::simplex(p * glm::pow(2.0, static_cast<double>(o)));
+		PointError += glm::equal(glm::fbm<5>(p), Fbm, 1e-9) ? 0 : 1;
+
+		PointError += glm::equal(glm::fbm<5>(p, Gradient), Fbm, 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::fbm<5>(q); }), Epsilon)) ? 0 : 1;
+
+		PointError += glm::equal(glm::fbm<4, glm::noise_perlin>(p, Gradient, 1.9, 0.6), glm::fbm<4, glm::noise_perlin>(p, 1.9, 0.6), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::fbm<4, glm::noise_perlin>(q, 1.9, 0.6); }), Epsilon)) ? 0 : 1;
+
+		PointError += glm::equal(glm::ridged<4>(p, Gradient), glm::ridged<4>(p), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::ridged<4>(q); }), Epsilon)) ? 0 : 1;
+
+		PointError += glm::equal(glm::billow<4>(p, Gradient), glm::billow<4>(p), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::billow<4>(q); }), Epsilon)) ? 0 : 1;
+
+		PointError += glm::equal(glm::turbulence<4, glm::noise_perlin>(p, Gradient), glm::turbulence<4, glm::noise_perlin>(p), 1e-9) ? 0 : 1;
+		PointError += glm::all(glm::equal(Gradient, test_difference(p, [](vec_type const& q){ return glm::turbulence<4, glm::noise_perlin>(q); }), Epsilon)) ? 0 : 1;
+
+		// Each component displaced by its own fbm
+		vec_type const Warped = glm::warp<3>(p, 0.25);
+		for(glm::length_t c = 0; c < L; ++c)
+			PointError += glm::equal(Warped[c], p[c] + 0.25 * glm::fbm<3>(p + static_cast<double>(c) * 5.2), 1e-9) ? 0 : 1;
+
+		Error += PointError > 0 ? 1 : 0;
+	}
+
+	return Error;
+}
+
+static int test_derivative()
+{
+	int Error = 0;
+
+	Error += test_derivative_dimension<2>();
+	Error += test_derivative_dimension<3>();
+	Error += test_derivative_dimension<4>();
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_batch_dimension()
+{
+	int Error = 0;
+
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+	vec_type const Rep(glm::vec<4, T, glm::defaultp>(static_cast<T>(4), static_cast<T>(3), static_cast<T>(5), static_cast<T>(2)));
+
+	// Counts around the packet sizes exercise the partial packets
+	for(std::size_t Count = 0; Count < 20; ++Count)
+	{
+		std::vector<vec_type> Points(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Points[i] = test_point<L, T>(static_cast<int>(i * 5 + Count));
+
+		std::vector<T> Perlin(Count + 1, static_cast<T>(7));
+		std::vector<T> Periodic(Count + 1, static_cast<T>(7));
+		std::vector<T> Simplex(Count + 1, static_cast<T>(7));
+		std::vector<T> Fbm(Count + 1, static_cast<T>(7));
+		glm::batch::perlin(Points.data(), Perlin.data(), Count);
+		glm::batch::perlin(Points.data(), Rep, Periodic.data(), Count);
+		glm::batch::simplex(Points.data(), Simplex.data(), Count);
+		glm::batch::noise(Points.data(), Fbm.data(), Count, [](auto const& p){ return glm::fbm<3>(p); });
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::equal(Perlin[i], glm::perlin(Points[i]), static_cast<T>(1e-5)) ? 0 : 1;
+			Error += glm::equal(Periodic[i], glm::perlin(Points[i], Rep), static_cast<T>(1e-5)) ? 0 : 1;
+			Error += glm::equal(Simplex[i], glm::simplex(Points[i]), static_cast<T>(1e-5)) ? 0 : 1;
+			Error += glm::equal(Fbm[i], glm::fbm<3>(Points[i]), static_cast<T>(1e-5)) ? 0 : 1;
+		}
+
+		// Nothing past the end
+		Error += Perlin[Count] == static_cast<T>(7) ? 0 : 1;
+		Error += Periodic[Count] == static_cast<T>(7) ? 0 : 1;
+		Error += Simplex[Count] == static_cast<T>(7) ? 0 : 1;
+		Error += Fbm[Count] == static_cast<T>(7) ? 0 : 1;
+	}
+
+#	if GLM_HAS_SPAN
+	{
+		std::vector<vec_type> Points(13);
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Points[i] = test_point<L, T>(static_cast<int>(i));
+
+		std::vector<T> Span(Points.size());
+		std::vector<T> Pointer(Points.size());
+		std::span<vec_type const> const In(Points);
+
+		glm::batch::perlin(In, std::span<T>(Span));
+		glm::batch::perlin(Points.data(), Pointer.data(), Points.size());
+		Error += Span == Pointer ? 0 : 1;
+
+		glm::batch::perlin(In, Rep, std::span<T>(Span));
+		glm::batch::perlin(Points.data(), Rep, Pointer.data(), Points.size());
+		Error += Span == Pointer ? 0 : 1;
+
+		glm::batch::simplex(In, std::span<T>(Span));
+		glm::batch::simplex(Points.data(), Pointer.data(), Points.size());
+		Error += Span == Pointer ? 0 : 1;
+
+		glm::batch::noise(In, std::span<T>(Span), [](auto const& p){ return glm::billow<2>(p); });
+		glm::batch::noise(Points.data(), Pointer.data(), Points.size(), [](auto const& p){ return glm::billow<2>(p); });
+		Error += Span == Pointer ? 0 : 1;
+	}
+#	endif//GLM_HAS_SPAN
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_grid_dimension(glm::vec<L, int, glm::defaultp> const& Size)
+{
+	int Error = 0;
+
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+	vec_type const Origin = test_point<L, T>(3);
+	vec_type const Spacing(glm::vec<4, T, glm::defaultp>(static_cast<T>(0.125), static_cast<T>(0.37), static_cast<T>(0.5), static_cast<T>(0.21)));
+	vec_type const Rep(glm::vec<4, T, glm::defaultp>(static_cast<T>(2), static_cast<T>(3), static_cast<T>(4), static_cast<T>(5)));
+
+	std::size_t Count = 1;
+	for(glm::length_t c = 0; c < L; ++c)
+		Count *= static_cast<std::size_t>(Size[c]);
+
+	std::vector<T> Perlin(Count + 1, static_cast<T>(7));
+	std::vector<T> Periodic(Count + 1, static_cast<T>(7));
+	std::vector<T> Simplex(Count + 1, static_cast<T>(7));
+	std::vector<T> Ridged(Count + 1, static_cast<T>(7));
+	glm::batch::perlinGrid(Origin, Spacing, Size, Perlin.data());
+	glm::batch::perlinGrid(Origin, Spacing, Size, Rep, Periodic.data());
+	glm::batch::simplexGrid(Origin, Spacing, Size, Simplex.data());
+	glm::batch::noiseGrid(Origin, Spacing, Size, Ridged.data(), [](auto const& p){ return glm::ridged<3, glm::noise_perlin>(p); });
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		vec_type Position;
+		std::size_t Index = i;
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			Position[c] = Origin[c] + static_cast<T>(Index % static_cast<std::size_t>(Size[c])) * Spacing[c];
+			Index /= static_cast<std::size_t>(Size[c]);
+		}
+
+		Error += glm::equal(Perlin[i], glm::perlin(Position), static_cast<T>(1e-5)) ? 0 : 1;
+		Error += glm::equal(Periodic[i], glm::perlin(Position, Rep), static_cast<T>(1e-5)) ? 0 : 1;
+		Error += glm::equal(Simplex[i], glm::simplex(Position), static_cast<T>(1e-5)) ? 0 : 1;
+		Error += glm::equal(Ridged[i], glm::ridged<3, glm::noise_perlin>(Position), static_cast<T>(1e-5)) ? 0 : 1;
+	}
+
+	Error += Perlin[Count] == static_cast<T>(7) ? 0 : 1;
+	Error += Periodic[Count] == static_cast<T>(7) ? 0 : 1;
+	Error += Simplex[Count] == static_cast<T>(7) ? 0 : 1;
+	Error += Ridged[Count] == static_cast<T>(7) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_batch()
+{
+	int Error = 0;
+
+	Error += test_batch_dimension<2, T>();
+	Error += test_batch_dimension<3, T>();
+	Error += test_batch_dimension<4, T>();
+
+	// Widths that are and are not multiples of the packet size
+	Error += test_grid_dimension<2, T>(glm::ivec2(16, 9));
+	Error += test_grid_dimension<2, T>(glm::ivec2(21, 4));
+	Error += test_grid_dimension<3, T>(glm::ivec3(13, 5, 3));
+	Error += test_grid_dimension<4, T>(glm::ivec4(11, 3, 2, 3));
+	Error += test_grid_dimension<3, T>(glm::ivec3(0, 5, 3));
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -82,5 +421,14 @@ int main()
 	Error += test_perlin_pedioric_float();
 	Error += test_perlin_pedioric_double();
 
+	Error += test_packet<float, 4>();
+	Error += test_packet<float, 8>();
+	Error += test_packet<double, 4>();
+
+	Error += test_batch<float>();
+	Error += test_batch<double>();
+
+	Error += test_derivative();
+
 	return Error;
 }
@@ -2,7 +2,14 @@
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/ext/vector_relational.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
 #include <vector>
 
 /*
@@ -110,6 +117,361 @@ static int test_Half4x16()
 	return Error;
 }
 
+// Array converters match packHalf1x16 / unpackHalf1x16 bit for bit, NaN aside
+static int test_Half_array()
+{
+	int Error = 0;
+
+	// Every half, in an odd count so the remainder path runs
+	std::vector<glm::uint16> Halves(65536 + 3);
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Halves[i] = static_cast<glm::uint16>(i);
+	std::vector<float> Floats(Halves.size());
+	glm::unpackHalf(Halves.data(), Floats.data(), Halves.size());
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+	{
+		float const Expected = glm::unpackHalf1x16(Halves[i]);
+		Error += std::isnan(Expected) ? (std::isnan(Floats[i]) ? 0 : 1) : (std::memcmp(&Expected, &Floats[i], sizeof(float)) == 0 ? 0 : 1);
+	}
+
+	// A stride over every float bit pattern, plus rounding ties, overflow,
+	// subnormal and special values
+	std::vector<float> In;
+	for(glm::uint64 Bits = 0; Bits <= 0xFFFFFFFFull; Bits += 4093)
+	{
+		glm::uint const b = static_cast<glm::uint>(Bits);
+		float f;
+		std::memcpy(&f, &b, sizeof(f));
+		In.push_back(f);
+	}
+	float const Specials[] = {
+		0.0f, -0.0f, 1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, 65504.0f, 65519.0f, 65520.0f, -65520.0f,
+		6.1035156e-5f, 5.9604645e-8f, 2.9802322e-8f, 2.9802326e-8f, 8.940697e-8f, 1e-10f,
+		std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+	In.insert(In.end(), Specials, Specials + sizeof(Specials) / sizeof(Specials[0]));
+
+	std::vector<glm::uint16> Out(In.size());
+	glm::packHalf(In.data(), Out.data(), In.size());
+	for(std::size_t i = 0; i < In.size(); ++i)
+	{
+		glm::uint16 const Expected = glm::packHalf1x16(In[i]);
+		Error += std::isnan(In[i]) ? (std::isnan(glm::unpackHalf1x16(Out[i])) ? 0 : 1) : (Out[i] == Expected ? 0 : 1);
+	}
+
+	// The vector forms take the same path
+	for(std::size_t i = 0; i + 4 <= In.size(); i += 4099)
+	{
+		glm::vec4 const v(In[i], In[i + 1], In[i + 2], In[i + 3]);
+		if(glm::any(glm::isnan(v)))
+			continue;
+		glm::u16vec4 const p = glm::packHalf(v);
+		Error += p == glm::u16vec4(Out[i], Out[i + 1], Out[i + 2], Out[i + 3]) ? 0 : 1;
+		glm::uint64 Packed = glm::packHalf4x16(v);
+		Error += std::memcmp(&Packed, &Out[i], sizeof(Packed)) == 0 ? 0 : 1;
+		glm::vec4 const u = glm::unpackHalf4x16(Packed);
+		Error += glm::all(glm::equal(u, glm::unpackHalf(p), 0.0f)) || glm::any(glm::isinf(u)) ? 0 : 1;
+	}
+
+#	if GLM_HAS_SPAN
+		std::vector<float> Back(Out.size());
+		glm::unpackHalf(std::span<glm::uint16 const>(Out), std::span<float>(Back));
+		glm::packHalf(std::span<float const>(Back), std::span<glm::uint16>(Out));
+		for(std::size_t i = 0; i < Out.size(); ++i)
+			Error += std::isnan(Back[i]) || Out[i] == glm::packHalf1x16(Back[i]) ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+// Compares the strided array converters with the per-element functions, bit
+// for bit or within Epsilon for the decoders, on tight arrays and on an
+// interleaved vertex layout
+template<typename vecType, typename packedType>
+static int test_packed_array(
+	packedType (*Pack)(vecType const&), vecType (*Unpack)(packedType),
+	void (*PackArray)(vecType const*, packedType*, std::size_t, std::size_t, std::size_t),
+	void (*UnpackArray)(packedType const*, vecType*, std::size_t, std::size_t, std::size_t),
+	std::vector<vecType> const& Values, std::vector<packedType> const& Patterns, float Epsilon = 0.0f)
+{
+	int Error = 0;
+
+	struct vertex
+	{
+		float Pad;
+		vecType Value;
+		packedType Packed;
+	};
+
+	std::vector<packedType> Packed(Values.size());
+	PackArray(Values.data(), Packed.data(), Values.size(), sizeof(vecType), sizeof(packedType));
+	std::vector<vertex> Vertices(Values.size());
+	for(std::size_t i = 0; i < Values.size(); ++i)
+		Vertices[i].Value = Values[i];
+	PackArray(&Vertices[0].Value, &Vertices[0].Packed, Vertices.size(), sizeof(vertex), sizeof(vertex));
+	for(std::size_t i = 0; i < Values.size(); ++i)
+	{
+		packedType const Expected = Pack(Values[i]);
+		Error += Packed[i] == Expected ? 0 : 1;
+		Error += Vertices[i].Packed == Expected ? 0 : 1;
+	}
+
+	std::vector<vecType> Unpacked(Patterns.size());
+	UnpackArray(Patterns.data(), Unpacked.data(), Patterns.size(), sizeof(packedType), sizeof(vecType));
+	Vertices.resize(Patterns.size());
+	for(std::size_t i = 0; i < Patterns.size(); ++i)
+		Vertices[i].Packed = Patterns[i];
+	UnpackArray(&Vertices[0].Packed, &Vertices[0].Value, Vertices.size(), sizeof(vertex), sizeof(vertex));
+	for(std::size_t i = 0; i < Patterns.size(); ++i)
+	{
+		vecType const Expected = Unpack(Patterns[i]);
+		for(glm::length_t c = 0; c < Expected.length(); ++c)
+		{
+			if(std::isnan(Expected[c]))
+			{
+				Error += std::isnan(Unpacked[i][c]) && std::isnan(Vertices[i].Value[c]) ? 0 : 1;
+				continue;
+			}
+			if(Epsilon > 0.0f)
+			{
+				Error += std::abs(Expected[c] - Unpacked[i][c]) <= Epsilon ? 0 : 1;
+				Error += std::abs(Expected[c] - Vertices[i].Value[c]) <= Epsilon ? 0 : 1;
+				continue;
+			}
+			Error += std::memcmp(&Expected[c], &Unpacked[i][c], sizeof(float)) == 0 ? 0 : 1;
+			Error += std::memcmp(&Expected[c], &Vertices[i].Value[c], sizeof(float)) == 0 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Normalized inputs over [-1.25, 1.25] with rounding ties and signed zeros,
+// or float bit patterns of every class for the small float formats
+template<typename vecType>
+static std::vector<vecType> packed_array_values(std::size_t Count, bool Normalized)
+{
+	float const Specials[] = {0.0f, -0.0f, 0.5f, -0.5f, 0.25f, -0.25f, 1.0f, -1.0f, 2.0f, -2.0f, 0.5f / 255.0f, 1.5f / 31.0f,
+		3.9999998f, 1e-30f, 1e-40f, 65024.0f, 65536.0f, std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+	std::size_t const SpecialCount = sizeof(Specials) / sizeof(Specials[0]) - (Normalized ? 3 : 0);
+
+	std::mt19937 Rng(1);
+	std::uniform_real_distribution<float> Unit(-1.25f, 1.25f);
+	std::vector<vecType> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		for(glm::length_t c = 0; c < vecType::length(); ++c)
+		{
+			glm::uint32 const Bits = static_cast<glm::uint32>(Rng());
+			if(Bits % 8 == 0)
+				Values[i][c] = Specials[(Bits >> 8) % SpecialCount];
+			else if(Normalized)
+				Values[i][c] = Unit(Rng);
+			else
+				std::memcpy(&Values[i][c], &Bits, sizeof(float));
+		}
+	return Values;
+}
+
+template<typename packedType>
+static std::vector<packedType> packed_array_patterns(std::size_t Count)
+{
+	std::mt19937_64 Rng(7);
+	std::vector<packedType> Patterns(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Patterns[i] = static_cast<packedType>(sizeof(packedType) == 2 ? i : Rng());
+	return Patterns;
+}
+
+// Random unit directions and quaternions with the axes, the octant diagonals
+// and ties between the largest quaternion components
+static std::vector<glm::vec3> packed_array_directions(std::size_t Count)
+{
+	glm::vec3 const Specials[] = {
+		glm::vec3(1, 0, 0), glm::vec3(-1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, -1, 0), glm::vec3(0, 0, 1), glm::vec3(0, 0, -1),
+		glm::vec3(-0.0f, -0.0f, -1.0f), glm::vec3(-0.0f, 1, -0.0f), glm::vec3(1, 1, 1), glm::vec3(-1, 1, -1), glm::vec3(1, -1, -1), glm::vec3(0.5f, -0.5f, 0)};
+
+	std::mt19937 Rng(3);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	std::vector<glm::vec3> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 v(0.0f);
+		while(glm::dot(v, v) < 1e-4f)
+			for(glm::length_t c = 0; c < 3; ++c)
+				v[c] = Unit(Rng);
+		Values[i] = i % 5 == 0 ? Specials[(i / 5) % (sizeof(Specials) / sizeof(Specials[0]))] : glm::normalize(v);
+	}
+	return Values;
+}
+
+static std::vector<glm::quat> packed_array_quats(std::size_t Count)
+{
+	glm::quat const Specials[] = {
+		glm::quat::wxyz(1, 0, 0, 0), glm::quat::wxyz(-1, 0, 0, 0), glm::quat::wxyz(0, 0, 0, -1), glm::quat::wxyz(0, 1, 0, 0),
+		glm::quat::wxyz(0.5f, 0.5f, 0.5f, 0.5f), glm::quat::wxyz(0.5f, -0.5f, -0.5f, 0.5f), glm::quat::wxyz(-0.5f, 0.5f, -0.5f, -0.5f),
+		glm::quat::wxyz(0.0f, 0.70710678f, -0.70710678f, 0.0f), glm::quat::wxyz(-0.70710678f, 0.0f, 0.0f, 0.70710678f)};
+
+	std::mt19937 Rng(5);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	std::vector<glm::quat> Values(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec4 v(0.0f);
+		while(glm::dot(v, v) < 1e-4f)
+			for(glm::length_t c = 0; c < 4; ++c)
+				v[c] = Unit(Rng);
+		v = glm::normalize(v);
+		Values[i] = i % 5 == 0 ? Specials[(i / 5) % (sizeof(Specials) / sizeof(Specials[0]))] : glm::quat::wxyz(v.w, v.x, v.y, v.z);
+	}
+	return Values;
+}
+
+template<typename packedType>
+static int test_octahedral(packedType (*Pack)(glm::vec3 const&), glm::vec3 (*Unpack)(packedType), std::vector<glm::vec3> const& Values, float MaxDegrees)
+{
+	int Error = 0;
+
+	float MaxError = 0.0f;
+	for(std::size_t i = 0; i < Values.size(); ++i)
+	{
+		glm::vec3 const v = glm::normalize(Values[i]);
+		glm::vec3 const Result = Unpack(Pack(Values[i]));
+		Error += glm::abs(glm::length(Result) - 1.0f) < 1e-6f ? 0 : 1;
+		glm::dvec3 const a(v);
+		glm::dvec3 const b(Result);
+		MaxError = glm::max(MaxError, static_cast<float>(glm::degrees(std::atan2(glm::length(glm::cross(a, b)), glm::dot(a, b)))));
+	}
+	Error += MaxError < MaxDegrees ? 0 : 1;
+
+	// The axes are exact
+	for(glm::length_t c = 0; c < 3; ++c)
+	{
+		glm::vec3 Axis(0.0f);
+		Axis[c] = 1.0f;
+		Error += Unpack(Pack(Axis)) == Axis ? 0 : 1;
+		Error += Unpack(Pack(-Axis)) == -Axis ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename packedType>
+static int test_smallest_three(packedType (*Pack)(glm::quat const&), glm::quat (*Unpack)(packedType), std::vector<glm::quat> const& Values, float MaxError)
+{
+	int Error = 0;
+
+	float Largest = 0.0f;
+	for(std::size_t i = 0; i < Values.size(); ++i)
+	{
+		glm::quat const q = Values[i];
+		glm::quat const Result = Unpack(Pack(q));
+		glm::vec4 const a(q.x, q.y, q.z, q.w);
+		glm::vec4 b(Result.x, Result.y, Result.z, Result.w);
+
+		// q and -q are the same rotation, the encoding picks one
+		if(glm::dot(a, b) < 0.0f)
+			b = -b;
+		glm::vec4 const Diff = glm::abs(a - b);
+		Largest = glm::max(Largest, glm::max(glm::max(Diff.x, Diff.y), glm::max(Diff.z, Diff.w)));
+		Error += glm::abs(glm::dot(b, b) - 1.0f) < 1e-5f ? 0 : 1;
+	}
+	Error += Largest < MaxError ? 0 : 1;
+
+	// Identity and the axis rotations are exact
+	Error += Unpack(Pack(glm::quat::wxyz(1, 0, 0, 0))) == glm::quat::wxyz(1, 0, 0, 0) ? 0 : 1;
+	Error += Unpack(Pack(glm::quat::wxyz(0, 0, -1, 0))) == glm::quat::wxyz(0, 0, 1, 0) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_packed_arrays()
+{
+	int Error = 0;
+
+	// Odd counts so the remainder block runs
+	std::size_t const Count = 4099;
+	std::vector<glm::vec2> const Vec2 = packed_array_values<glm::vec2>(Count, true);
+	std::vector<glm::vec3> const Vec3 = packed_array_values<glm::vec3>(Count, true);
+	std::vector<glm::vec4> const Vec4 = packed_array_values<glm::vec4>(Count, true);
+	std::vector<glm::vec3> const Floats = packed_array_values<glm::vec3>(Count, false);
+	std::vector<glm::vec3> NotNan(Floats);
+	for(std::size_t i = 0; i < NotNan.size(); ++i)
+		NotNan[i] = glm::mix(NotNan[i], glm::vec3(0.0f), glm::isnan(NotNan[i]));
+	std::vector<glm::uint16> const Patterns16 = packed_array_patterns<glm::uint16>(65536 + 3);
+	std::vector<glm::uint32> const Patterns32 = packed_array_patterns<glm::uint32>(Count);
+	std::vector<glm::uint64> const Patterns64 = packed_array_patterns<glm::uint64>(Count);
+
+	Error += test_packed_array<glm::vec4, glm::uint32>(glm::packUnorm4x8, glm::unpackUnorm4x8, glm::packUnorm4x8, glm::unpackUnorm4x8, Vec4, Patterns32);
+	Error += test_packed_array<glm::vec4, glm::uint32>(glm::packSnorm4x8, glm::unpackSnorm4x8, glm::packSnorm4x8, glm::unpackSnorm4x8, Vec4, Patterns32);
+	Error += test_packed_array<glm::vec2, glm::uint32>(glm::packUnorm2x16, glm::unpackUnorm2x16, glm::packUnorm2x16, glm::unpackUnorm2x16, Vec2, Patterns32);
+	Error += test_packed_array<glm::vec2, glm::uint32>(glm::packSnorm2x16, glm::unpackSnorm2x16, glm::packSnorm2x16, glm::unpackSnorm2x16, Vec2, Patterns32);
+	Error += test_packed_array<glm::vec4, glm::uint64>(glm::packUnorm4x16, glm::unpackUnorm4x16, glm::packUnorm4x16, glm::unpackUnorm4x16, Vec4, Patterns64);
+	Error += test_packed_array<glm::vec4, glm::uint64>(glm::packSnorm4x16, glm::unpackSnorm4x16, glm::packSnorm4x16, glm::unpackSnorm4x16, Vec4, Patterns64);
+	Error += test_packed_array<glm::vec4, glm::uint32>(glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2, glm::packUnorm3x10_1x2, glm::unpackUnorm3x10_1x2, Vec4, Patterns32);
+	Error += test_packed_array<glm::vec4, glm::uint32>(glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2, glm::packSnorm3x10_1x2, glm::unpackSnorm3x10_1x2, Vec4, Patterns32);
+	Error += test_packed_array<glm::vec3, glm::uint16>(glm::packUnorm1x5_1x6_1x5, glm::unpackUnorm1x5_1x6_1x5, glm::packUnorm1x5_1x6_1x5, glm::unpackUnorm1x5_1x6_1x5, Vec3, Patterns16);
+	Error += test_packed_array<glm::vec3, glm::uint32>(glm::packF2x11_1x10, glm::unpackF2x11_1x10, glm::packF2x11_1x10, glm::unpackF2x11_1x10, Floats, Patterns32);
+	Error += test_packed_array<glm::vec3, glm::uint32>(glm::packF3x9_E1x5, glm::unpackF3x9_E1x5, glm::packF3x9_E1x5, glm::unpackF3x9_E1x5, NotNan, Patterns32);
+	Error += test_packed_array<glm::vec3, glm::uint32>(glm::packF3x9_E1x5, glm::unpackF3x9_E1x5, glm::packF3x9_E1x5, glm::unpackF3x9_E1x5, Vec3, Patterns32);
+
+	std::vector<glm::vec3> const Directions = packed_array_directions(Count);
+	std::vector<glm::quat> const Quats = packed_array_quats(Count);
+	Error += test_packed_array<glm::vec3, glm::uint16>(glm::packOctahedral16, glm::unpackOctahedral16, glm::packOctahedral16, glm::unpackOctahedral16, Directions, Patterns16, 1e-6f);
+	Error += test_packed_array<glm::vec3, glm::uint32>(glm::packOctahedral24, glm::unpackOctahedral24, glm::packOctahedral24, glm::unpackOctahedral24, Directions, Patterns32, 1e-6f);
+	Error += test_packed_array<glm::vec3, glm::uint32>(glm::packOctahedral32, glm::unpackOctahedral32, glm::packOctahedral32, glm::unpackOctahedral32, Directions, Patterns32, 1e-6f);
+	Error += test_packed_array<glm::quat, glm::uint32>(glm::packQuat32, glm::unpackQuat32, glm::packQuat32, glm::unpackQuat32, Quats, Patterns32, 1e-6f);
+	Error += test_packed_array<glm::quat, glm::uint64>(glm::packQuat48, glm::unpackQuat48, glm::packQuat48, glm::unpackQuat48, Quats, Patterns64, 1e-6f);
+	Error += test_packed_array<glm::quat, glm::uint64>(glm::packQuat64, glm::unpackQuat64, glm::packQuat64, glm::unpackQuat64, Quats, Patterns64, 1e-6f);
+
+	// Default strides
+	glm::uint32 Normals[3];
+	glm::packSnorm3x10_1x2(Vec4.data(), Normals, 3);
+	glm::vec4 Back[3];
+	glm::unpackSnorm3x10_1x2(Normals, Back, 3);
+	for(std::size_t i = 0; i < 3; ++i)
+		Error += glm::all(glm::equal(Back[i], glm::unpackSnorm3x10_1x2(glm::packSnorm3x10_1x2(Vec4[i])), 0.0f)) ? 0 : 1;
+
+	// Small float zero, infinity and NaN fields decode on their own
+	glm::vec3 const Special = glm::unpackF2x11_1x10((0x7C0u << 0) | (0x7FFu << 11) | (0x001u << 22));
+	Error += std::isinf(Special.x) && std::isnan(Special.y) && Special.z > 0.0f ? 0 : 1;
+	Error += glm::unpackF2x11_1x10(0x7C0u << 11).x == 0.0f ? 0 : 1;
+
+	return Error;
+}
+
+static int test_octahedral()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> const Directions = packed_array_directions(100000);
+	Error += test_octahedral<glm::uint16>(glm::packOctahedral16, glm::unpackOctahedral16, Directions, 1.0f);
+	Error += test_octahedral<glm::uint32>(glm::packOctahedral24, glm::unpackOctahedral24, Directions, 0.065f);
+	Error += test_octahedral<glm::uint32>(glm::packOctahedral32, glm::unpackOctahedral32, Directions, 0.004f);
+
+	// Unnormalized input, -z in the folded corners
+	Error += glm::all(glm::equal(glm::unpackOctahedral16(glm::packOctahedral16(glm::vec3(0, 0, -4))), glm::vec3(0, 0, -1), 0.0f)) ? 0 : 1;
+	Error += glm::packOctahedral32(glm::vec3(0, 0, 2)) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_smallest_three()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const Quats = packed_array_quats(100000);
+	Error += test_smallest_three<glm::uint32>(glm::packQuat32, glm::unpackQuat32, Quats, 2e-3f);
+	Error += test_smallest_three<glm::uint64>(glm::packQuat48, glm::unpackQuat48, Quats, 7e-5f);
+	Error += test_smallest_three<glm::uint64>(glm::packQuat64, glm::unpackQuat64, Quats, 2e-6f);
+
+	// Index of the largest component in the top bits
+	Error += glm::packQuat32(glm::quat::wxyz(0.5f, 0.5f, 0.5f, 0.5f)) >> 30 == 0 ? 0 : 1;
+	Error += glm::packQuat32(glm::quat::wxyz(1, 0, 0, 0)) >> 30 == 3 ? 0 : 1;
+	Error += (glm::packQuat48(glm::quat::wxyz(0, 0, 1, 0)) >> 45) == 1 ? 0 : 1;
+	Error += (glm::packQuat64(glm::quat::wxyz(0, 0, 0, 1)) >> 60) == 2 ? 0 : 1;
+
+	return Error;
+}
+
 static int test_I3x10_1x2()
 {
 	int Error = 0;
@@ -874,6 +1236,10 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_Half_array();
+	Error += test_packed_arrays();
+	Error += test_octahedral();
+	Error += test_smallest_three();
 
 	return Error;
 }
@@ -0,0 +1,191 @@
+#include <glm/gtc/quaternion_batch.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/geometric.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Random unit quaternions, with rotations of 0, 90 and 180 degrees about the
+// axes mixed in: these pick each of the four cases of quat_cast and tie some
+// of them
+static std::vector<glm::quat> make_quats(std::size_t Count, glm::uint32 Seed)
+{
+	float const h = glm::one_over_root_two<float>();
+	glm::quat const Special[] = {
+		glm::quat::wxyz(1.0f, 0.0f, 0.0f, 0.0f),
+		glm::quat::wxyz(0.0f, 1.0f, 0.0f, 0.0f),
+		glm::quat::wxyz(0.0f, 0.0f, 1.0f, 0.0f),
+		glm::quat::wxyz(0.0f, 0.0f, 0.0f, 1.0f),
+		glm::quat::wxyz(h, h, 0.0f, 0.0f),
+		glm::quat::wxyz(h, 0.0f, -h, 0.0f),
+		glm::quat::wxyz(h, 0.0f, 0.0f, h),
+		glm::quat::wxyz(0.0f, h, h, 0.0f),
+		glm::quat::wxyz(0.0f, 0.0f, h, -h)};
+
+	std::mt19937 Rng(Seed);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	std::vector<glm::quat> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		if(i % 5 == 0)
+		{
+			Result[i] = Special[(i / 5) % (sizeof(Special) / sizeof(Special[0]))];
+			continue;
+		}
+		glm::vec4 v(0.0f);
+		while(glm::dot(v, v) < 1e-3f)
+			v = glm::vec4(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng));
+		v = glm::normalize(v);
+		Result[i] = glm::quat::wxyz(v.w, v.x, v.y, v.z);
+	}
+	return Result;
+}
+
+static std::vector<glm::vec3> make_translations(std::size_t Count, glm::uint32 Seed)
+{
+	std::mt19937 Rng(Seed);
+	std::uniform_real_distribution<float> Offset(-100.0f, 100.0f);
+	std::vector<glm::vec3> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = glm::vec3(Offset(Rng), Offset(Rng), Offset(Rng));
+	return Result;
+}
+
+static int test_mat_cast(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const q = make_quats(Count, 1);
+	std::vector<glm::vec3> const t = make_translations(Count, 2);
+
+	std::vector<glm::mat3> Out3(Count);
+	glm::batch::mat3_cast(q.data(), Out3.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out3[i], glm::mat3_cast(q[i]), 1e-6f)) ? 0 : 1;
+
+	std::vector<glm::mat4> Out4(Count);
+	glm::batch::mat4_cast(q.data(), Out4.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out4[i], glm::mat4_cast(q[i]), 1e-6f)) ? 0 : 1;
+
+	std::vector<glm::mat4x3> Palette(Count);
+	glm::batch::mat4x3_cast(q.data(), t.data(), Palette.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat4 const Expected = glm::translate(glm::mat4(1.0f), t[i]) * glm::mat4_cast(q[i]);
+		Error += glm::all(glm::equal(glm::mat4(Palette[i]), Expected, 1e-6f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Same input, same expressions: the results match quat_cast exactly
+static int test_quat_cast(std::size_t Count)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const q = make_quats(Count, 3);
+	std::vector<glm::mat3> m3(Count);
+	std::vector<glm::mat4> m4(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		m3[i] = glm::mat3_cast(q[i]);
+		m4[i] = glm::mat4_cast(q[i]);
+	}
+
+	std::vector<glm::quat> Out(Count);
+	glm::batch::quat_cast(m3.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Out[i] == glm::quat_cast(m3[i]) ? 0 : 1;
+		Error += glm::abs(glm::dot(Out[i], q[i])) > 0.99999f ? 0 : 1;
+	}
+
+	glm::batch::quat_cast(m4.data(), Out.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Out[i] == glm::quat_cast(m4[i]) ? 0 : 1;
+
+	return Error;
+}
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+// Copied element by element, the aligned and packed matrices need not share a layout
+template<glm::length_t C, glm::qualifier Q>
+static glm::mat<C, C, float, glm::defaultp> to_packed(glm::mat<C, C, float, Q> const& m)
+{
+	glm::mat<C, C, float, glm::defaultp> Result(1.0f);
+	for(glm::length_t c = 0; c < C; ++c)
+	for(glm::length_t r = 0; r < C; ++r)
+		Result[c][r] = m[c][r];
+	return Result;
+}
+
+// The per-element functions for aligned types
+static int test_aligned()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const q = make_quats(257, 4);
+	for(std::size_t i = 0; i < q.size(); ++i)
+	{
+		glm::aligned_quat const a = glm::aligned_quat::wxyz(q[i].w, q[i].x, q[i].y, q[i].z);
+
+		glm::aligned_mat3 const m3 = glm::mat3_cast(a);
+		Error += glm::all(glm::equal(to_packed(m3), glm::mat3_cast(q[i]), 1e-6f)) ? 0 : 1;
+		glm::aligned_mat4 const m4 = glm::mat4_cast(a);
+		Error += glm::all(glm::equal(to_packed(m4), glm::mat4_cast(q[i]), 1e-6f)) ? 0 : 1;
+
+		glm::quat const Expected = glm::quat_cast(to_packed(m3));
+		glm::aligned_quat const r3 = glm::quat_cast(m3);
+		glm::aligned_quat const r4 = glm::quat_cast(m4);
+		Error += glm::quat::wxyz(r3.w, r3.x, r3.y, r3.z) == Expected ? 0 : 1;
+		Error += glm::quat::wxyz(r4.w, r4.x, r4.y, r4.z) == Expected ? 0 : 1;
+	}
+
+	return Error;
+}
+#endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	std::vector<glm::quat> const q = make_quats(9, 5);
+	std::vector<glm::vec3> const t = make_translations(9, 6);
+	std::vector<glm::mat4x3> Palette(9), Expected(9);
+
+	glm::batch::mat4x3_cast(std::span<glm::quat const>(q), std::span<glm::vec3 const>(t), std::span<glm::mat4x3>(Palette));
+	glm::batch::mat4x3_cast(q.data(), t.data(), Expected.data(), 9);
+	for(std::size_t i = 0; i < 9; ++i)
+		Error += Palette[i] == Expected[i] ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	// Odd counts so both the wide loop and the padded remainder are exercised
+	Error += test_mat_cast(1031);
+	Error += test_mat_cast(3);
+	Error += test_quat_cast(1031);
+	Error += test_quat_cast(3);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	Error += test_aligned();
+#	endif
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
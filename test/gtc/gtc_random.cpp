@@ -1,9 +1,13 @@
-#ifndef GLM_FORCE_PURE
+// Aligned 2-component integer vectors do not build with intrinsics
+#if !defined(GLM_FORCE_PURE) && !defined(GLM_FORCE_INTRINSICS)
 #define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
 #endif
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
 #endif
@@ -324,6 +328,428 @@ static int test_ballRand()
 
 	return Error;
 }
+
+static int test_gaussRand()
+{
+	int Error = 0;
+
+	{
+		double Mean = 0.0, Deviation = 0.0;
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			double const G = glm::gaussRand(1.0, 3.0);
+			Mean += G;
+			Deviation += (G - 1.0) * (G - 1.0);
+		}
+
+		Error += glm::epsilonEqual(Mean / double(TestSamples), 1.0, 0.2) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::sqrt(Deviation / double(TestSamples)), 3.0, 0.2) ? 0 : 1;
+		assert(!Error);
+	}
+
+	{
+		glm::dvec2 Deviation(0.0);
+		for(std::size_t i = 0; i < TestSamples; ++i)
+		{
+			glm::vec2 const G = glm::gaussRand(glm::vec2(0.0f), glm::vec2(0.5f, 2.0f));
+			Deviation += glm::dvec2(G) * glm::dvec2(G);
+		}
+
+		Error += glm::all(glm::epsilonEqual(glm::sqrt(Deviation / double(TestSamples)), glm::dvec2(0.5, 2.0), 0.1)) ? 0 : 1;
+		assert(!Error);
+	}
+
+	return Error;
+}
+
+// Reference xoshiro128++, one stream
+struct xoshiro128pp
+{
+	glm::uint32 s[4];
+
+	static glm::uint32 rotl(glm::uint32 x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	glm::uint32 next()
+	{
+		glm::uint32 const Result = rotl(s[0] + s[3], 7) + s[0];
+		glm::uint32 const t = s[1] << 9;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 11);
+		return Result;
+	}
+};
+
+// The interleaved streams, whether stepped one value, one block or many blocks at a time
+static int test_xoshiro128x8()
+{
+	int Error = 0;
+
+	glm::xoshiro128x8 Generator(42, 7);
+	xoshiro128pp Lanes[8];
+	for(int l = 0; l < 8; ++l)
+	for(int w = 0; w < 4; ++w)
+		Lanes[l].s[w] = Generator.state[w][l];
+
+	std::vector<glm::uint32> Values(1000);
+	for(std::size_t i = 0; i < 5; ++i)
+		Values[i] = Generator();
+	Generator.generate(&Values[5], 800);
+	Generator.generate(&Values[805], 3);
+	Generator.generate(&Values[808], Values.size() - 808);
+
+	for(std::size_t i = 0; i < Values.size(); ++i)
+		Error += Values[i] == Lanes[i % 8].next() ? 0 : 1;
+
+	// Same floats as the 24 high bits of the values
+	glm::xoshiro128x8 A(3), B(3);
+	std::vector<float> Floats(203);
+	A.generate(&Floats[0], 1);
+	A.generate(&Floats[1], Floats.size() - 1);
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+	{
+		Error += Floats[i] == static_cast<float>(B() >> 8) / 16777216.0f ? 0 : 1;
+		Error += Floats[i] >= 0.0f && Floats[i] < 1.0f ? 0 : 1;
+	}
+
+	// Seeds and streams
+	glm::xoshiro128x8 C(3), D(3, 1), E(4);
+	Error += A() == B() ? 0 : 1;
+	Error += C() != D() ? 0 : 1;
+	Error += glm::xoshiro128x8(3)() != E() ? 0 : 1;
+	C.seed(4);
+	E.seed(4);
+	Error += C() == E() ? 0 : 1;
+
+	return Error;
+}
+
+template<typename genRNG>
+static int test_generator_distributions(genRNG& Generator)
+{
+	int Error = 0;
+
+	std::size_t const Count = 20000;
+
+	// Integer bounds are reached, including the full range
+	{
+		glm::i8vec2 Min(127), Max(-128);
+		glm::uint32 Low = ~0u, High = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::i8vec2 const A = glm::linearRand(glm::i8vec2(-128, -3), glm::i8vec2(127, 2), Generator);
+			Min = glm::min(Min, A);
+			Max = glm::max(Max, A);
+			glm::uint32 const B = glm::linearRand(glm::uint32(0), glm::uint32(~0u), Generator);
+			Low = glm::min(Low, B);
+			High = glm::max(High, B);
+			glm::int64 const C = glm::linearRand(glm::int64(-5), glm::int64(5), Generator);
+			Error += C >= -5 && C <= 5 ? 0 : 1;
+		}
+		Error += Min == glm::i8vec2(-128, -3) ? 0 : 1;
+		Error += Max == glm::i8vec2(127, 2) ? 0 : 1;
+		Error += Low < 0x01000000u && High > 0xFF000000u ? 0 : 1;
+	}
+
+	// Moments of the real distributions
+	{
+		double Sum = 0.0, Gauss = 0.0, Gauss2 = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			double const A = glm::linearRand(-2.0, 6.0, Generator);
+			Error += A >= -2.0 && A < 6.0 ? 0 : 1;
+			Sum += A;
+
+			float const G = glm::gaussRand(1.0f, 3.0f, Generator);
+			Gauss += G;
+			Gauss2 += (G - 1.0) * (G - 1.0);
+		}
+		Error += glm::epsilonEqual(Sum / Count, 2.0, 0.1) ? 0 : 1;
+		Error += glm::epsilonEqual(Gauss / Count, 1.0, 0.1) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::sqrt(Gauss2 / Count), 3.0, 0.1) ? 0 : 1;
+
+		glm::dvec3 Mean(0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+			Mean += glm::dvec3(glm::gaussRand(glm::vec3(-1, 0, 1), glm::vec3(0.5f), Generator));
+		Error += glm::all(glm::epsilonEqual(Mean / double(Count), glm::dvec3(-1, 0, 1), 0.05)) ? 0 : 1;
+	}
+
+	// Points on and in circles and spheres, centered on average
+	{
+		glm::dvec2 Circle(0.0), Disk(0.0);
+		glm::dvec3 Sphere(0.0), Ball(0.0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec2 const C = glm::circularRand(2.0f, Generator);
+			glm::dvec3 const S = glm::sphericalRand(2.0, Generator);
+			glm::vec2 const D = glm::diskRand(2.0f, Generator);
+			glm::vec3 const B = glm::ballRand(2.0f, Generator);
+			Error += glm::epsilonEqual(glm::length(C), 2.0f, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(S), 2.0, 0.0001) ? 0 : 1;
+			Error += glm::length(D) <= 2.0001f ? 0 : 1;
+			Error += glm::length(B) <= 2.0001f ? 0 : 1;
+			Circle += glm::dvec2(C);
+			Sphere += S;
+			Disk += glm::dvec2(D);
+			Ball += glm::dvec3(B);
+		}
+		Error += glm::length(Circle / double(Count)) < 0.05 ? 0 : 1;
+		Error += glm::length(Sphere / double(Count)) < 0.05 ? 0 : 1;
+		Error += glm::length(Disk / double(Count)) < 0.05 ? 0 : 1;
+		Error += glm::length(Ball / double(Count)) < 0.05 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Bulk fills match the scalar functions drawing from the same generator
+template<typename genRNG>
+static int test_batch(genRNG const& Seeded)
+{
+	int Error = 0;
+
+	for(std::size_t Count = 0; Count < 40; Count += 13)
+	{
+		genRNG A(Seeded), B(Seeded);
+
+		std::vector<float> Floats(Count);
+		glm::batch::linearRand(Floats.data(), Count, -3.0f, 5.0f, A);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::epsilonEqual(Floats[i], glm::linearRand(-3.0f, 5.0f, B), 0.00001f) ? 0 : 1;
+
+		std::vector<glm::vec3> Vectors(Count);
+		glm::batch::linearRand(Vectors.data(), Count, glm::vec3(-1, 0, 1), glm::vec3(1, 2, 5), A);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(Vectors[i], glm::linearRand(glm::vec3(-1, 0, 1), glm::vec3(1, 2, 5), B), 0.00001f)) ? 0 : 1;
+
+		std::vector<glm::dvec4> Doubles(Count);
+		glm::batch::linearRand(Doubles.data(), Count, glm::dvec4(-1), glm::dvec4(1), A);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::epsilonEqual(Doubles[i], glm::linearRand(glm::dvec4(-1), glm::dvec4(1), B), 1e-12)) ? 0 : 1;
+	}
+
+	{
+		genRNG Generator(Seeded);
+		std::size_t const Count = 20001;
+		std::vector<float> Gauss(Count);
+		glm::batch::gaussRand(Gauss.data(), Count, -2.0f, 0.5f, Generator);
+
+		double Sum = 0.0, Sum2 = 0.0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Gauss[i];
+			Sum2 += (Gauss[i] + 2.0) * (Gauss[i] + 2.0);
+		}
+		Error += glm::epsilonEqual(Sum / Count, -2.0, 0.02) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::sqrt(Sum2 / Count), 0.5, 0.02) ? 0 : 1;
+	}
+
+#	if GLM_HAS_SPAN
+	{
+		genRNG A(Seeded), B(Seeded);
+		std::vector<glm::vec2> Spans(21), Expected(21);
+		glm::batch::linearRand(std::span<glm::vec2>(Spans), glm::vec2(0), glm::vec2(1), A);
+		glm::batch::linearRand(Expected.data(), Expected.size(), glm::vec2(0), glm::vec2(1), B);
+		Error += Spans == Expected ? 0 : 1;
+
+		std::vector<float> Gauss(9), GaussExpected(9);
+		glm::batch::gaussRand(std::span<float>(Gauss), 0.0f, 1.0f, A);
+		glm::batch::gaussRand(GaussExpected.data(), GaussExpected.size(), 0.0f, 1.0f, B);
+		Error += Gauss == GaussExpected ? 0 : 1;
+	}
+#	endif//GLM_HAS_SPAN
+
+	return Error;
+}
+
+static int test_generators()
+{
+	int Error = 0;
+
+	glm::xoshiro128x8 Xoshiro(1234);
+	std::mt19937 Twister(1234);
+
+	Error += test_xoshiro128x8();
+	Error += test_generator_distributions(Xoshiro);
+	Error += test_generator_distributions(Twister);
+	Error += test_batch(Xoshiro);
+	Error += test_batch(Twister);
+
+	return Error;
+}
+
+// Known answers of Philox4x32-10, from the Random123 test vectors
+static int test_philox4x32()
+{
+	int Error = 0;
+
+	glm::philox4x32 Zero(0);
+	Error += Zero(0) == glm::uvec4(0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u) ? 0 : 1;
+
+	glm::philox4x32 Ones(0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull);
+	Error += Ones(0xFFFFFFFFFFFFFFFFull) == glm::uvec4(0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu) ? 0 : 1;
+
+	glm::philox4x32 Pi(0x299f31d0a4093822ull, 0x0370734413198a2eull);
+	Error += Pi(0x85a308d3243f6a88ull) == glm::uvec4(0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u) ? 0 : 1;
+
+	// Seeds and streams
+	Error += glm::philox4x32(1)(5) == glm::philox4x32(1)(5) ? 0 : 1;
+	Error += glm::philox4x32(1)(5) != glm::philox4x32(2)(5) ? 0 : 1;
+	Error += glm::philox4x32(1)(5) != glm::philox4x32(1, 1)(5) ? 0 : 1;
+	Error += glm::philox4x32(1)(5) != glm::philox4x32(1)(6) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_counter_distributions()
+{
+	int Error = 0;
+
+	glm::philox4x32 const Generator(99);
+	glm::uint64 const First = 0xFFFFFFF0ull;
+	std::size_t const Count = 20000;
+
+	double Sum = 0.0, Gauss = 0.0, Gauss2 = 0.0;
+	glm::dvec2 Circle(0.0), Disk(0.0);
+	glm::dvec3 Sphere(0.0), Ball(0.0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::uint64 const Index = First + i;
+
+		float const A = glm::linearRand(-2.0f, 6.0f, Generator, Index);
+		Error += A >= -2.0f && A < 6.0f ? 0 : 1;
+		Sum += A;
+
+		double const G = glm::gaussRand(1.0, 3.0, Generator, Index);
+		Gauss += G;
+		Gauss2 += (G - 1.0) * (G - 1.0);
+
+		glm::vec2 const C = glm::circularRand(2.0f, Generator, Index);
+		glm::vec3 const S = glm::sphericalRand(2.0f, Generator, Index);
+		glm::vec2 const D = glm::diskRand(2.0f, Generator, Index);
+		glm::dvec3 const B = glm::ballRand(2.0, Generator, Index);
+		Error += glm::epsilonEqual(glm::length(C), 2.0f, 0.0001f) ? 0 : 1;
+		Error += glm::epsilonEqual(glm::length(S), 2.0f, 0.0001f) ? 0 : 1;
+		Error += glm::length(D) <= 2.0001f ? 0 : 1;
+		Error += glm::length(B) <= 2.0001 ? 0 : 1;
+		Circle += glm::dvec2(C);
+		Sphere += glm::dvec3(S);
+		Disk += glm::dvec2(D);
+		Ball += B;
+	}
+	Error += glm::epsilonEqual(Sum / Count, 2.0, 0.1) ? 0 : 1;
+	Error += glm::epsilonEqual(Gauss / Count, 1.0, 0.1) ? 0 : 1;
+	Error += glm::epsilonEqual(glm::sqrt(Gauss2 / Count), 3.0, 0.1) ? 0 : 1;
+	Error += glm::length(Circle / double(Count)) < 0.05 ? 0 : 1;
+	Error += glm::length(Sphere / double(Count)) < 0.05 ? 0 : 1;
+	Error += glm::length(Disk / double(Count)) < 0.05 ? 0 : 1;
+	Error += glm::length(Ball / double(Count)) < 0.05 ? 0 : 1;
+
+	// Uniform radii of disks and balls: half the points within 1/sqrt(2) and 1/cbrt(2) of the radius
+	std::size_t InnerDisk = 0, InnerBall = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		InnerDisk += glm::length(glm::diskRand(1.0f, Generator, i)) < 0.70710678f ? 1 : 0;
+		InnerBall += glm::length(glm::ballRand(1.0f, Generator, i)) < 0.79370053f ? 1 : 0;
+	}
+	Error += InnerDisk > Count * 48 / 100 && InnerDisk < Count * 52 / 100 ? 0 : 1;
+	Error += InnerBall > Count * 48 / 100 && InnerBall < Count * 52 / 100 ? 0 : 1;
+
+	glm::vec4 const V = glm::linearRand(glm::vec4(0), glm::vec4(1, 2, 3, 4), Generator, 7);
+	Error += V == glm::vec4(glm::linearRand(0.0f, 1.0f, Generator, 28), glm::linearRand(0.0f, 2.0f, Generator, 29),
+		glm::linearRand(0.0f, 3.0f, Generator, 30), glm::linearRand(0.0f, 4.0f, Generator, 31)) ? 0 : 1;
+
+	return Error;
+}
+
+struct counter_ranges
+{
+	std::vector<float> Linear, Gauss;
+	std::vector<glm::vec2> Circle, Disk;
+	std::vector<glm::vec3> Sphere, Ball;
+
+	explicit counter_ranges(std::size_t Count) :
+		Linear(Count), Gauss(Count), Circle(Count), Disk(Count), Sphere(Count), Ball(Count)
+	{}
+
+	void generate(glm::philox4x32 const& Generator, glm::uint64 First, std::size_t Begin, std::size_t End)
+	{
+		std::size_t const Count = End - Begin;
+		glm::batch::linearRand(&Linear[Begin], Count, -1.0f, 3.0f, Generator, First + Begin);
+		glm::batch::gaussRand(&Gauss[Begin], Count, 0.5f, 2.0f, Generator, First + Begin);
+		glm::batch::circularRand(&Circle[Begin], Count, 2.0f, Generator, First + Begin);
+		glm::batch::diskRand(&Disk[Begin], Count, 2.0f, Generator, First + Begin);
+		glm::batch::sphericalRand(&Sphere[Begin], Count, 2.0f, Generator, First + Begin);
+		glm::batch::ballRand(&Ball[Begin], Count, 2.0f, Generator, First + Begin);
+	}
+};
+
+// Bulk ranges match the scalar functions, and do not depend on how they are split
+static int test_counter_batch()
+{
+	int Error = 0;
+
+	glm::philox4x32 const Generator(7, 3);
+	glm::uint64 const First = 0xFFFFFF85ull;
+	std::size_t const Count = 1000;
+
+	counter_ranges Whole(Count);
+	Whole.generate(Generator, First, 0, Count);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::uint64 const Index = First + i;
+		Error += glm::epsilonEqual(Whole.Linear[i], glm::linearRand(-1.0f, 3.0f, Generator, Index), 0.00001f) ? 0 : 1;
+		Error += glm::epsilonEqual(Whole.Gauss[i], glm::gaussRand(0.5f, 2.0f, Generator, Index), 0.0001f) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Whole.Circle[i], glm::circularRand(2.0f, Generator, Index), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Whole.Disk[i], glm::diskRand(2.0f, Generator, Index), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Whole.Sphere[i], glm::sphericalRand(2.0f, Generator, Index), 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Whole.Ball[i], glm::ballRand(2.0f, Generator, Index), 0.0001f)) ? 0 : 1;
+	}
+
+	// Jobs of uneven sizes
+	counter_ranges Split(Count);
+	std::size_t const Bounds[] = {0, 1, 6, 7, 70, 201, 202, 333, 599, 999, Count};
+	for(std::size_t i = 0; i + 1 < sizeof(Bounds) / sizeof(Bounds[0]); ++i)
+		Split.generate(Generator, First, Bounds[i], Bounds[i + 1]);
+
+	Error += Split.Linear == Whole.Linear ? 0 : 1;
+	Error += Split.Gauss == Whole.Gauss ? 0 : 1;
+	Error += Split.Circle == Whole.Circle ? 0 : 1;
+	Error += Split.Disk == Whole.Disk ? 0 : 1;
+	Error += Split.Sphere == Whole.Sphere ? 0 : 1;
+	Error += Split.Ball == Whole.Ball ? 0 : 1;
+
+#	if GLM_HAS_SPAN
+	{
+		counter_ranges Spans(21);
+		glm::batch::linearRand(std::span<float>(Spans.Linear), -1.0f, 3.0f, Generator, First);
+		glm::batch::gaussRand(std::span<float>(Spans.Gauss), 0.5f, 2.0f, Generator, First);
+		glm::batch::circularRand(std::span<glm::vec2>(Spans.Circle), 2.0f, Generator, First);
+		glm::batch::diskRand(std::span<glm::vec2>(Spans.Disk), 2.0f, Generator, First);
+		glm::batch::sphericalRand(std::span<glm::vec3>(Spans.Sphere), 2.0f, Generator, First);
+		glm::batch::ballRand(std::span<glm::vec3>(Spans.Ball), 2.0f, Generator, First);
+		for(std::size_t i = 0; i < 21; ++i)
+		{
+			Error += Spans.Linear[i] == Whole.Linear[i] ? 0 : 1;
+			Error += Spans.Gauss[i] == Whole.Gauss[i] ? 0 : 1;
+			Error += Spans.Circle[i] == Whole.Circle[i] ? 0 : 1;
+			Error += Spans.Disk[i] == Whole.Disk[i] ? 0 : 1;
+			Error += Spans.Sphere[i] == Whole.Sphere[i] ? 0 : 1;
+			Error += Spans.Ball[i] == Whole.Ball[i] ? 0 : 1;
+		}
+	}
+#	endif//GLM_HAS_SPAN
+
+	return Error;
+}
+
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -374,6 +800,11 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_gaussRand();
+	Error += test_generators();
+	Error += test_philox4x32();
+	Error += test_counter_distributions();
+	Error += test_counter_batch();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
@@ -0,0 +1,194 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/dual_quaternion_batch.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/geometric.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+static glm::quat next_quat(std::mt19937& Rng)
+{
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	glm::vec4 v(0.0f);
+	while(glm::dot(v, v) < 1e-3f)
+		v = glm::vec4(Unit(Rng), Unit(Rng), Unit(Rng), Unit(Rng));
+	v = glm::normalize(v);
+	return glm::quat::wxyz(v.w, v.x, v.y, v.z);
+}
+
+static glm::vec3 next_vec3(std::mt19937& Rng, float Scale)
+{
+	std::uniform_real_distribution<float> Unit(-Scale, Scale);
+	return glm::vec3(Unit(Rng), Unit(Rng), Unit(Rng));
+}
+
+struct skin_data
+{
+	std::vector<glm::dualquat> Bones;
+	std::vector<glm::uint16> Indices;
+	std::vector<float> Weights;
+	std::vector<glm::vec3> Positions;
+	std::vector<glm::vec3> Normals;
+};
+
+// Weights normalized to 1, and every other bone stored with the opposite
+// sign, as a rotation track crossing hemispheres would leave it
+static skin_data make_skin(std::size_t Count, glm::length_t Influences, glm::uint32 Seed)
+{
+	std::mt19937 Rng(Seed);
+	skin_data Data;
+	for(std::size_t b = 0; b < 37; ++b)
+	{
+		glm::dualquat const Bone(next_quat(Rng), next_vec3(Rng, 10.0f));
+		Data.Bones.push_back(b % 2 ? -Bone : Bone);
+	}
+
+	std::uniform_int_distribution<int> Index(0, static_cast<int>(Data.Bones.size()) - 1);
+	std::uniform_real_distribution<float> Weight(1e-2f, 1.01f);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float Sum = 0.0f;
+		for(glm::length_t k = 0; k < Influences; ++k)
+		{
+			Data.Indices.push_back(static_cast<glm::uint16>(Index(Rng)));
+			Data.Weights.push_back(Weight(Rng));
+			Sum += Data.Weights.back();
+		}
+		for(glm::length_t k = 0; k < Influences; ++k)
+			Data.Weights[Data.Weights.size() - 1 - static_cast<std::size_t>(k)] /= Sum;
+		Data.Positions.push_back(next_vec3(Rng, 2.0f));
+		Data.Normals.push_back(glm::normalize(next_vec3(Rng, 1.0f) + glm::vec3(0.0f, 0.0f, 0.1f)));
+	}
+
+	return Data;
+}
+
+// Dual quaternion linear blending with the tdualquat operators
+static glm::dualquat blend(skin_data const& Data, glm::length_t Influences, std::size_t i)
+{
+	std::size_t const First = i * static_cast<std::size_t>(Influences);
+	glm::quat const Pivot = Data.Bones[Data.Indices[First]].real;
+	glm::dualquat Result(glm::quat::wxyz(0.f, 0.f, 0.f, 0.f), glm::quat::wxyz(0.f, 0.f, 0.f, 0.f));
+	for(std::size_t k = 0; k < static_cast<std::size_t>(Influences); ++k)
+	{
+		glm::dualquat const& Bone = Data.Bones[Data.Indices[First + k]];
+		Result = Result + Bone * (glm::dot(Bone.real, Pivot) < 0.f ? -Data.Weights[First + k] : Data.Weights[First + k]);
+	}
+	return glm::normalize(Result);
+}
+
+static int test_skin(std::size_t Count, glm::length_t Influences)
+{
+	int Error = 0;
+
+	skin_data const Data = make_skin(Count, Influences, static_cast<glm::uint32>(Count * 8 + static_cast<std::size_t>(Influences)));
+	std::vector<glm::vec3> Positions(Count), Normals(Count);
+	glm::batch::dualquat_skin(
+		Data.Bones.data(), Data.Indices.data(), Data.Weights.data(), Influences,
+		Data.Positions.data(), Data.Normals.data(), Positions.data(), Normals.data(), Count);
+
+	// Bones translate by up to 10 * sqrt(3)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::dualquat const Blend = blend(Data, Influences, i);
+		Error += glm::all(glm::equal(Positions[i], Blend * Data.Positions[i], 2e-5f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Normals[i], Blend.real * Data.Normals[i], 1e-6f)) ? 0 : 1;
+		Error += glm::abs(glm::length(Normals[i]) - 1.0f) < 1e-5f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// A single bone moves the vertices rigidly, whatever the sign it is stored with
+static int test_rigid()
+{
+	int Error = 0;
+
+	std::mt19937 Rng(7);
+	glm::quat const Rotation = next_quat(Rng);
+	glm::vec3 const Translation(1.0f, -2.0f, 3.0f);
+	glm::dualquat const Bones[] = {glm::dualquat(Rotation, Translation), -glm::dualquat(Rotation, Translation)};
+	glm::uint16 const Indices[] = {0, 1, 1, 0, 0};
+	float const Weights[] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+
+	glm::vec3 Positions[5];
+	for(std::size_t i = 0; i < 5; ++i)
+		Positions[i] = next_vec3(Rng, 5.0f);
+	glm::vec3 Out[5];
+	glm::batch::dualquat_skin(Bones, Indices, Weights, 1, Positions, nullptr, Out, nullptr, 5);
+	for(std::size_t i = 0; i < 5; ++i)
+		Error += glm::all(glm::equal(Out[i], Rotation * Positions[i] + Translation, 1e-5f)) ? 0 : 1;
+
+	// Two influences of the same transform stored with opposite signs do not cancel out
+	glm::uint16 const Pair[] = {0, 1};
+	float const Half[] = {0.5f, 0.5f};
+	glm::vec3 Blended;
+	glm::batch::dualquat_skin(Bones, Pair, Half, 2, Positions, nullptr, &Blended, nullptr, 1);
+	Error += glm::all(glm::equal(Blended, Rotation * Positions[0] + Translation, 1e-5f)) ? 0 : 1;
+
+	return Error;
+}
+
+// The outputs may overwrite the inputs
+static int test_in_place()
+{
+	int Error = 0;
+
+	std::size_t const Count = 13;
+	skin_data Data = make_skin(Count, 4, 11);
+	std::vector<glm::vec3> Positions(Count), Normals(Count);
+	glm::batch::dualquat_skin(
+		Data.Bones.data(), Data.Indices.data(), Data.Weights.data(), 4,
+		Data.Positions.data(), Data.Normals.data(), Positions.data(), Normals.data(), Count);
+	glm::batch::dualquat_skin(
+		Data.Bones.data(), Data.Indices.data(), Data.Weights.data(), 4,
+		Data.Positions.data(), Data.Normals.data(), Data.Positions.data(), Data.Normals.data(), Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += Data.Positions[i] == Positions[i] ? 0 : 1;
+		Error += Data.Normals[i] == Normals[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	std::size_t const Count = 9;
+	skin_data const Data = make_skin(Count, 2, 12);
+	std::vector<glm::vec3> Positions(Count), Expected(Count);
+	glm::batch::dualquat_skin(
+		std::span<glm::dualquat const>(Data.Bones), std::span<glm::uint16 const>(Data.Indices), std::span<float const>(Data.Weights), 2,
+		std::span<glm::vec3 const>(Data.Positions), std::span<glm::vec3 const>(), std::span<glm::vec3>(Positions), std::span<glm::vec3>());
+	glm::batch::dualquat_skin(
+		Data.Bones.data(), Data.Indices.data(), Data.Weights.data(), 2,
+		Data.Positions.data(), nullptr, Expected.data(), nullptr, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Positions[i] == Expected[i] ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	// Odd counts so both the wide loop and the padded remainder are exercised
+	Error += test_skin(1031, 4);
+	Error += test_skin(1031, 8);
+	Error += test_skin(3, 1);
+	Error += test_skin(7, 3);
+	Error += test_rigid();
+	Error += test_in_place();
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
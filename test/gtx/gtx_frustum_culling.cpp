@@ -0,0 +1,204 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/frustum_culling.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+static float distance(glm::vec4 const& Plane, glm::vec3 const& Point)
+{
+	return glm::dot(glm::vec3(Plane), Point) + Plane.w;
+}
+
+// The corners of the view volume lie on three planes each
+static int test_planes()
+{
+	int Error = 0;
+
+	float const Near = 0.5f;
+	float const Far = 50.0f;
+	float const Tan = glm::tan(glm::radians(30.0f));
+	glm::mat4 const View = glm::lookAtRH(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(4.0f, 2.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 const InvView = glm::inverse(View);
+
+	glm::vec4 ZO[6], NO[6];
+	glm::frustumPlanesZO(glm::perspectiveRH_ZO(glm::radians(60.0f), 2.0f, Near, Far) * View, ZO);
+	glm::frustumPlanesNO(glm::perspectiveRH_NO(glm::radians(60.0f), 2.0f, Near, Far) * View, NO);
+
+	for(int i = 0; i < 8; ++i)
+	{
+		float const Depth = i & 4 ? Far : Near;
+		float const X = (i & 1 ? 1.0f : -1.0f) * Depth * Tan * 2.0f;
+		float const Y = (i & 2 ? 1.0f : -1.0f) * Depth * Tan;
+		glm::vec3 const Corner(InvView * glm::vec4(X, Y, -Depth, 1.0f));
+
+		std::size_t const Planes[] = {i & 1 ? 1u : 0u, i & 2 ? 3u : 2u, i & 4 ? 5u : 4u};
+		for(std::size_t j = 0; j < 3; ++j)
+		{
+			// Relative to the distance of the far corners
+			float const Epsilon = 1e-5f * Far;
+			Error += glm::equal(distance(ZO[Planes[j]], Corner), 0.0f, Epsilon) ? 0 : 1;
+			Error += glm::equal(distance(NO[Planes[j]], Corner), 0.0f, Epsilon) ? 0 : 1;
+		}
+	}
+
+	// Normalized planes facing the inside
+	glm::vec3 const Center(InvView * glm::vec4(0.0f, 0.0f, -10.0f, 1.0f));
+	for(std::size_t i = 0; i < 6; ++i)
+	{
+		Error += glm::equal(glm::length(glm::vec3(ZO[i])), 1.0f, 1e-5f) ? 0 : 1;
+		Error += distance(ZO[i], Center) > 0.0f ? 0 : 1;
+		Error += distance(NO[i], Center) > 0.0f ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_volumes()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(glm::perspectiveRH(glm::radians(90.0f), 1.0f, 1.0f, 100.0f), Planes);
+
+	Error += glm::intersectFrustumSphere(Planes, glm::vec3(0.0f, 0.0f, -10.0f), 1.0f) ? 0 : 1;
+	Error += !glm::intersectFrustumSphere(Planes, glm::vec3(0.0f, 0.0f, 10.0f), 1.0f) ? 0 : 1;
+	Error += glm::intersectFrustumSphere(Planes, glm::vec3(0.0f, 0.0f, 0.2f), 1.5f) ? 0 : 1;
+	Error += !glm::intersectFrustumSphere(Planes, glm::vec3(0.0f, 0.0f, -102.0f), 1.0f) ? 0 : 1;
+	Error += glm::intersectFrustumSphere(Planes, glm::vec3(11.0f, 0.0f, -10.0f), 1.5f) ? 0 : 1;
+	Error += !glm::intersectFrustumSphere(Planes, glm::vec3(12.0f, 0.0f, -10.0f), 1.0f) ? 0 : 1;
+
+	Error += glm::intersectFrustumAABB(Planes, glm::vec3(-1.0f, -1.0f, -11.0f), glm::vec3(1.0f, 1.0f, -9.0f)) ? 0 : 1;
+	Error += glm::intersectFrustumAABB(Planes, glm::vec3(-50.0f), glm::vec3(50.0f)) ? 0 : 1;
+	Error += !glm::intersectFrustumAABB(Planes, glm::vec3(-1.0f, -1.0f, 1.0f), glm::vec3(1.0f, 1.0f, 2.0f)) ? 0 : 1;
+	Error += glm::intersectFrustumAABB(Planes, glm::vec3(10.5f, -1.0f, -11.0f), glm::vec3(12.0f, 1.0f, -10.0f)) ? 0 : 1;
+	Error += !glm::intersectFrustumAABB(Planes, glm::vec3(12.5f, -1.0f, -11.0f), glm::vec3(14.0f, 1.0f, -10.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+struct volumes
+{
+	// Sphere centers or box centers, sphere radii or box half extents
+	std::vector<float> X, Y, Z;
+	std::vector<float> RX, RY, RZ;
+	// Box corners
+	std::vector<float> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+};
+
+static volumes make_volumes(std::size_t Count, glm::uint32 Seed)
+{
+	std::mt19937 Rng(Seed);
+	std::uniform_real_distribution<float> Center(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> Extent(0.0f, 4.0f);
+	volumes Data;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Data.X.push_back(Center(Rng));
+		Data.Y.push_back(Center(Rng));
+		Data.Z.push_back(Center(Rng) - 30.0f);
+		Data.RX.push_back(Extent(Rng));
+		Data.RY.push_back(Extent(Rng));
+		Data.RZ.push_back(Extent(Rng));
+		Data.MinX.push_back(Data.X.back() - Data.RX.back());
+		Data.MinY.push_back(Data.Y.back() - Data.RY.back());
+		Data.MinZ.push_back(Data.Z.back() - Data.RZ.back());
+		Data.MaxX.push_back(Data.X.back() + Data.RX.back());
+		Data.MaxY.push_back(Data.Y.back() + Data.RY.back());
+		Data.MaxZ.push_back(Data.Z.back() + Data.RZ.back());
+	}
+	return Data;
+}
+
+static bool bit(std::vector<glm::uint32> const& Visible, std::size_t i)
+{
+	return (Visible[i / 32] >> (i % 32)) & 1u;
+}
+
+// Batch results against the scalar tests, and cleared bits past count
+static int test_batch(std::size_t Count)
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::mat4 const View = glm::lookAtRH(glm::vec3(0.0f, 5.0f, 20.0f), glm::vec3(5.0f, 0.0f, -10.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::frustumPlanes(glm::perspectiveRH(glm::radians(90.0f), 1.5f, 0.1f, 60.0f) * View, Planes);
+
+	volumes const Data = make_volumes(Count, static_cast<glm::uint32>(Count));
+	std::size_t const Words = (Count + 31) / 32;
+	std::vector<glm::uint32> Spheres(Words, ~0u), MinMax(Words, ~0u), CenterExtent(Words, ~0u);
+
+	glm::batch::cullSpheres(Planes, Data.X.data(), Data.Y.data(), Data.Z.data(), Data.RX.data(), Spheres.data(), Count);
+	glm::batch::cullMinMaxAABBs(Planes,
+		Data.MinX.data(), Data.MinY.data(), Data.MinZ.data(), Data.MaxX.data(), Data.MaxY.data(), Data.MaxZ.data(), MinMax.data(), Count);
+	glm::batch::cullCenterExtentAABBs(Planes,
+		Data.X.data(), Data.Y.data(), Data.Z.data(), Data.RX.data(), Data.RY.data(), Data.RZ.data(), CenterExtent.data(), Count);
+
+	std::size_t Visible = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(Data.X[i], Data.Y[i], Data.Z[i]);
+		bool const Sphere = glm::intersectFrustumSphere(Planes, Center, Data.RX[i]);
+		bool const Box = glm::intersectFrustumAABB(Planes,
+			glm::vec3(Data.MinX[i], Data.MinY[i], Data.MinZ[i]), glm::vec3(Data.MaxX[i], Data.MaxY[i], Data.MaxZ[i]));
+		Error += bit(Spheres, i) == Sphere ? 0 : 1;
+		Error += bit(MinMax, i) == Box ? 0 : 1;
+		Error += bit(CenterExtent, i) == Box ? 0 : 1;
+		Visible += Sphere ? 1 : 0;
+	}
+
+	for(std::size_t i = Count; i < Words * 32; ++i)
+	{
+		Error += bit(Spheres, i) ? 1 : 0;
+		Error += bit(MinMax, i) ? 1 : 0;
+		Error += bit(CenterExtent, i) ? 1 : 0;
+	}
+
+	// Both outcomes are exercised
+	if(Count > 100)
+		Error += Visible > Count / 20 && Visible < Count - Count / 20 ? 0 : 1;
+
+	return Error;
+}
+
+#if GLM_HAS_SPAN
+static int test_span()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(glm::perspectiveRH(glm::radians(60.0f), 1.0f, 0.1f, 40.0f), Planes);
+
+	std::size_t const Count = 45;
+	volumes const Data = make_volumes(Count, 5);
+	std::vector<glm::uint32> Spheres(2), Expected(2);
+	glm::batch::cullSpheres(std::span<glm::vec4 const, 6>(Planes),
+		std::span<float const>(Data.X), std::span<float const>(Data.Y), std::span<float const>(Data.Z), std::span<float const>(Data.RX),
+		std::span<glm::uint32>(Spheres));
+	glm::batch::cullSpheres(Planes, Data.X.data(), Data.Y.data(), Data.Z.data(), Data.RX.data(), Expected.data(), Count);
+	Error += Spheres == Expected ? 0 : 1;
+
+	return Error;
+}
+#endif//GLM_HAS_SPAN
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes();
+	Error += test_volumes();
+	// Whole words, a partial register and partial words
+	Error += test_batch(4096);
+	Error += test_batch(1031);
+	Error += test_batch(37);
+	Error += test_batch(3);
+#	if GLM_HAS_SPAN
+	Error += test_span();
+#	endif
+
+	return Error;
+}
@@ -3,6 +3,7 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/intersect.hpp>
 #include <cstdio>
+#include <random>
 
 static int test_intersectRayPlane()
 {
@@ -291,6 +292,115 @@ static int test_intersectRayTriangle()
 	return Error;
 }
 
+static glm::vec3 next_vec3(std::mt19937& Rng, float Scale)
+{
+	std::uniform_real_distribution<float> Unit(-Scale, Scale);
+	return glm::vec3(Unit(Rng), Unit(Rng), Unit(Rng));
+}
+
+// Each lane of the packet variants against the scalar intersectRayTriangle
+template<glm::length_t N>
+static int check_lanes(
+	glm::wide::mask<float, N> const& Hit, glm::wide::vec<2, float, N> const& BaryPosition, glm::wide::scalar<float, N> const& Distance,
+	glm::vec3 const* Orig, glm::vec3 const* Dir, glm::vec3 const* Vert0, glm::vec3 const* Vert1, glm::vec3 const* Vert2, int& Hits)
+{
+	int Error = 0;
+
+	for(glm::length_t i = 0; i < N; ++i)
+	{
+		glm::vec2 ScalarBary(0);
+		float ScalarDistance = 0;
+		bool const ScalarHit = glm::intersectRayTriangle(Orig[i], Dir[i], Vert0[i], Vert1[i], Vert2[i], ScalarBary, ScalarDistance);
+		Error += Hit[i] == ScalarHit ? 0 : 1;
+		if(!ScalarHit || !Hit[i])
+			continue;
+
+		++Hits;
+		Error += glm::epsilonEqual(Distance[i], ScalarDistance, 1e-4f * glm::max(1.0f, glm::abs(ScalarDistance))) ? 0 : 1;
+		Error += glm::epsilonEqual(BaryPosition.x[i], ScalarBary.x, 1e-4f) ? 0 : 1;
+		Error += glm::epsilonEqual(BaryPosition.y[i], ScalarBary.y, 1e-4f) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t N>
+static int test_intersectRayTriangle_packet()
+{
+	int Error = 0;
+	int Hits = 0;
+	int Tests = 0;
+
+	std::mt19937 Rng(static_cast<unsigned>(N));
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	for(int Packet = 0; Packet < 256; ++Packet)
+	{
+		// Rays aimed near the centroid of their triangle, with both windings
+		// and some rays starting past the triangle
+		glm::vec3 Orig[N], Dir[N], Vert0[N], Vert1[N], Vert2[N];
+		for(glm::length_t i = 0; i < N; ++i)
+		{
+			Vert0[i] = next_vec3(Rng, 4.0f);
+			Vert1[i] = Vert0[i] + next_vec3(Rng, 2.0f);
+			Vert2[i] = Vert0[i] + next_vec3(Rng, 2.0f);
+			Orig[i] = next_vec3(Rng, 8.0f);
+			glm::vec3 const Target = (Vert0[i] + Vert1[i] + Vert2[i]) / 3.0f + next_vec3(Rng, 1.0f);
+			Dir[i] = (Target - Orig[i]) * (Unit(Rng) < -0.8f ? -1.0f : 1.0f);
+		}
+
+		// A ray in the plane of its triangle
+		if(Packet == 0)
+		{
+			Vert0[0] = glm::vec3(0, 0, 0);
+			Vert1[0] = glm::vec3(1, 0, 0);
+			Vert2[0] = glm::vec3(0, 1, 0);
+			Orig[0] = glm::vec3(-1, 0.25f, 0);
+			Dir[0] = glm::vec3(1, 0, 0);
+		}
+
+		glm::wide::vec<2, float, N> BaryPosition;
+		glm::wide::scalar<float, N> Distance;
+
+		// One ray against N triangles moved along it
+		glm::vec3 RayOrig[N], RayDir[N], MovedVert0[N], MovedVert1[N], MovedVert2[N];
+		for(glm::length_t i = 0; i < N; ++i)
+		{
+			RayOrig[i] = Orig[0];
+			RayDir[i] = Dir[0];
+			glm::vec3 const Offset = i == 0 ? glm::vec3(0) :
+				Orig[0] + Dir[0] * Unit(Rng) * 2.0f + next_vec3(Rng, 1.0f) - (Vert0[i] + Vert1[i] + Vert2[i]) / 3.0f;
+			MovedVert0[i] = Vert0[i] + Offset;
+			MovedVert1[i] = Vert1[i] + Offset;
+			MovedVert2[i] = Vert2[i] + Offset;
+		}
+		glm::wide::mask<float, N> Hit = glm::intersectRayTriangle(Orig[0], Dir[0],
+			glm::wide::gather<N>(MovedVert0), glm::wide::gather<N>(MovedVert1), glm::wide::gather<N>(MovedVert2), BaryPosition, Distance);
+		Error += check_lanes<N>(Hit, BaryPosition, Distance, RayOrig, RayDir, MovedVert0, MovedVert1, MovedVert2, Hits);
+
+		// N rays against one triangle
+		glm::vec3 SameVert0[N], SameVert1[N], SameVert2[N];
+		for(glm::length_t i = 0; i < N; ++i)
+		{
+			SameVert0[i] = Vert0[0];
+			SameVert1[i] = Vert1[0];
+			SameVert2[i] = Vert2[0];
+			Dir[i] = (Vert0[0] + Vert1[0] + Vert2[0]) / 3.0f - Orig[i] + next_vec3(Rng, 1.0f);
+		}
+		if(Packet == 0)
+			Dir[0] = glm::vec3(1, 0, 0);
+		Hit = glm::intersectRayTriangle(glm::wide::gather<N>(Orig), glm::wide::gather<N>(Dir),
+			Vert0[0], Vert1[0], Vert2[0], BaryPosition, Distance);
+		Error += check_lanes<N>(Hit, BaryPosition, Distance, Orig, Dir, SameVert0, SameVert1, SameVert2, Hits);
+
+		Tests += 2 * N;
+	}
+
+	// Both outcomes are exercised
+	Error += Hits > Tests / 10 && Hits < Tests - Tests / 10 ? 0 : 1;
+
+	return Error;
+}
+
 #if GLM_PLATFORM != GLM_PLATFORM_LINUX
 static int test_intersectLineTriangle()
 {
@@ -321,6 +431,9 @@ int main()
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle(); // Disabled on 2025/01/16, C.I. failing on Ubuntu latest, GCC 13.3.0
 #endif//GLM_PLATFORM != GLM_PLATFORM_LINUX
+	Error += test_intersectRayTriangle_packet<4>();
+	Error += test_intersectRayTriangle_packet<8>();
+	Error += test_intersectRayTriangle_packet<3>();
 
 	return Error;
 }
@@ -0,0 +1,300 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/noise_tile.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// The fractal of the tile at Coord, sample by sample, from the positions
+// the tiles use
+template<glm::length_t L, typename T>
+static int test_samples(std::vector<T> const& Tile, glm::vec<L, int, glm::defaultp> const& Coord, int Size, T Spacing, glm::noise_tile_params<T> const& Params)
+{
+	int Error = 0;
+
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	T const Step = Spacing * Params.frequency;
+	vec_type Origin;
+	std::size_t Count = 1;
+	for(glm::length_t c = 0; c < L; ++c)
+	{
+		Origin[c] = static_cast<T>(Coord[c]) * static_cast<T>(Size) * Step;
+		Count *= static_cast<std::size_t>(Size);
+	}
+
+	Error += Tile.size() == Count ? 0 : 1;
+
+	for(std::size_t i = 0; i < Count && i < Tile.size(); ++i)
+	{
+		vec_type p;
+		std::size_t Index = i;
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			p[c] = Origin[c] + static_cast<T>(Index % static_cast<std::size_t>(Size)) * Step;
+			Index /= static_cast<std::size_t>(Size);
+		}
+
+		T Expected = static_cast<T>(0);
+		if(Params.basis == glm::noise_simplex && Params.fractal == glm::noise_tile_fbm && Params.octaves == 5)
+			Expected = glm::fbm<5>(p, Params.lacunarity, Params.gain);
+		else if(Params.basis == glm::noise_perlin && Params.fractal == glm::noise_tile_ridged && Params.octaves == 3)
+			Expected = glm::ridged<3, glm::noise_perlin>(p, Params.lacunarity, Params.gain);
+		else if(Params.basis == glm::noise_simplex && Params.fractal == glm::noise_tile_billow && Params.octaves == 2)
+			Expected = glm::billow<2>(p, Params.lacunarity, Params.gain);
+		else if(Params.basis == glm::noise_perlin && Params.fractal == glm::noise_tile_turbulence && Params.octaves == 4)
+			Expected = glm::turbulence<4, glm::noise_perlin>(p, Params.lacunarity, Params.gain);
+		else
+			++Error;
+
+		// Packets round differently, over every octave
+		Error += glm::equal(Tile[i], Expected, static_cast<T>(1e-4)) ? 0 : 1;
+	}
+
+	return Error > 0 ? 1 : 0;
+}
+
+template<glm::length_t L, typename T>
+static int test_content()
+{
+	int Error = 0;
+
+	typedef glm::vec<L, int, glm::defaultp> coord_type;
+
+	glm::noise_tile_params<T> Fbm;
+	Fbm.octaves = 5;
+	Fbm.frequency = static_cast<T>(0.7);
+
+	glm::noise_tile_params<T> Ridged;
+	Ridged.basis = glm::noise_perlin;
+	Ridged.fractal = glm::noise_tile_ridged;
+	Ridged.octaves = 3;
+	Ridged.lacunarity = static_cast<T>(2.2);
+
+	glm::noise_tile_params<T> Billow;
+	Billow.fractal = glm::noise_tile_billow;
+	Billow.octaves = 2;
+	Billow.gain = static_cast<T>(0.6);
+
+	glm::noise_tile_params<T> Turbulence;
+	Turbulence.basis = glm::noise_perlin;
+	Turbulence.fractal = glm::noise_tile_turbulence;
+	Turbulence.octaves = 4;
+
+	// Not a multiple of the packet size
+	int const Size = 13;
+	T const Spacing = static_cast<T>(0.125);
+	glm::noise_tile_cache<L, T> Cache(Size, Spacing, 16, 3);
+	Error += Cache.size() == Size ? 0 : 1;
+	Error += Cache.spacing() == Spacing ? 0 : 1;
+	Error += Cache.threads() == 3 ? 0 : 1;
+
+	coord_type const Coords[] = {coord_type(0), coord_type(-1), coord_type(glm::ivec3(3, -2, 5))};
+	for(std::size_t i = 0; i < sizeof(Coords) / sizeof(Coords[0]); ++i)
+	{
+		Error += test_samples(*Cache.tile(Coords[i], Fbm), Coords[i], Size, Spacing, Fbm);
+		Error += test_samples(*Cache.tile(Coords[i], Ridged), Coords[i], Size, Spacing, Ridged);
+		Error += test_samples(*Cache.tile(Coords[i], Billow), Coords[i], Size, Spacing, Billow);
+		Error += test_samples(*Cache.tile(Coords[i], Turbulence), Coords[i], Size, Spacing, Turbulence);
+	}
+
+	return Error;
+}
+
+template<glm::length_t L>
+static int test_cache()
+{
+	int Error = 0;
+
+	typedef glm::noise_tile_cache<L, float> cache_type;
+	typedef typename cache_type::coord_type coord_type;
+
+	glm::noise_tile_params<float> const Params;
+	glm::noise_tile_params<float> Other;
+	Other.gain = 0.4f;
+	Error += Params != Other ? 0 : 1;
+
+	cache_type Cache(8, 0.5f, 2, 2);
+
+	coord_type const A(1), B(2), C(3);
+	typename cache_type::tile_type const TileA = Cache.tile(A, Params);
+	Error += Cache.tile(A, Params) == TileA ? 0 : 1;
+	Error += Cache.hits() == 1 ? 0 : 1;
+	Error += Cache.misses() == 1 ? 0 : 1;
+
+	// Other parameters make another tile
+	typename cache_type::tile_type const OtherA = Cache.tile(A, Other);
+	Error += OtherA != TileA ? 0 : 1;
+	Error += *OtherA != *TileA ? 0 : 1;
+	Error += Cache.misses() == 2 ? 0 : 1;
+
+	Error += Cache.cached() == 2 ? 0 : 1;
+
+	Cache.clear();
+	Error += Cache.cached() == 0 ? 0 : 1;
+
+	// A, then B, then A again: B is the least recently used when C comes in
+	typename cache_type::tile_type const LastA = Cache.tile(A, Params);
+	typename cache_type::tile_type const LastB = Cache.tile(B, Params);
+	Error += Cache.tile(A, Params) == LastA ? 0 : 1;
+	Error += Cache.tile(C, Params) ? 0 : 1;
+	Error += Cache.cached() == 2 ? 0 : 1;
+
+	std::size_t const Misses = Cache.misses();
+	Error += Cache.tile(A, Params) == LastA ? 0 : 1;
+	Error += Cache.misses() == Misses ? 0 : 1;
+	typename cache_type::tile_type const NewB = Cache.tile(B, Params);
+	Error += Cache.misses() == Misses + 1 ? 0 : 1;
+	Error += NewB != LastB ? 0 : 1;
+	Error += *NewB == *LastB ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L>
+static int test_region()
+{
+	int Error = 0;
+
+	typedef glm::noise_tile_cache<L, float> cache_type;
+	typedef typename cache_type::coord_type coord_type;
+
+	glm::noise_tile_params<float> Params;
+	Params.octaves = 3;
+
+	coord_type const First(-1);
+	coord_type const Last(glm::ivec3(2, 0, 1));
+	std::size_t Count = 1;
+	for(glm::length_t c = 0; c < L; ++c)
+		Count *= static_cast<std::size_t>(Last[c] - First[c] + 1);
+
+	// Fewer tiles kept than in the region: they are returned all the same
+	cache_type Cache(9, 0.25f, 4, 4);
+	std::vector<typename cache_type::tile_type> Tiles(Count);
+	Cache.region(First, Last, Params, Tiles.data());
+	Error += Cache.misses() == Count ? 0 : 1;
+
+	cache_type Reference(9, 0.25f, Count, 1);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		coord_type Coord;
+		std::size_t Index = i;
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			std::size_t const Extent = static_cast<std::size_t>(Last[c] - First[c] + 1);
+			Coord[c] = First[c] + static_cast<int>(Index % Extent);
+			Index /= Extent;
+		}
+
+		Error += Tiles[i] && *Tiles[i] == *Reference.tile(Coord, Params) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Several threads asking for the same tiles: each tile is generated once
+template<glm::length_t L>
+static int test_threads()
+{
+	int Error = 0;
+
+	typedef glm::noise_tile_cache<L, float> cache_type;
+	typedef typename cache_type::coord_type coord_type;
+
+	glm::noise_tile_params<float> const Params;
+	int const Tiles = 6;
+	cache_type Cache(16, 0.1f, 64);
+
+	std::vector<std::vector<typename cache_type::tile_type> > Results(4);
+	std::vector<std::thread> Clients;
+	for(std::size_t t = 0; t < Results.size(); ++t)
+	{
+		Clients.emplace_back([&Cache, &Params, &Results, t, Tiles]
+		{
+			for(int i = 0; i < Tiles; ++i)
+			{
+				int const j = (i + static_cast<int>(t)) % Tiles;
+				Results[t].push_back(Cache.tile(coord_type(j), Params));
+			}
+		});
+	}
+	for(std::size_t t = 0; t < Clients.size(); ++t)
+		Clients[t].join();
+
+	Error += Cache.misses() == static_cast<std::size_t>(Tiles) ? 0 : 1;
+	Error += Cache.hits() == static_cast<std::size_t>(Tiles) * (Results.size() - 1) ? 0 : 1;
+
+	for(std::size_t t = 0; t < Results.size(); ++t)
+	for(int i = 0; i < Tiles; ++i)
+		Error += Results[t][static_cast<std::size_t>(i)] == Results[0][static_cast<std::size_t>((i + static_cast<int>(t)) % Tiles)] ? 0 : 1;
+
+	return Error;
+}
+
+// A tile too large for std::vector: the error reaches the caller instead of
+// terminating the worker, and the tile is not cached
+static int test_error()
+{
+	int Error = 0;
+
+	glm::noise_tile_params<float> const Params;
+	glm::noise_tile_cache<3, float> Cache(1 << 21, 0.5f, 4, 1);
+
+	for(std::size_t Attempt = 1; Attempt <= 2; ++Attempt)
+	{
+		bool Thrown = false;
+		try
+		{
+			static_cast<void>(Cache.tile(glm::ivec3(0), Params));
+			++Error;
+		}
+		catch(std::exception const&)
+		{
+			Thrown = true;
+		}
+		Error += Thrown ? 0 : 1;
+
+		// Generated again rather than served from the cache
+		Error += Cache.misses() == Attempt ? 0 : 1;
+		Error += Cache.hits() == 0 ? 0 : 1;
+		Error += Cache.cached() == 0 ? 0 : 1;
+	}
+
+	// size^3 does not fit in a std::size_t
+	bool Rejected = false;
+	try
+	{
+		glm::noise_tile_cache<3, float> Overflow(1 << 22, 0.5f, 4, 1);
+		++Error;
+	}
+	catch(std::length_error const&)
+	{
+		Rejected = true;
+	}
+	Error += Rejected ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_content<2, float>();
+	Error += test_content<3, float>();
+	Error += test_content<2, double>();
+
+	Error += test_cache<2>();
+	Error += test_cache<3>();
+
+	Error += test_region<2>();
+	Error += test_region<3>();
+
+	Error += test_threads<2>();
+	Error += test_threads<3>();
+
+	Error += test_error();
+
+	return Error;
+}
@@ -0,0 +1,161 @@
+#define GLM_FORCE_INLINE
+#include <glm/matrix.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// World-space style transforms: large translations mixed with rotation and scale
+template <typename matType>
+static std::vector<matType> make_inputs(std::size_t Samples)
+{
+	std::vector<matType> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		double const t = static_cast<double>(i);
+		glm::dmat4 const M =
+			glm::translate(glm::dmat4(1), glm::dvec3(6.4e6 + t, -3.2e6 + 2.0 * t, 1.0e5 - t)) *
+			glm::rotate(glm::dmat4(1), 0.01 * t, glm::dvec3(0.3, 0.5, -0.8)) *
+			glm::scale(glm::dmat4(1), glm::dvec3(1.0 + 0.001 * t, 2.0, 0.5));
+		I[i] = matType(M);
+	}
+	return I;
+}
+
+template <typename matType>
+static int launch_mat_mul_mat(std::vector<matType>& O, matType const& Transform, std::vector<matType> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0, n = I.size(); i < n; ++i)
+		O[i] = Transform * I[i];
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename matType>
+static int launch_mat_inverse(std::vector<matType>& O, std::vector<matType> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0, n = I.size(); i < n; ++i)
+		O[i] = glm::inverse(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename matType>
+static int launch_mat_determinant(std::vector<double>& O, std::vector<matType> const& I)
+{
+	O.resize(I.size());
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0, n = I.size(); i < n; ++i)
+		O[i] = glm::determinant(I[i]);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_mul_mat4(std::size_t Samples)
+{
+	int Error = 0;
+
+	packedMatType const Transform(glm::rotate(glm::dmat4(1), 0.7, glm::dvec3(1, 0, 0)) * glm::translate(glm::dmat4(1), glm::dvec3(-6.4e6, 3.2e6, 0)));
+
+	std::vector<packedMatType> SISD;
+	std::printf("- SISD: %d us\n", launch_mat_mul_mat<packedMatType>(SISD, Transform, make_inputs<packedMatType>(Samples)));
+
+	std::vector<alignedMatType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_mat_mul_mat<alignedMatType>(SIMD, alignedMatType(Transform), make_inputs<alignedMatType>(Samples)));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedMatType const A = SISD[i];
+		packedMatType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, 1e-6)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_inverse(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<packedMatType> const In = make_inputs<packedMatType>(Samples);
+
+	std::vector<packedMatType> SISD;
+	std::printf("- SISD: %d us\n", launch_mat_inverse<packedMatType>(SISD, In));
+
+	std::vector<alignedMatType> SIMD;
+	std::printf("- SIMD: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, make_inputs<alignedMatType>(Samples)));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		packedMatType const A = SISD[i];
+		packedMatType const B = SIMD[i];
+		Error += glm::all(glm::equal(A, B, 1e-6)) ? 0 : 1;
+
+		// The inverse must still round-trip at planetary scale
+		packedMatType const Identity = In[i] * B;
+		Error += glm::all(glm::equal(Identity, packedMatType(1), 1e-6)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename packedMatType, typename alignedMatType>
+static int comp_mat4_determinant(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<double> SISD;
+	std::printf("- SISD: %d us\n", launch_mat_determinant<packedMatType>(SISD, make_inputs<packedMatType>(Samples)));
+
+	std::vector<double> SIMD;
+	std::printf("- SIMD: %d us\n", launch_mat_determinant<alignedMatType>(SIMD, make_inputs<alignedMatType>(Samples)));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::equal(SISD[i], SIMD[i], 1e-12 * glm::abs(SISD[i])) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Samples = 1000;
+
+	int Error = 0;
+
+	std::printf("dmat4 * dmat4:\n");
+	Error += comp_mat4_mul_mat4<glm::dmat4, glm::aligned_dmat4>(Samples);
+
+	std::printf("inverse(dmat4):\n");
+	Error += comp_mat4_inverse<glm::dmat4, glm::aligned_dmat4>(Samples);
+
+	std::printf("determinant(dmat4):\n");
+	Error += comp_mat4_determinant<glm::dmat4, glm::aligned_dmat4>(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,159 @@
+#define GLM_FORCE_INLINE
+#include <glm/matrix.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <cstdio>
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX512_BIT)
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+#include <chrono>
+
+// Bone-palette style transforms: rotation, non-uniform scale and translation
+template <typename matType>
+static std::vector<matType> make_inputs(std::size_t Samples)
+{
+	std::vector<matType> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		float const t = static_cast<float>(i);
+		glm::mat4 const M =
+			glm::translate(glm::mat4(1), glm::vec3(0.1f * t, -2.0f + 0.01f * t, 3.0f)) *
+			glm::rotate(glm::mat4(1), 0.01f * t, glm::vec3(0.3f, 0.5f, -0.8f)) *
+			glm::scale(glm::mat4(1), glm::vec3(1.0f + 0.001f * t, 2.0f, 0.5f));
+		I[i] = matType(M);
+	}
+	return I;
+}
+
+template <typename T, typename F>
+static int launch(std::vector<T>& O, std::size_t Samples, F const& f)
+{
+	O.resize(Samples);
+
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (std::size_t i = 0; i < Samples; ++i)
+		O[i] = f(i);
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+}
+
+static int comp_mat4_mul_mat4(std::size_t Samples)
+{
+	int Error = 0;
+
+	glm::mat4 const Parent(glm::rotate(glm::mat4(1), 0.7f, glm::vec3(1, 0, 0)) * glm::translate(glm::mat4(1), glm::vec3(-4, 3, 0)));
+	glm::aligned_mat4 const AlignedParent(Parent);
+	std::vector<glm::mat4> const I = make_inputs<glm::mat4>(Samples);
+	std::vector<glm::aligned_mat4> const J = make_inputs<glm::aligned_mat4>(Samples);
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD: %d us\n", launch(SISD, Samples, [&](std::size_t i) { return Parent * I[i]; }));
+
+	std::vector<glm::aligned_mat4> SIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, Samples, [&](std::size_t i) { return AlignedParent * J[i]; }));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::mat4(SIMD[i]), 1e-4f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_mat4_mul_vec4(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> const I = make_inputs<glm::mat4>(Samples);
+	std::vector<glm::aligned_mat4> const J = make_inputs<glm::aligned_mat4>(Samples);
+
+	std::vector<glm::vec4> SISD;
+	std::printf("- SISD: %d us\n", launch(SISD, Samples, [&](std::size_t i) { return I[i] * glm::vec4(1, 2, 3, 1); }));
+
+	std::vector<glm::aligned_vec4> SIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, Samples, [&](std::size_t i) { return J[i] * glm::aligned_vec4(1, 2, 3, 1); }));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(SISD[i], glm::vec4(SIMD[i]), 1e-4f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_mat4_transpose(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> const I = make_inputs<glm::mat4>(Samples);
+	std::vector<glm::aligned_mat4> const J = make_inputs<glm::aligned_mat4>(Samples);
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD: %d us\n", launch(SISD, Samples, [&](std::size_t i) { return glm::transpose(I[i]); }));
+
+	std::vector<glm::aligned_mat4> SIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, Samples, [&](std::size_t i) { return glm::transpose(J[i]); }));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += SISD[i] == glm::mat4(SIMD[i]) ? 0 : 1;
+
+	return Error;
+}
+
+static int comp_mat4_inverse(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> const I = make_inputs<glm::mat4>(Samples);
+	std::vector<glm::aligned_mat4> const J = make_inputs<glm::aligned_mat4>(Samples);
+
+	std::vector<glm::mat4> SISD;
+	std::printf("- SISD: %d us\n", launch(SISD, Samples, [&](std::size_t i) { return glm::inverse(I[i]); }));
+
+	std::vector<glm::aligned_mat4> SIMD;
+	std::printf("- SIMD: %d us\n", launch(SIMD, Samples, [&](std::size_t i) { return glm::inverse(J[i]); }));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::mat4 const B(SIMD[i]);
+		Error += glm::all(glm::equal(SISD[i], B, 1e-3f)) ? 0 : 1;
+		Error += glm::all(glm::equal(I[i] * B, glm::mat4(1), 1e-4f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	if(!__builtin_cpu_supports("avx512f"))
+	{
+		std::printf("AVX-512F not supported by this CPU, skipped\n");
+		return 0;
+	}
+
+	std::size_t const Samples = 1000;
+
+	int Error = 0;
+
+	std::printf("mat4 * mat4:\n");
+	Error += comp_mat4_mul_mat4(Samples);
+
+	std::printf("mat4 * vec4:\n");
+	Error += comp_mat4_mul_vec4(Samples);
+
+	std::printf("transpose(mat4):\n");
+	Error += comp_mat4_transpose(Samples);
+
+	std::printf("inverse(mat4):\n");
+	Error += comp_mat4_inverse(Samples);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
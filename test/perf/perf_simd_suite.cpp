@@ -0,0 +1,622 @@
+// Micro-benchmarks for every SIMD specialization of the core functions.
+//
+// Each operation runs over an array of inputs once per qualifier
+// (packed_highp, aligned_highp, aligned_mediump, aligned_lowp): the packed
+// run is the scalar reference, the aligned runs select the compute_*<..., true>
+// specializations when GLM_CONFIG_SIMD is enabled. Every run is warmed up,
+// then timed over several repetitions; the report lists min, median, mean and
+// standard deviation in ns per element, the median throughput in elements per
+// ns and the largest difference from the packed_highp results (relative
+// where the reference exceeds 1 in magnitude, absolute elsewhere).
+//
+// Usage: test-perf_simd_suite [--json <file>|-] [--count N] [--reps N] [--filter text]
+
+#include <glm/glm.hpp>
+#include <glm/packing.hpp>
+#include <glm/gtc/type_aligned.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_geometric.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	struct settings
+	{
+		std::size_t Count;
+		int Warmup;
+		int Repetitions;
+		char const* Filter;
+		char const* JsonPath;
+		std::FILE* Log;
+	};
+
+	struct result
+	{
+		std::string Group;
+		std::string Name;
+		std::string Type;
+		char const* Qualifier;
+		double Min;
+		double Median;
+		double Mean;
+		double StdDev;
+		double MaxDiff;
+	};
+
+	// -- Inputs --
+
+	// Deterministic inputs so runs and machines compare
+	struct rng
+	{
+		glm::uint State;
+
+		double next(double Lo, double Hi)
+		{
+			State = State * 1664525u + 1013904223u;
+			return Lo + (Hi - Lo) * static_cast<double>(State >> 8) / static_cast<double>(1u << 24);
+		}
+	};
+
+	template<typename T>
+	void make_value(T& x, rng& R, double Lo, double Hi)
+	{
+		x = static_cast<T>(R.next(Lo, Hi));
+	}
+
+	template<glm::length_t L, typename T, glm::qualifier Q>
+	void make_value(glm::vec<L, T, Q>& v, rng& R, double Lo, double Hi)
+	{
+		for(glm::length_t i = 0; i < L; ++i)
+			make_value(v[i], R, Lo, Hi);
+	}
+
+	template<typename T, glm::qualifier Q>
+	void make_value(glm::qua<T, Q>& q, rng& R, double, double)
+	{
+		glm::vec<4, double, glm::defaultp> v;
+		make_value(v, R, -1.0, 1.0);
+		v = glm::normalize(v + glm::vec<4, double, glm::defaultp>(0.0, 0.0, 0.0, 0.1));
+		q = glm::qua<T, Q>(static_cast<T>(v.w), static_cast<T>(v.x), static_cast<T>(v.y), static_cast<T>(v.z));
+	}
+
+	// Diagonally dominant so inverse is well conditioned
+	template<glm::length_t C, glm::length_t R_, typename T, glm::qualifier Q>
+	void make_value(glm::mat<C, R_, T, Q>& m, rng& R, double Lo, double Hi)
+	{
+		for(glm::length_t i = 0; i < C; ++i)
+			make_value(m[i], R, Lo, Hi);
+		for(glm::length_t i = 0; i < C && i < R_; ++i)
+			m[i][i] += static_cast<T>(4);
+	}
+
+	// -- Differences to the packed_highp reference: relative above 1, absolute below --
+
+	template<typename T>
+	typename std::enable_if<std::is_arithmetic<T>::value, double>::type diff(T a, T b)
+	{
+		double const x = static_cast<double>(a);
+		double const y = static_cast<double>(b);
+		if(std::isnan(x) || std::isnan(y))
+			return std::isnan(x) && std::isnan(y) ? 0.0 : std::numeric_limits<double>::infinity();
+		if(x == y)
+			return 0.0;
+		return std::abs(x - y) / std::max(1.0, std::abs(x));
+	}
+
+	inline double diff(bool a, bool b)
+	{
+		return a == b ? 0.0 : 1.0;
+	}
+
+	template<glm::length_t L, typename T, glm::qualifier P, glm::qualifier Q>
+	double diff(glm::vec<L, T, P> const& a, glm::vec<L, T, Q> const& b)
+	{
+		double Result = 0.0;
+		for(glm::length_t i = 0; i < L; ++i)
+			Result = std::max(Result, diff(a[i], b[i]));
+		return Result;
+	}
+
+	template<typename T, glm::qualifier P, glm::qualifier Q>
+	double diff(glm::qua<T, P> const& a, glm::qua<T, Q> const& b)
+	{
+		double Result = 0.0;
+		for(glm::length_t i = 0; i < 4; ++i)
+			Result = std::max(Result, diff(a[i], b[i]));
+		return Result;
+	}
+
+	template<glm::length_t C, glm::length_t R, typename T, glm::qualifier P, glm::qualifier Q>
+	double diff(glm::mat<C, R, T, P> const& a, glm::mat<C, R, T, Q> const& b)
+	{
+		double Result = 0.0;
+		for(glm::length_t i = 0; i < C; ++i)
+			Result = std::max(Result, diff(a[i], b[i]));
+		return Result;
+	}
+
+	// -- Harness --
+
+	template<typename Op, typename V>
+	struct output
+	{
+		typedef decltype(Op::call(std::declval<V const&>(), std::declval<V const&>(), std::declval<V const&>())) type;
+	};
+
+	struct statistics
+	{
+		double Min, Median, Mean, StdDev;
+	};
+
+	inline statistics compute_statistics(std::vector<double> Samples)
+	{
+		std::sort(Samples.begin(), Samples.end());
+
+		statistics Stats;
+		Stats.Min = Samples.front();
+		std::size_t const Mid = Samples.size() / 2;
+		Stats.Median = Samples.size() % 2 ? Samples[Mid] : 0.5 * (Samples[Mid - 1] + Samples[Mid]);
+
+		double Sum = 0.0;
+		for(std::size_t i = 0; i < Samples.size(); ++i)
+			Sum += Samples[i];
+		Stats.Mean = Sum / static_cast<double>(Samples.size());
+
+		double Var = 0.0;
+		for(std::size_t i = 0; i < Samples.size(); ++i)
+			Var += (Samples[i] - Stats.Mean) * (Samples[i] - Stats.Mean);
+		Stats.StdDev = Samples.size() > 1 ? std::sqrt(Var / static_cast<double>(Samples.size() - 1)) : 0.0;
+		return Stats;
+	}
+
+	// Times Op over the inputs; returns ns per element samples and keeps the last outputs
+	template<typename Op, typename V>
+	std::vector<double> time_op(settings const& S, std::vector<V> const& A, std::vector<V> const& B, std::vector<V> const& C, std::vector<typename output<Op, V>::type>& Out)
+	{
+		Out.resize(A.size());
+
+		std::vector<double> Samples;
+		for(int Rep = -S.Warmup; Rep < S.Repetitions; ++Rep)
+		{
+			std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+			for(std::size_t i = 0, n = A.size(); i < n; ++i)
+				Out[i] = Op::call(A[i], B[i], C[i]);
+			std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+
+			if(Rep >= 0)
+				Samples.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / static_cast<double>(A.size()));
+		}
+		return Samples;
+	}
+
+	template<typename V>
+	std::vector<V> make_inputs(std::size_t Count, glm::uint Seed, double Lo, double Hi)
+	{
+		rng R = {Seed};
+		std::vector<V> Result(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			make_value(Result[i], R, Lo, Hi);
+		return Result;
+	}
+
+	template<typename Op, typename V, typename RefOut>
+	result run_one(settings const& S, char const* Group, char const* Type, char const* Qualifier, std::vector<RefOut> const* Reference, std::vector<typename output<Op, V>::type>& Out)
+	{
+		std::vector<V> const A = make_inputs<V>(S.Count, 1u, Op::lo(), Op::hi());
+		std::vector<V> const B = make_inputs<V>(S.Count, 2u, Op::lo(), Op::hi());
+		std::vector<V> const C = make_inputs<V>(S.Count, 3u, Op::lo(), Op::hi());
+
+		statistics const Stats = compute_statistics(time_op<Op>(S, A, B, C, Out));
+
+		double MaxDiff = 0.0;
+		if(Reference)
+			for(std::size_t i = 0; i < Out.size(); ++i)
+				MaxDiff = std::max(MaxDiff, diff((*Reference)[i], Out[i]));
+
+		result Result;
+		Result.Group = Group;
+		Result.Name = Op::name();
+		Result.Type = Type;
+		Result.Qualifier = Qualifier;
+		Result.Min = Stats.Min;
+		Result.Median = Stats.Median;
+		Result.Mean = Stats.Mean;
+		Result.StdDev = Stats.StdDev;
+		Result.MaxDiff = MaxDiff;
+		return Result;
+	}
+
+	void print_result(settings const& S, result const& R)
+	{
+		std::fprintf(S.Log, "%-14s %-18s %-6s %-16s %9.3f %9.3f %9.3f %8.3f %9.3f %10.3g\n",
+			R.Group.c_str(), R.Name.c_str(), R.Type.c_str(), R.Qualifier,
+			R.Min, R.Median, R.Mean, R.StdDev, R.Median > 0.0 ? 1.0 / R.Median : 0.0, R.MaxDiff);
+	}
+
+	// Runs Op on Type<Q> for each qualifier; types that ignore the qualifier run once
+	template<typename Op, template<glm::qualifier> class Type>
+	void bench(settings const& S, char const* Group, char const* TypeName, std::vector<result>& Results)
+	{
+		std::string const Name = std::string(Group) + "." + Op::name() + "." + TypeName;
+		if(S.Filter && Name.find(S.Filter) == std::string::npos)
+			return;
+
+		typedef Type<glm::packed_highp> packed_type;
+		typedef typename output<Op, packed_type>::type packed_output;
+
+		std::vector<packed_output> Reference;
+		Results.push_back(run_one<Op, packed_type, packed_output>(S, Group, TypeName, "packed_highp", nullptr, Reference));
+		print_result(S, Results.back());
+
+		if(std::is_same<packed_type, Type<glm::aligned_highp> >::value)
+			return;
+
+		std::vector<typename output<Op, Type<glm::aligned_highp> >::type> OutHighp;
+		Results.push_back(run_one<Op, Type<glm::aligned_highp> >(S, Group, TypeName, "aligned_highp", &Reference, OutHighp));
+		print_result(S, Results.back());
+
+		std::vector<typename output<Op, Type<glm::aligned_mediump> >::type> OutMediump;
+		Results.push_back(run_one<Op, Type<glm::aligned_mediump> >(S, Group, TypeName, "aligned_mediump", &Reference, OutMediump));
+		print_result(S, Results.back());
+
+		std::vector<typename output<Op, Type<glm::aligned_lowp> >::type> OutLowp;
+		Results.push_back(run_one<Op, Type<glm::aligned_lowp> >(S, Group, TypeName, "aligned_lowp", &Reference, OutLowp));
+		print_result(S, Results.back());
+	}
+
+	// -- Types --
+
+	template<glm::qualifier Q> using vec3 = glm::vec<3, float, Q>;
+	template<glm::qualifier Q> using vec4 = glm::vec<4, float, Q>;
+	template<glm::qualifier Q> using ivec4 = glm::vec<4, int, Q>;
+	template<glm::qualifier Q> using uvec4 = glm::vec<4, glm::uint, Q>;
+	template<glm::qualifier Q> using u16vec4 = glm::vec<4, glm::uint16, Q>;
+	template<glm::qualifier Q> using dvec4 = glm::vec<4, double, Q>;
+	template<glm::qualifier Q> using quat = glm::qua<float, Q>;
+	template<glm::qualifier Q> using dquat = glm::qua<double, Q>;
+	template<glm::qualifier Q> using mat4 = glm::mat<4, 4, float, Q>;
+	template<glm::qualifier Q> using uint32 = glm::uint;
+	template<glm::qualifier Q> using uint64 = glm::uint64;
+	template<glm::qualifier Q> using vec4_default = glm::vec4;
+
+	// -- Operations --
+
+	template<typename T, glm::qualifier Q>
+	glm::vec<4, T, Q> point(glm::qua<T, Q> const& q)
+	{
+		return glm::vec<4, T, Q>(q.x, q.y, q.z, static_cast<T>(1));
+	}
+
+	// name, input range, expression of a, b and c
+#	define GLM_PERF_OP(NAME, LO, HI, EXPR) \
+	struct op_##NAME \
+	{ \
+		static char const* name() { return #NAME; } \
+		static double lo() { return LO; } \
+		static double hi() { return HI; } \
+		template<typename V> \
+		static auto call(V const& a, V const& b, V const& c) -> decltype(EXPR) { (void)a; (void)b; (void)c; return EXPR; } \
+	};
+
+	// common
+	GLM_PERF_OP(abs, -10.0, 10.0, glm::abs(a))
+	GLM_PERF_OP(floor, -100.0, 100.0, glm::floor(a))
+	GLM_PERF_OP(ceil, -100.0, 100.0, glm::ceil(a))
+	GLM_PERF_OP(fract, -100.0, 100.0, glm::fract(a))
+	GLM_PERF_OP(round, -100.0, 100.0, glm::round(a))
+	GLM_PERF_OP(mod, 1.0, 100.0, glm::mod(a, b))
+	GLM_PERF_OP(min, -100.0, 100.0, glm::min(a, b))
+	GLM_PERF_OP(max, -100.0, 100.0, glm::max(a, b))
+	GLM_PERF_OP(clamp, -100.0, 100.0, glm::clamp(a, glm::min(b, c), glm::max(b, c)))
+	GLM_PERF_OP(mix, -100.0, 100.0, glm::mix(a, b, glm::lessThan(a, c)))
+	GLM_PERF_OP(step, -1.0, 1.0, glm::step(a, b))
+	GLM_PERF_OP(smoothstep, 0.0, 1.0, glm::smoothstep(glm::min(a, b), glm::max(a, b) + 0.5f, c))
+	GLM_PERF_OP(fma, -10.0, 10.0, glm::fma(a, b, c))
+
+	// exponential
+	GLM_PERF_OP(sqrt, 0.0, 1000.0, glm::sqrt(a))
+	GLM_PERF_OP(inversesqrt, 0.01, 1000.0, glm::inversesqrt(a))
+	GLM_PERF_OP(exp, -80.0, 80.0, glm::exp(a))
+	GLM_PERF_OP(log, 0.001, 1e6, glm::log(a))
+	GLM_PERF_OP(exp2, -100.0, 100.0, glm::exp2(a))
+	GLM_PERF_OP(log2, 0.001, 1e6, glm::log2(a))
+	GLM_PERF_OP(pow, 0.01, 10.0, glm::pow(a, b))
+
+	// trigonometric
+	GLM_PERF_OP(sin, -100.0, 100.0, glm::sin(a))
+	GLM_PERF_OP(cos, -100.0, 100.0, glm::cos(a))
+	GLM_PERF_OP(tan, -1.5, 1.5, glm::tan(a))
+	GLM_PERF_OP(asin, -1.0, 1.0, glm::asin(a))
+	GLM_PERF_OP(acos, -1.0, 1.0, glm::acos(a))
+	GLM_PERF_OP(atan, -100.0, 100.0, glm::atan(a))
+	GLM_PERF_OP(atan2, -100.0, 100.0, glm::atan(a, b))
+	GLM_PERF_OP(sinh, -10.0, 10.0, glm::sinh(a))
+	GLM_PERF_OP(cosh, -10.0, 10.0, glm::cosh(a))
+	GLM_PERF_OP(tanh, -10.0, 10.0, glm::tanh(a))
+	GLM_PERF_OP(asinh, -100.0, 100.0, glm::asinh(a))
+	GLM_PERF_OP(acosh, 1.0, 100.0, glm::acosh(a))
+	GLM_PERF_OP(atanh, -0.99, 0.99, glm::atanh(a))
+
+	// geometric
+	GLM_PERF_OP(dot, -10.0, 10.0, glm::dot(a, b))
+	GLM_PERF_OP(length, -10.0, 10.0, glm::length(a))
+	GLM_PERF_OP(distance, -10.0, 10.0, glm::distance(a, b))
+	GLM_PERF_OP(cross, -10.0, 10.0, glm::cross(a, b))
+	GLM_PERF_OP(normalize, -10.0, 10.0, glm::normalize(a))
+	GLM_PERF_OP(faceforward, -10.0, 10.0, glm::faceforward(a, b, c))
+	GLM_PERF_OP(reflect, -10.0, 10.0, glm::reflect(a, glm::normalize(b)))
+	GLM_PERF_OP(refract, -1.0, 1.0, glm::refract(glm::normalize(a), glm::normalize(b), 0.75f))
+
+	// quaternion
+	GLM_PERF_OP(quat_mul, -1.0, 1.0, a * b)
+	GLM_PERF_OP(quat_add, -1.0, 1.0, a + b)
+	GLM_PERF_OP(quat_mul_scalar, -1.0, 1.0, a * 2.0f)
+	GLM_PERF_OP(quat_mul_vec4, -1.0, 1.0, a * point(b))
+	GLM_PERF_OP(quat_dot, -1.0, 1.0, glm::dot(a, b))
+	GLM_PERF_OP(quat_normalize, -1.0, 1.0, glm::normalize(a))
+	GLM_PERF_OP(dquat_mul, -1.0, 1.0, a * b)
+	GLM_PERF_OP(dquat_add, -1.0, 1.0, a + b)
+
+	// packing
+	GLM_PERF_OP(packUnorm4x8, 0.0, 1.0, glm::packUnorm4x8(a))
+	GLM_PERF_OP(unpackUnorm4x8, 0.0, 4294967295.0, glm::unpackUnorm4x8(a))
+	GLM_PERF_OP(packSnorm4x8, -1.0, 1.0, glm::packSnorm4x8(a))
+	GLM_PERF_OP(packHalf4x16, -100.0, 100.0, glm::packHalf4x16(a))
+	GLM_PERF_OP(packUnorm, 0.0, 1.0, glm::packUnorm<glm::uint16>(a))
+	GLM_PERF_OP(unpackUnorm, 0.0, 65535.0, glm::unpackUnorm<float>(a))
+	GLM_PERF_OP(packHalf, -100.0, 100.0, glm::packHalf(a))
+	GLM_PERF_OP(unpackHalf, 0.0, 31743.0, glm::unpackHalf(a))
+
+	// integer
+	GLM_PERF_OP(bitCount, 0.0, 4294967295.0, glm::bitCount(a))
+	GLM_PERF_OP(findMSB, 0.0, 4294967295.0, glm::findMSB(a))
+	GLM_PERF_OP(findLSB, 0.0, 4294967295.0, glm::findLSB(a))
+	GLM_PERF_OP(bitfieldReverse, 0.0, 4294967295.0, glm::bitfieldReverse(a))
+	GLM_PERF_OP(iabs, -1000.0, 1000.0, glm::abs(a))
+	GLM_PERF_OP(imin, -1000.0, 1000.0, glm::min(a, b))
+	GLM_PERF_OP(imax, -1000.0, 1000.0, glm::max(a, b))
+	GLM_PERF_OP(iclamp, -1000.0, 1000.0, glm::clamp(a, glm::min(b, c), glm::max(b, c)))
+
+	// matrix
+	GLM_PERF_OP(mat_mul, -1.0, 1.0, a * b)
+	GLM_PERF_OP(mat_mul_vec, -1.0, 1.0, a * b[0])
+	GLM_PERF_OP(inverse, -1.0, 1.0, glm::inverse(a))
+	GLM_PERF_OP(transpose, -1.0, 1.0, glm::transpose(a))
+	GLM_PERF_OP(determinant, -1.0, 1.0, glm::determinant(a))
+
+#	undef GLM_PERF_OP
+
+	// -- Report --
+
+	char const* arch_name()
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			return "avx512";
+#		elif GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return "avx2";
+#		elif GLM_ARCH & GLM_ARCH_AVX_BIT
+			return "avx";
+#		elif GLM_ARCH & GLM_ARCH_SSE42_BIT
+			return "sse4.2";
+#		elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return "sse4.1";
+#		elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+			return "ssse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE3_BIT
+			return "sse3";
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			return "sse2";
+#		elif GLM_ARCH & GLM_ARCH_NEON_BIT
+			return "neon";
+#		else
+			return "none";
+#		endif
+	}
+
+	void write_json_number(std::FILE* File, double x)
+	{
+		if(std::isfinite(x))
+			std::fprintf(File, "%.6g", x);
+		else
+			std::fprintf(File, "null");
+	}
+
+	int write_json(settings const& S, std::vector<result> const& Results)
+	{
+		bool const Stdout = std::strcmp(S.JsonPath, "-") == 0;
+		std::FILE* File = Stdout ? stdout : std::fopen(S.JsonPath, "w");
+		if(!File)
+		{
+			std::fprintf(stderr, "cannot open %s\n", S.JsonPath);
+			return 1;
+		}
+
+		std::fprintf(File, "{\n");
+		std::fprintf(File, "  \"glm_version\": \"%d.%d.%d\",\n", GLM_VERSION_MAJOR, GLM_VERSION_MINOR, GLM_VERSION_PATCH);
+		std::fprintf(File, "  \"arch\": \"%s\",\n", arch_name());
+		std::fprintf(File, "  \"simd\": %s,\n", GLM_CONFIG_SIMD == GLM_ENABLE ? "true" : "false");
+		std::fprintf(File, "  \"fma\": %s,\n",
+#			if defined(GLM_FORCE_FMA)
+				"true"
+#			else
+				"false"
+#			endif
+		);
+		std::fprintf(File, "  \"count\": %u,\n", static_cast<unsigned>(S.Count));
+		std::fprintf(File, "  \"warmup\": %d,\n", S.Warmup);
+		std::fprintf(File, "  \"repetitions\": %d,\n", S.Repetitions);
+		std::fprintf(File, "  \"results\": [\n");
+		for(std::size_t i = 0; i < Results.size(); ++i)
+		{
+			result const& R = Results[i];
+			std::fprintf(File, "    {\"group\": \"%s\", \"name\": \"%s\", \"type\": \"%s\", \"qualifier\": \"%s\", ",
+				R.Group.c_str(), R.Name.c_str(), R.Type.c_str(), R.Qualifier);
+			std::fprintf(File, "\"ns_per_element\": {\"min\": ");
+			write_json_number(File, R.Min);
+			std::fprintf(File, ", \"median\": ");
+			write_json_number(File, R.Median);
+			std::fprintf(File, ", \"mean\": ");
+			write_json_number(File, R.Mean);
+			std::fprintf(File, ", \"stddev\": ");
+			write_json_number(File, R.StdDev);
+			std::fprintf(File, "}, \"elements_per_ns\": ");
+			write_json_number(File, R.Median > 0.0 ? 1.0 / R.Median : 0.0);
+			std::fprintf(File, ", \"max_rel_diff_vs_packed_highp\": ");
+			write_json_number(File, R.MaxDiff);
+			std::fprintf(File, "}%s\n", i + 1 < Results.size() ? "," : "");
+		}
+		std::fprintf(File, "  ]\n}\n");
+
+		if(!Stdout)
+			std::fclose(File);
+		return 0;
+	}
+}//namespace
+
+int main(int argc, char* argv[])
+{
+	settings S;
+	S.Count = 4096;
+	S.Warmup = 2;
+	S.Repetitions = 7;
+	S.Filter = nullptr;
+	S.JsonPath = nullptr;
+	S.Log = stdout;
+
+	for(int i = 1; i < argc; ++i)
+	{
+		bool const HasValue = i + 1 < argc;
+		if(std::strcmp(argv[i], "--json") == 0 && HasValue)
+			S.JsonPath = argv[++i];
+		else if(std::strcmp(argv[i], "--count") == 0 && HasValue)
+			S.Count = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+		else if(std::strcmp(argv[i], "--reps") == 0 && HasValue)
+			S.Repetitions = std::max(1, std::atoi(argv[++i]));
+		else if(std::strcmp(argv[i], "--filter") == 0 && HasValue)
+			S.Filter = argv[++i];
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--json <file>|-] [--count N] [--reps N] [--filter text]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// Keep stdout parseable when the report goes there
+	S.Log = S.JsonPath && std::strcmp(S.JsonPath, "-") == 0 ? stderr : stdout;
+
+	std::fprintf(S.Log, "arch: %s, simd: %s, %u elements, %d repetitions\n", arch_name(), GLM_CONFIG_SIMD == GLM_ENABLE ? "on" : "off", static_cast<unsigned>(S.Count), S.Repetitions);
+	std::fprintf(S.Log, "%-14s %-18s %-6s %-16s %9s %9s %9s %8s %9s %10s\n", "group", "name", "type", "qualifier", "min ns", "median ns", "mean ns", "stddev", "elem/ns", "max diff");
+
+	std::vector<result> Results;
+
+	bench<op_abs, vec4>(S, "common", "vec4", Results);
+	bench<op_floor, vec4>(S, "common", "vec4", Results);
+	bench<op_ceil, vec4>(S, "common", "vec4", Results);
+	bench<op_fract, vec4>(S, "common", "vec4", Results);
+	bench<op_round, vec4>(S, "common", "vec4", Results);
+	bench<op_mod, vec4>(S, "common", "vec4", Results);
+	bench<op_min, vec4>(S, "common", "vec4", Results);
+	bench<op_max, vec4>(S, "common", "vec4", Results);
+	bench<op_clamp, vec4>(S, "common", "vec4", Results);
+	bench<op_mix, vec4>(S, "common", "vec4", Results);
+	bench<op_step, vec4>(S, "common", "vec4", Results);
+	bench<op_smoothstep, vec4>(S, "common", "vec4", Results);
+	bench<op_fma, vec3>(S, "common", "vec3", Results);
+	bench<op_fma, vec4>(S, "common", "vec4", Results);
+	bench<op_fma, dvec4>(S, "common", "dvec4", Results);
+
+	bench<op_sqrt, vec4>(S, "exponential", "vec4", Results);
+	bench<op_inversesqrt, vec4>(S, "exponential", "vec4", Results);
+	bench<op_exp, vec4>(S, "exponential", "vec4", Results);
+	bench<op_log, vec4>(S, "exponential", "vec4", Results);
+	bench<op_exp2, vec4>(S, "exponential", "vec4", Results);
+	bench<op_log2, vec4>(S, "exponential", "vec4", Results);
+	bench<op_pow, vec4>(S, "exponential", "vec4", Results);
+	bench<op_exp, dvec4>(S, "exponential", "dvec4", Results);
+	bench<op_log, dvec4>(S, "exponential", "dvec4", Results);
+	bench<op_pow, dvec4>(S, "exponential", "dvec4", Results);
+
+	bench<op_sin, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_cos, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_tan, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_asin, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_acos, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_atan, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_atan2, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_sinh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_cosh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_tanh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_asinh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_acosh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_atanh, vec4>(S, "trigonometric", "vec4", Results);
+	bench<op_sin, dvec4>(S, "trigonometric", "dvec4", Results);
+	bench<op_cos, dvec4>(S, "trigonometric", "dvec4", Results);
+	bench<op_tan, dvec4>(S, "trigonometric", "dvec4", Results);
+	bench<op_atan2, dvec4>(S, "trigonometric", "dvec4", Results);
+
+	bench<op_dot, vec3>(S, "geometric", "vec3", Results);
+	bench<op_dot, vec4>(S, "geometric", "vec4", Results);
+	bench<op_length, vec4>(S, "geometric", "vec4", Results);
+	bench<op_distance, vec4>(S, "geometric", "vec4", Results);
+	bench<op_cross, vec3>(S, "geometric", "vec3", Results);
+	bench<op_normalize, vec3>(S, "geometric", "vec3", Results);
+	bench<op_normalize, vec4>(S, "geometric", "vec4", Results);
+	bench<op_faceforward, vec4>(S, "geometric", "vec4", Results);
+	bench<op_reflect, vec4>(S, "geometric", "vec4", Results);
+	bench<op_refract, vec4>(S, "geometric", "vec4", Results);
+
+	bench<op_quat_mul, quat>(S, "quaternion", "quat", Results);
+	bench<op_quat_add, quat>(S, "quaternion", "quat", Results);
+	bench<op_quat_mul_scalar, quat>(S, "quaternion", "quat", Results);
+	bench<op_quat_mul_vec4, quat>(S, "quaternion", "quat", Results);
+	bench<op_quat_dot, quat>(S, "quaternion", "quat", Results);
+	bench<op_quat_normalize, quat>(S, "quaternion", "quat", Results);
+	bench<op_dquat_mul, dquat>(S, "quaternion", "dquat", Results);
+	bench<op_dquat_add, dquat>(S, "quaternion", "dquat", Results);
+
+	bench<op_packUnorm4x8, vec4_default>(S, "packing", "vec4", Results);
+	bench<op_unpackUnorm4x8, uint32>(S, "packing", "uint", Results);
+	bench<op_packSnorm4x8, vec4_default>(S, "packing", "vec4", Results);
+	bench<op_packHalf4x16, vec4_default>(S, "packing", "vec4", Results);
+	bench<op_packUnorm, vec4>(S, "packing", "vec4", Results);
+	bench<op_unpackUnorm, u16vec4>(S, "packing", "u16vec4", Results);
+	bench<op_packHalf, vec4>(S, "packing", "vec4", Results);
+	bench<op_unpackHalf, u16vec4>(S, "packing", "u16vec4", Results);
+
+	bench<op_bitCount, uint32>(S, "integer", "uint", Results);
+	bench<op_bitCount, uint64>(S, "integer", "uint64", Results);
+	bench<op_bitCount, uvec4>(S, "integer", "uvec4", Results);
+	bench<op_findMSB, uvec4>(S, "integer", "uvec4", Results);
+	bench<op_findLSB, uvec4>(S, "integer", "uvec4", Results);
+	bench<op_bitfieldReverse, uvec4>(S, "integer", "uvec4", Results);
+	bench<op_iabs, ivec4>(S, "integer", "ivec4", Results);
+	bench<op_imin, ivec4>(S, "integer", "ivec4", Results);
+	bench<op_imax, ivec4>(S, "integer", "ivec4", Results);
+	bench<op_iclamp, ivec4>(S, "integer", "ivec4", Results);
+	bench<op_imin, uvec4>(S, "integer", "uvec4", Results);
+	bench<op_imax, uvec4>(S, "integer", "uvec4", Results);
+
+	bench<op_mat_mul, mat4>(S, "matrix", "mat4", Results);
+	bench<op_mat_mul_vec, mat4>(S, "matrix", "mat4", Results);
+	bench<op_inverse, mat4>(S, "matrix", "mat4", Results);
+	bench<op_transpose, mat4>(S, "matrix", "mat4", Results);
+	bench<op_determinant, mat4>(S, "matrix", "mat4", Results);
+
+	int Error = 0;
+	if(S.JsonPath)
+		Error += write_json(S, Results);
+
+	return Error;
+}
@@ -0,0 +1,424 @@
+// ULP accuracy and throughput of the SIMD float transcendental kernels.
+//
+// Every kernel of simd_transcendental.h / simd_transcendental_highp.h (and the
+// hyperbolics built on them in func_trigonometric_simd.inl) is swept over its
+// domain and compared against double precision libm rounded to float, using
+// glm::floatDistance for the ULP metric. The default sweep is a dense
+// stratified sample: inputs are spaced evenly in float bit order, so every
+// binade of the domain gets the same number of samples, denormals included.
+// --exhaustive evaluates every float of the domain instead.
+//
+// Each row reports the max and mean ULP error, the max absolute error and the
+// input of the worst case, the kernel and scalar libm throughput in ns per
+// element, and whether NaN, infinities, signed zeros and denormals produce the
+// same result as libm. The run fails when a kernel exceeds the accuracy quoted
+// in its header: absolute error for the mediump sin/cos (ULP is meaningless
+// next to their zeros) and atan/acos (absolute error fits), ULP error otherwise.
+//
+// Usage: test-perf_simd_ulp [--exhaustive] [--samples N] [--filter text]
+
+#include <glm/glm.hpp>
+#include <glm/ext/scalar_ulp.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE
+
+namespace
+{
+	// -- Kernels: Count is a multiple of 8 --
+
+	typedef void (*kernel_func)(float const* In, float* Out, std::size_t Count);
+
+	template<__m128 (*Func)(__m128)>
+	void run_ps(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += 4)
+			_mm_storeu_ps(Out + i, Func(_mm_loadu_ps(In + i)));
+	}
+
+	template<void (*Func)(__m128, __m128&, __m128&), bool Cos>
+	void run_sincos_ps(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			__m128 s, c;
+			Func(_mm_loadu_ps(In + i), s, c);
+			_mm_storeu_ps(Out + i, Cos ? c : s);
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	template<__m256 (*Func)(__m256)>
+	void run_ps256(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += 8)
+			_mm256_storeu_ps(Out + i, Func(_mm256_loadu_ps(In + i)));
+	}
+
+	template<bool Cos>
+	void run_sincos_ps256(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += 8)
+		{
+			__m256 s, c;
+			glm::detail::glm_sincos_ps256(_mm256_loadu_ps(In + i), s, c);
+			_mm256_storeu_ps(Out + i, Cos ? c : s);
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	// The hyperbolics are composed inline in the aligned vec4 specializations
+	typedef glm::vec<4, float, glm::aligned_mediump> vec4m;
+
+	template<vec4m (*Func)(vec4m const&)>
+	void run_vec4(float const* In, float* Out, std::size_t Count)
+	{
+		for(std::size_t i = 0; i < Count; i += 4)
+		{
+			vec4m const r = Func(vec4m(In[i], In[i + 1], In[i + 2], In[i + 3]));
+			std::memcpy(Out + i, &r, sizeof(r));
+		}
+	}
+
+	vec4m sinh_m(vec4m const& x) { return glm::sinh(x); }
+	vec4m cosh_m(vec4m const& x) { return glm::cosh(x); }
+	vec4m tanh_m(vec4m const& x) { return glm::tanh(x); }
+	vec4m asinh_m(vec4m const& x) { return glm::asinh(x); }
+	vec4m acosh_m(vec4m const& x) { return glm::acosh(x); }
+	vec4m atanh_m(vec4m const& x) { return glm::atanh(x); }
+
+	enum metric
+	{
+		METRIC_ULP,
+		METRIC_ABSOLUTE
+	};
+
+	struct kernel
+	{
+		char const* Name;
+		kernel_func Run;
+		double (*Reference)(double);
+		float (*Libm)(float);
+		float Lo, Hi;
+		metric Metric;
+		double Bound;
+	};
+
+	// -- Sampling in float bit order --
+
+	// Monotonic integer key of a float: negative floats map below zero
+	glm::int64 key(float x)
+	{
+		glm::uint Bits;
+		std::memcpy(&Bits, &x, sizeof(Bits));
+		return Bits & 0x80000000u ? -static_cast<glm::int64>(Bits & 0x7fffffffu) : static_cast<glm::int64>(Bits);
+	}
+
+	float from_key(glm::int64 k)
+	{
+		glm::uint const Bits = k < 0 ? static_cast<glm::uint>(-k) | 0x80000000u : static_cast<glm::uint>(k);
+		float x;
+		std::memcpy(&x, &Bits, sizeof(x));
+		return x;
+	}
+
+	// -- Error accounting --
+
+	struct error
+	{
+		glm::int64 Count;
+		int MaxUlp;
+		double SumUlp;
+		double MaxAbs;
+		float WorstInput;
+		glm::int64 NonFinite;   // NaN or infinity where libm returns a finite value, or the reverse
+	};
+
+	void accumulate(error& E, float x, float Result, double Ref, metric Metric)
+	{
+		float const RefF = static_cast<float>(Ref);
+		++E.Count;
+		if(std::isnan(Result) != std::isnan(RefF) || std::isinf(Result) != std::isinf(RefF))
+		{
+			++E.NonFinite;
+			return;
+		}
+		if(!std::isfinite(RefF))
+			return;
+
+		int const Ulp = std::signbit(Result) == std::signbit(RefF) || Result == 0.0f || RefF == 0.0f
+			? std::abs(glm::floatDistance(Result, RefF))
+			: std::numeric_limits<int>::max();
+		double const Abs = std::abs(static_cast<double>(Result) - Ref);
+		E.SumUlp += static_cast<double>(Ulp);
+
+		if(Metric == METRIC_ULP ? Ulp > E.MaxUlp : Abs > E.MaxAbs)
+			E.WorstInput = x;
+		E.MaxUlp = std::max(E.MaxUlp, Ulp);
+		E.MaxAbs = std::max(E.MaxAbs, Abs);
+	}
+
+	// -- Special values --
+
+	// Finite results only need to meet the kernel bound
+	bool same(kernel const& K, float a, float b)
+	{
+		if(std::isnan(a) || std::isnan(b))
+			return std::isnan(a) && std::isnan(b);
+		if(a == 0.0f && b == 0.0f)
+			return std::signbit(a) == std::signbit(b);
+		if(std::isinf(a) || std::isinf(b))
+			return a == b;
+		if(K.Metric == METRIC_ABSOLUTE)
+			return std::abs(static_cast<double>(a) - static_cast<double>(b)) <= K.Bound;
+		return std::signbit(a) == std::signbit(b) && std::abs(glm::floatDistance(a, b)) <= K.Bound;
+	}
+
+	// Lists the special inputs whose result differs from libm, "-" when none does
+	std::string check_special(kernel const& K)
+	{
+		float const Denormal = std::numeric_limits<float>::denorm_min() * 1024.0f;
+		float const In[16] = {
+			std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 0.0f,
+			-0.0f, Denormal, -Denormal, FLT_MIN,
+			-FLT_MIN, FLT_MAX, -FLT_MAX, 1.0f,
+			-1.0f, 0.5f, -0.5f, 2.0f};
+		char const* Names[16] = {
+			"nan", "+inf", "-inf", "+0",
+			"-0", "+denorm", "-denorm", "+min",
+			"-min", "+max", "-max", "+1",
+			"-1", "+0.5", "-0.5", "+2"};
+
+		float Out[16];
+		K.Run(In, Out, 16);
+
+		std::string Result;
+		for(int i = 0; i < 16; ++i)
+		{
+			if(same(K, Out[i], static_cast<float>(K.Reference(static_cast<double>(In[i])))))
+				continue;
+			Result += Result.empty() ? "" : ",";
+			Result += Names[i];
+		}
+		return Result.empty() ? "-" : Result;
+	}
+
+	// -- Throughput --
+
+	template<typename Func>
+	double time_ns(std::vector<float> const& In, std::vector<float>& Out, Func const& Call)
+	{
+		double Best = std::numeric_limits<double>::max();
+		for(int Rep = 0; Rep < 5; ++Rep)
+		{
+			std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+			Call(In.data(), Out.data(), In.size());
+			std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+			Best = std::min(Best, static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()));
+		}
+		return Best / static_cast<double>(In.size());
+	}
+
+	struct settings
+	{
+		bool Exhaustive;
+		glm::int64 Samples;
+		char const* Filter;
+	};
+
+	int measure(settings const& S, kernel const& K)
+	{
+		std::size_t const Batch = 1 << 16;
+		std::vector<float> In(Batch), Out(Batch);
+
+		error E = {0, 0, 0.0, 0.0, 0.0f, 0};
+
+		glm::int64 const First = key(K.Lo);
+		glm::int64 const Last = key(K.Hi);
+		glm::int64 const Step = S.Exhaustive ? 1 : std::max<glm::int64>(1, (Last - First) / S.Samples);
+
+		glm::int64 k = First;
+		while(k <= Last)
+		{
+			std::size_t n = 0;
+			for(; n < Batch && k <= Last; ++n, k += Step)
+				In[n] = from_key(k);
+			std::size_t const Padded = (n + 7) & ~static_cast<std::size_t>(7);
+			std::fill(In.begin() + static_cast<std::ptrdiff_t>(n), In.begin() + static_cast<std::ptrdiff_t>(Padded), K.Lo);
+
+			K.Run(In.data(), Out.data(), Padded);
+			for(std::size_t i = 0; i < n; ++i)
+				accumulate(E, In[i], Out[i], K.Reference(static_cast<double>(In[i])), K.Metric);
+		}
+
+		// Time on a cache resident subset spread over the whole domain
+		In.resize(Batch / 16);
+		for(std::size_t i = 0; i < In.size(); ++i)
+			In[i] = from_key(First + static_cast<glm::int64>(i) * std::max<glm::int64>(1, (Last - First) / static_cast<glm::int64>(In.size())));
+		double const KernelNs = time_ns(In, Out, K.Run);
+		float (*const Libm)(float) = K.Libm;
+		double const LibmNs = time_ns(In, Out, [Libm](float const* x, float* y, std::size_t n)
+		{
+			for(std::size_t i = 0; i < n; ++i)
+				y[i] = Libm(x[i]);
+		});
+
+		double const Mean = E.SumUlp / static_cast<double>(std::max<glm::int64>(1, E.Count - E.NonFinite));
+		bool const Pass = E.NonFinite == 0 && (K.Metric == METRIC_ULP ? E.MaxUlp <= K.Bound : E.MaxAbs <= K.Bound);
+
+		char Bound[32];
+		if(K.Metric == METRIC_ULP)
+			std::snprintf(Bound, sizeof(Bound), "%g ulp", K.Bound);
+		else
+			std::snprintf(Bound, sizeof(Bound), "%.1e abs", K.Bound);
+
+		std::printf("%-28s [%9.3g, %9.3g] %11lld %9d %8.3f %9.2e %12.6g %8.2f %8.2f  %-12s %-4s %s\n",
+			K.Name, static_cast<double>(K.Lo), static_cast<double>(K.Hi), static_cast<long long>(E.Count),
+			E.MaxUlp, Mean, E.MaxAbs, static_cast<double>(E.WorstInput), KernelNs, LibmNs,
+			Bound, Pass ? "ok" : "FAIL", check_special(K).c_str());
+		if(E.NonFinite)
+			std::printf("%-28s %lld non-finite mismatches\n", "", static_cast<long long>(E.NonFinite));
+
+		return Pass ? 0 : 1;
+	}
+
+	double ref_sin(double x) { return std::sin(x); }
+	double ref_cos(double x) { return std::cos(x); }
+	double ref_tan(double x) { return std::tan(x); }
+	double ref_exp(double x) { return std::exp(x); }
+	double ref_exp2(double x) { return std::exp2(x); }
+	double ref_expm1(double x) { return std::expm1(x); }
+	double ref_log(double x) { return std::log(x); }
+	double ref_log2(double x) { return std::log2(x); }
+	double ref_log1p(double x) { return std::log1p(x); }
+	double ref_atan(double x) { return std::atan(x); }
+	double ref_asin(double x) { return std::asin(x); }
+	double ref_acos(double x) { return std::acos(x); }
+	double ref_sinh(double x) { return std::sinh(x); }
+	double ref_cosh(double x) { return std::cosh(x); }
+	double ref_tanh(double x) { return std::tanh(x); }
+	double ref_asinh(double x) { return std::asinh(x); }
+	double ref_acosh(double x) { return std::acosh(x); }
+	double ref_atanh(double x) { return std::atanh(x); }
+
+	float libm_sin(float x) { return std::sin(x); }
+	float libm_cos(float x) { return std::cos(x); }
+	float libm_tan(float x) { return std::tan(x); }
+	float libm_exp(float x) { return std::exp(x); }
+	float libm_exp2(float x) { return std::exp2(x); }
+	float libm_expm1(float x) { return std::expm1(x); }
+	float libm_log(float x) { return std::log(x); }
+	float libm_log2(float x) { return std::log2(x); }
+	float libm_log1p(float x) { return std::log1p(x); }
+	float libm_atan(float x) { return std::atan(x); }
+	float libm_asin(float x) { return std::asin(x); }
+	float libm_acos(float x) { return std::acos(x); }
+	float libm_sinh(float x) { return std::sinh(x); }
+	float libm_cosh(float x) { return std::cosh(x); }
+	float libm_tanh(float x) { return std::tanh(x); }
+	float libm_asinh(float x) { return std::asinh(x); }
+	float libm_acosh(float x) { return std::acosh(x); }
+	float libm_atanh(float x) { return std::atanh(x); }
+}//namespace
+
+int main(int argc, char* argv[])
+{
+	settings S;
+	S.Exhaustive = false;
+	S.Samples = 1 << 20;
+	S.Filter = nullptr;
+
+	for(int i = 1; i < argc; ++i)
+	{
+		bool const HasValue = i + 1 < argc;
+		if(std::strcmp(argv[i], "--exhaustive") == 0)
+			S.Exhaustive = true;
+		else if(std::strcmp(argv[i], "--samples") == 0 && HasValue)
+			S.Samples = std::max(1, std::atoi(argv[++i]));
+		else if(std::strcmp(argv[i], "--filter") == 0 && HasValue)
+			S.Filter = argv[++i];
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--exhaustive] [--samples N] [--filter text]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	using namespace glm::detail;
+
+	float const Max = FLT_MAX;
+	float const Denormal = std::numeric_limits<float>::denorm_min();
+
+	// Domains are where each kernel is specified: exp stays clear of overflow and
+	// underflow, log starts at the smallest normal (denormals are flushed), the
+	// mediump sin/cos are quoted up to 1e4 and 1e6. atan and acos are absolute
+	// error fits, so they are bounded in absolute terms like sin/cos.
+	kernel const Kernels[] = {
+		{"glm_sincos_ps sin", run_sincos_ps<glm_sincos_ps, false>, ref_sin, libm_sin, -1e4f, 1e4f, METRIC_ABSOLUTE, 4e-6},
+		{"glm_sincos_ps cos", run_sincos_ps<glm_sincos_ps, true>, ref_cos, libm_cos, -1e4f, 1e4f, METRIC_ABSOLUTE, 4e-6},
+		{"glm_sincos_ps sin 1e6", run_sincos_ps<glm_sincos_ps, false>, ref_sin, libm_sin, -1e6f, 1e6f, METRIC_ABSOLUTE, 1.5e-5},
+		{"glm_sincos_ps cos 1e6", run_sincos_ps<glm_sincos_ps, true>, ref_cos, libm_cos, -1e6f, 1e6f, METRIC_ABSOLUTE, 1.5e-5},
+		{"glm_exp_ps", run_ps<glm_exp_ps>, ref_exp, libm_exp, -87.0f, 88.0f, METRIC_ULP, 3},
+		{"glm_expm1_ps", run_ps<glm_expm1_ps>, ref_expm1, libm_expm1, -87.0f, 88.0f, METRIC_ULP, 8},
+		{"glm_log_ps", run_ps<glm_log_ps>, ref_log, libm_log, FLT_MIN, Max, METRIC_ULP, 2},
+		{"glm_log1p_ps", run_ps<glm_log1p_ps>, ref_log1p, libm_log1p, -0.999f, 1e30f, METRIC_ULP, 2},
+		{"glm_atan_ps", run_ps<glm_atan_ps>, ref_atan, libm_atan, -Max, Max, METRIC_ABSOLUTE, 2e-6},
+		{"glm_asin_ps", run_ps<glm_asin_ps>, ref_asin, libm_asin, -1.0f, 1.0f, METRIC_ULP, 2},
+		{"glm_acos_ps", run_ps<glm_acos_ps>, ref_acos, libm_acos, -1.0f, 1.0f, METRIC_ABSOLUTE, 4e-7},
+		{"sinh mediump", run_vec4<sinh_m>, ref_sinh, libm_sinh, -88.0f, 88.0f, METRIC_ULP, 6},
+		{"cosh mediump", run_vec4<cosh_m>, ref_cosh, libm_cosh, -88.0f, 88.0f, METRIC_ULP, 3},
+		{"tanh mediump", run_vec4<tanh_m>, ref_tanh, libm_tanh, -Max, Max, METRIC_ULP, 5},
+		{"asinh mediump", run_vec4<asinh_m>, ref_asinh, libm_asinh, -1e18f, 1e18f, METRIC_ULP, 2},
+		{"acosh mediump", run_vec4<acosh_m>, ref_acosh, libm_acosh, 1.0f, 1e18f, METRIC_ULP, 3},
+		{"atanh mediump", run_vec4<atanh_m>, ref_atanh, libm_atanh, -0.999f, 0.999f, METRIC_ULP, 2},
+		{"glm_sincos_ps_highp sin", run_sincos_ps<glm_sincos_ps_highp, false>, ref_sin, libm_sin, -Max, Max, METRIC_ULP, 1},
+		{"glm_sincos_ps_highp cos", run_sincos_ps<glm_sincos_ps_highp, true>, ref_cos, libm_cos, -Max, Max, METRIC_ULP, 1},
+		{"glm_tan_ps_highp", run_ps<glm_tan_ps_highp>, ref_tan, libm_tan, -Max, Max, METRIC_ULP, 1},
+		{"glm_exp_ps_highp", run_ps<glm_exp_ps_highp>, ref_exp, libm_exp, -103.0f, 88.0f, METRIC_ULP, 1},
+		{"glm_exp2_ps_highp", run_ps<glm_exp2_ps_highp>, ref_exp2, libm_exp2, -149.0f, 127.0f, METRIC_ULP, 1},
+		{"glm_log_ps_highp", run_ps<glm_log_ps_highp>, ref_log, libm_log, Denormal, Max, METRIC_ULP, 1},
+		{"glm_log2_ps_highp", run_ps<glm_log2_ps_highp>, ref_log2, libm_log2, Denormal, Max, METRIC_ULP, 1},
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		{"glm_sincos_ps256 sin", run_sincos_ps256<false>, ref_sin, libm_sin, -1e4f, 1e4f, METRIC_ABSOLUTE, 4e-6},
+		{"glm_sincos_ps256 cos", run_sincos_ps256<true>, ref_cos, libm_cos, -1e4f, 1e4f, METRIC_ABSOLUTE, 4e-6},
+		{"glm_exp_ps256", run_ps256<glm_exp_ps256>, ref_exp, libm_exp, -87.0f, 88.0f, METRIC_ULP, 3},
+		{"glm_log_ps256", run_ps256<glm_log_ps256>, ref_log, libm_log, FLT_MIN, Max, METRIC_ULP, 2},
+		{"glm_atan_ps256", run_ps256<glm_atan_ps256>, ref_atan, libm_atan, -Max, Max, METRIC_ABSOLUTE, 2e-6},
+		{"glm_asin_ps256", run_ps256<glm_asin_ps256>, ref_asin, libm_asin, -1.0f, 1.0f, METRIC_ULP, 2},
+		{"glm_acos_ps256", run_ps256<glm_acos_ps256>, ref_acos, libm_acos, -1.0f, 1.0f, METRIC_ABSOLUTE, 4e-7},
+#		endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+	};
+
+#	if defined(__FMA__)
+	char const* const Fma = "yes";
+#	else
+	char const* const Fma = "no";
+#	endif
+	std::printf("%s sweep, fma: %s\n", S.Exhaustive ? "exhaustive" : "stratified", Fma);
+	std::printf("%-28s %23s %11s %9s %8s %9s %12s %8s %8s  %-12s %-4s %s\n",
+		"kernel", "domain", "samples", "max ulp", "mean ulp", "max abs", "worst x", "ns/elem", "libm ns", "bound", "", "special mismatches");
+
+	int Error = 0;
+	for(std::size_t i = 0; i < sizeof(Kernels) / sizeof(Kernels[0]); ++i)
+		if(!S.Filter || std::strstr(Kernels[i].Name, S.Filter))
+			Error += measure(S, Kernels[i]);
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif//GLM_SIMD_TRANSCENDENTAL == GLM_ENABLE